@@ -0,0 +1,54 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "../s21_matrix_oop.h"
+
+namespace {
+
+S21Matrix FilledMatrix(int n) {
+  S21Matrix result(n, n);
+  for (auto i = 0; i < n; ++i)
+    for (auto j = 0; j < n; ++j) result(i, j) = std::sin(i * 0.37 + j);
+  return result;
+}
+
+// a user kernel, y = 2 * x + 1, written with each way of reaching the
+// elements: range(1) is 0 for GetValue/SetValue, 1 for operator(), 2 for the
+// row pointers of Data() and GetStride(), 3 for the iterators
+void BM_AccessKernel(benchmark::State &state) {
+  const int n = state.range(0);
+  const S21Matrix x = FilledMatrix(n);
+  S21Matrix y(n, n);
+  for (auto _ : state) {
+    switch (state.range(1)) {
+      case 0:
+        for (auto i = 0; i < n; ++i)
+          for (auto j = 0; j < n; ++j)
+            y.SetValue(i, j, 2 * x.GetValue(i, j) + 1);
+        break;
+      case 1:
+        for (auto i = 0; i < n; ++i)
+          for (auto j = 0; j < n; ++j) y(i, j) = 2 * x(i, j) + 1;
+        break;
+      case 2:
+        for (auto i = 0; i < n; ++i) {
+          const double *in = x.Data() + i * x.GetStride();
+          double *out = y.Data() + i * y.GetStride();
+          for (auto j = 0; j < n; ++j) out[j] = 2 * in[j] + 1;
+        }
+        break;
+      default:
+        std::transform(x.begin(), x.end(), y.begin(),
+                       [](double value) { return 2 * value + 1; });
+    }
+    benchmark::DoNotOptimize(y.Data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+}  // namespace
+
+BENCHMARK(BM_AccessKernel)->ArgsProduct({{100, 1000}, {0, 1, 2, 3}});
@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "../s21_matrix_oop.h"
+
+namespace {
+
+template <class T>
+S21BasicMatrix<T> FilledMatrix(int n, double phase) {
+  S21BasicMatrix<T> result(n, n);
+  for (auto i = 0; i < n; ++i)
+    for (auto j = 0; j < n; ++j)
+      result.SetValue(i, j, static_cast<T>(std::sin(phase + i * 0.37 + j)));
+  return result;
+}
+
+// the n x n sum is bound by the memory bandwidth: float moves half the
+// bytes; S21BasicMatrix<double> is S21Matrix with its SIMD kernels
+template <class T>
+void BM_BasicSumMatrix(benchmark::State &state) {
+  const int n = state.range(0);
+  S21BasicMatrix<T> a = FilledMatrix<T>(n, 0);
+  const S21BasicMatrix<T> b = FilledMatrix<T>(n, 1);
+  for (auto _ : state) {
+    a.SumMatrix(b);
+    benchmark::DoNotOptimize(a);
+  }
+  state.SetBytesProcessed(state.iterations() * 3 * sizeof(T) * n * n);
+}
+
+template <class T>
+void BM_BasicTranspose(benchmark::State &state) {
+  const int n = state.range(0);
+  const S21BasicMatrix<T> a = FilledMatrix<T>(n, 0);
+  for (auto _ : state) benchmark::DoNotOptimize(a.Transpose());
+  state.SetBytesProcessed(state.iterations() * 2 * sizeof(T) * n * n);
+}
+
+// range(1) is the s21::Accumulation of the sums
+template <class T>
+void BM_BasicMulMatrix(benchmark::State &state) {
+  const int n = state.range(0);
+  const S21BasicMatrix<T> a = FilledMatrix<T>(n, 0), b = FilledMatrix<T>(n, 1);
+  const auto accumulation = static_cast<s21::Accumulation>(state.range(1));
+  S21BasicMatrix<T> c;
+  for (auto _ : state) {
+    c = a;
+    c.MulMatrix(b, accumulation);
+    benchmark::DoNotOptimize(c);
+  }
+  state.counters["FLOPS"] = benchmark::Counter(
+      2.0 * n * n * n, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// S21Matrix, the specialization for double, with its own GEMM kernel
+void BM_DoubleMulMatrix(benchmark::State &state) {
+  const int n = state.range(0);
+  const S21Matrix a = FilledMatrix<double>(n, 0),
+                  b = FilledMatrix<double>(n, 1);
+  S21Matrix c;
+  for (auto _ : state) {
+    c = a;
+    c.MulMatrix(b);
+    benchmark::DoNotOptimize(c);
+  }
+  state.counters["FLOPS"] = benchmark::Counter(
+      2.0 * n * n * n, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_BasicSumMatrix, float)->Arg(256)->Arg(2048);
+BENCHMARK_TEMPLATE(BM_BasicSumMatrix, double)->Arg(256)->Arg(2048);
+BENCHMARK_TEMPLATE(BM_BasicTranspose, float)->Arg(2048);
+BENCHMARK_TEMPLATE(BM_BasicTranspose, double)->Arg(2048);
+BENCHMARK_TEMPLATE(BM_BasicMulMatrix, float)
+    ->ArgsProduct({{256, 1024}, {0, 1}})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DoubleMulMatrix)
+    ->Arg(256)
+    ->Arg(1024)
+    ->Unit(benchmark::kMillisecond);
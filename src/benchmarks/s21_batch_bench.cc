@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#include "../s21_batch.h"
+
+namespace {
+
+// the matrices of a batch
+constexpr int kCount = 1024;
+
+std::vector<S21Matrix> DominantMatrices(int count, int n) {
+  std::vector<S21Matrix> result;
+  for (auto item = 0; item < count; ++item) {
+    S21Matrix matrix(n, n);
+    for (auto i = 0; i < n; ++i)
+      for (auto j = 0; j < n; ++j)
+        matrix.SetValue(i, j,
+                        i == j ? 2.0 * n : std::sin(item + i * 7.0 + j));
+    result.push_back(matrix);
+  }
+  return result;
+}
+
+// the same products, determinants and inverses of kCount matrices with one
+// batch and with a loop over S21Matrix, the items are the matrices
+
+void BM_BatchMul(benchmark::State &state) {
+  const int n = state.range(0);
+  S21MatrixBatch a(DominantMatrices(kCount, n)), b(a);
+  for (auto _ : state) {
+    S21MatrixBatch product(a);
+    product.MulMatrix(b);
+    benchmark::DoNotOptimize(product);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_LoopMul(benchmark::State &state) {
+  const int n = state.range(0);
+  std::vector<S21Matrix> a = DominantMatrices(kCount, n), b(a);
+  for (auto _ : state)
+    for (auto item = 0; item < kCount; ++item) {
+      S21Matrix product(a[item]);
+      product.MulMatrix(b[item]);
+      benchmark::DoNotOptimize(product);
+    }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_BatchDeterminant(benchmark::State &state) {
+  S21MatrixBatch a(DominantMatrices(kCount, state.range(0)));
+  for (auto _ : state) benchmark::DoNotOptimize(a.Determinant());
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_LoopDeterminant(benchmark::State &state) {
+  std::vector<S21Matrix> a = DominantMatrices(kCount, state.range(0));
+  for (auto _ : state)
+    for (auto &matrix : a) benchmark::DoNotOptimize(matrix.Determinant());
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_BatchInverse(benchmark::State &state) {
+  S21MatrixBatch a(DominantMatrices(kCount, state.range(0)));
+  for (auto _ : state) benchmark::DoNotOptimize(a.InverseMatrix());
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_LoopInverse(benchmark::State &state) {
+  std::vector<S21Matrix> a = DominantMatrices(kCount, state.range(0));
+  for (auto _ : state)
+    for (auto &matrix : a) benchmark::DoNotOptimize(matrix.InverseMatrix());
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_BatchSum(benchmark::State &state) {
+  S21MatrixBatch a(DominantMatrices(kCount, state.range(0))), b(a);
+  for (auto _ : state) {
+    a.SumMatrix(b);
+    benchmark::DoNotOptimize(a);
+  }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+void BM_LoopSum(benchmark::State &state) {
+  std::vector<S21Matrix> a = DominantMatrices(kCount, state.range(0)), b(a);
+  for (auto _ : state)
+    for (auto item = 0; item < kCount; ++item) {
+      a[item].SumMatrix(b[item]);
+      benchmark::DoNotOptimize(a[item]);
+    }
+  state.SetItemsProcessed(state.iterations() * kCount);
+}
+
+}  // namespace
+
+BENCHMARK(BM_BatchMul)->Arg(4)->Arg(8)->Arg(16)->Arg(32);
+BENCHMARK(BM_LoopMul)->Arg(4)->Arg(8)->Arg(16)->Arg(32);
+BENCHMARK(BM_BatchDeterminant)->Arg(4)->Arg(8)->Arg(16)->Arg(32);
+BENCHMARK(BM_LoopDeterminant)->Arg(4)->Arg(8)->Arg(16)->Arg(32);
+BENCHMARK(BM_BatchInverse)->Arg(4)->Arg(8)->Arg(16)->Arg(32);
+BENCHMARK(BM_LoopInverse)->Arg(4)->Arg(8)->Arg(16)->Arg(32);
+BENCHMARK(BM_BatchSum)->Arg(4)->Arg(32);
+BENCHMARK(BM_LoopSum)->Arg(4)->Arg(32);
@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+"""Compares two JSON reports of the benchmarks (--benchmark_out) and fails
+when a benchmark of the current report is slower than in the baseline by
+more than the threshold.
+
+usage: s21_bench_compare.py BASELINE CURRENT [--threshold PERCENT]
+
+With repetitions the median aggregate is compared, otherwise the single
+run. New benchmarks are listed and the ones that were not run are counted,
+neither counts as a regression.
+"""
+
+import argparse
+import json
+import sys
+
+# nanoseconds per unit of the "time_unit" field
+UNITS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load(path):
+    """name -> real time in nanoseconds"""
+    with open(path) as report:
+        benchmarks = json.load(report)["benchmarks"]
+    times, medians = {}, {}
+    for bench in benchmarks:
+        if bench.get("error_occurred"):
+            continue
+        time = bench["real_time"] * UNITS[bench.get("time_unit", "ns")]
+        if bench.get("run_type") == "aggregate":
+            if bench.get("aggregate_name") == "median":
+                medians[bench["run_name"]] = time
+        else:
+            times.setdefault(bench.get("run_name", bench["name"]), time)
+    times.update(medians)
+    return times
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="allowed slowdown in percent (default 10)")
+    args = parser.parse_args()
+
+    baseline, current = load(args.baseline), load(args.current)
+    regressions = 0
+    width = max((len(name) for name in current), default=0)
+    print(f"{'benchmark':<{width}} {'baseline':>12} {'current':>12} "
+          f"{'change':>8}")
+    for name, time in current.items():
+        if name not in baseline:
+            print(f"{name:<{width}} {'-':>12} {time:>10.0f}ns {'new':>8}")
+            continue
+        change = (time / baseline[name] - 1) * 100
+        mark = ""
+        if change > args.threshold:
+            regressions += 1
+            mark = "  REGRESSION"
+        print(f"{name:<{width}} {baseline[name]:>10.0f}ns {time:>10.0f}ns "
+              f"{change:>+7.1f}%{mark}")
+    missing = len(baseline.keys() - current.keys())
+    if missing:
+        print(f"{missing} benchmark(s) of the baseline were not run")
+
+    if regressions:
+        print(f"{regressions} benchmark(s) slower than the baseline by more "
+              f"than {args.threshold:g}%")
+        return 1
+    print(f"no regressions above {args.threshold:g}%")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
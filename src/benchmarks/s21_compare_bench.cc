@@ -0,0 +1,49 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "../s21_matrix_oop.h"
+
+namespace {
+
+S21Matrix FilledMatrix(int n) {
+  S21Matrix result(n, n);
+  for (auto i = 0; i < n; ++i)
+    for (auto j = 0; j < n; ++j) result(i, j) = std::sin(i * 0.37 + j);
+  return result;
+}
+
+// a convergence check of two matrices that match within 1e-9: range(1) is
+// 0 for a GetValue loop, 1 for EqMatrix with the tolerance, 2 for the same
+// with a mismatch in the first row, 3 for MaxDifference
+void BM_ToleranceCompare(benchmark::State &state) {
+  const int n = state.range(0);
+  const S21Matrix a = FilledMatrix(n);
+  S21Matrix b = a;
+  b.Apply([](double x) { return x + 1e-12; });
+  if (state.range(1) == 2) b(0, 5) += 1;
+  const auto tolerance = s21::Tolerance::Absolute(1e-9);
+  for (auto _ : state) {
+    switch (state.range(1)) {
+      case 0: {
+        bool equal = true;
+        for (auto i = 0; i < n; ++i)
+          for (auto j = 0; j < n; ++j)
+            if (std::fabs(a.GetValue(i, j) - b.GetValue(i, j)) > 1e-9)
+              equal = false;
+        benchmark::DoNotOptimize(equal);
+        break;
+      }
+      case 3:
+        benchmark::DoNotOptimize(a.MaxDifference(b));
+        break;
+      default:
+        benchmark::DoNotOptimize(a.EqMatrix(b, tolerance));
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * 2 * sizeof(double) * n * n);
+}
+
+}  // namespace
+
+BENCHMARK(BM_ToleranceCompare)->ArgsProduct({{256, 2048}, {0, 1, 2, 3}});
@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "../s21_execution.h"
+
+namespace {
+
+S21Matrix FilledMatrix(int n) {
+  S21Matrix result(n, n);
+  for (auto i = 0; i < n; ++i)
+    for (auto j = 0; j < n; ++j) result(i, j) = std::sin(i * 0.37 + j);
+  return result;
+}
+
+double Sigmoid(double x) { return 1 / (1 + std::exp(-x)); }
+
+// a user transform, the sigmoid of every element: range(1) is 0 for the
+// GetValue/SetValue loop, 1 for Apply(seq), 2 for Apply(par)
+void BM_ApplySigmoid(benchmark::State &state) {
+  const int n = state.range(0);
+  const S21Matrix x = FilledMatrix(n);
+  S21Matrix y = x;
+  for (auto _ : state) {
+    state.PauseTiming();
+    y = x;
+    state.ResumeTiming();
+    switch (state.range(1)) {
+      case 0:
+        for (auto i = 0; i < n; ++i)
+          for (auto j = 0; j < n; ++j)
+            y.SetValue(i, j, Sigmoid(y.GetValue(i, j)));
+        break;
+      case 1:
+        y.Apply(std::execution::seq, Sigmoid);
+        break;
+      default:
+        y.Apply(std::execution::par, Sigmoid);
+    }
+    benchmark::DoNotOptimize(y.Data());
+  }
+  state.SetItemsProcessed(state.iterations() * n * n);
+}
+
+// the sum with each execution: range(1) is the s21::Execution
+void BM_ExecutionSumMatrix(benchmark::State &state) {
+  const int n = state.range(0);
+  const auto execution = static_cast<s21::Execution>(state.range(1));
+  S21Matrix a = FilledMatrix(n);
+  const S21Matrix b = FilledMatrix(n);
+  for (auto _ : state) {
+    a.SumMatrix(execution, b);
+    benchmark::DoNotOptimize(a.Data());
+  }
+  state.SetBytesProcessed(state.iterations() * 3 * sizeof(double) * n * n);
+}
+
+}  // namespace
+
+BENCHMARK(BM_ApplySigmoid)->ArgsProduct({{256, 2048}, {0, 1, 2}});
+BENCHMARK(BM_ExecutionSumMatrix)->ArgsProduct({{256, 2048}, {0, 1, 2}});
@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+
+#include "../common/s21_alloc_counter.h"
+#include "../s21_matrix_oop.h"
+
+namespace {
+
+S21Matrix FilledMatrix(int n, double shift) {
+  S21Matrix result(n, n);
+  for (auto i = 0; i < n; ++i)
+    for (auto j = 0; j < n; ++j) result.SetValue(i, j, i - j + shift);
+  return result;
+}
+
+// D = A + B - C * k the way the eager operators computed it: a full
+// temporary for every binary operation
+void BM_EagerChain(benchmark::State &state) {
+  const int n = state.range(0);
+  const S21Matrix a = FilledMatrix(n, 0), b = FilledMatrix(n, 1),
+                  c = FilledMatrix(n, 2);
+  std::size_t count = s21_alloc::AllocationCount();
+  for (auto _ : state) {
+    S21Matrix sum = a;
+    sum.SumMatrix(b);
+    S21Matrix scaled = c;
+    scaled.MulNumber(0.5);
+    S21Matrix d = sum;
+    d.SubMatrix(scaled);
+    benchmark::DoNotOptimize(d);
+  }
+  state.counters["allocs"] =
+      benchmark::Counter(s21_alloc::AllocationCount() - count,
+                         benchmark::Counter::kAvgIterations);
+}
+
+// the same expression evaluated in one fused pass
+void BM_ExpressionChain(benchmark::State &state) {
+  const int n = state.range(0);
+  const S21Matrix a = FilledMatrix(n, 0), b = FilledMatrix(n, 1),
+                  c = FilledMatrix(n, 2);
+  std::size_t count = s21_alloc::AllocationCount();
+  for (auto _ : state) {
+    S21Matrix d = a + b - c * 0.5;
+    benchmark::DoNotOptimize(d);
+  }
+  state.counters["allocs"] =
+      benchmark::Counter(s21_alloc::AllocationCount() - count,
+                         benchmark::Counter::kAvgIterations);
+}
+
+// assigning into an existing matrix of the right size does not allocate
+void BM_ExpressionAssign(benchmark::State &state) {
+  const int n = state.range(0);
+  const S21Matrix a = FilledMatrix(n, 0), b = FilledMatrix(n, 1),
+                  c = FilledMatrix(n, 2);
+  S21Matrix d(n, n);
+  std::size_t count = s21_alloc::AllocationCount();
+  for (auto _ : state) {
+    d = a + b - c * 0.5;
+    benchmark::ClobberMemory();
+  }
+  state.counters["allocs"] =
+      benchmark::Counter(s21_alloc::AllocationCount() - count,
+                         benchmark::Counter::kAvgIterations);
+}
+
+}  // namespace
+
+BENCHMARK(BM_EagerChain)->Arg(8)->Arg(128)->Arg(1024);
+BENCHMARK(BM_ExpressionChain)->Arg(8)->Arg(128)->Arg(1024);
+BENCHMARK(BM_ExpressionAssign)->Arg(8)->Arg(128)->Arg(1024);
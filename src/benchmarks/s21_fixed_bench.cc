@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "../s21_fixed_matrix.h"
+
+namespace {
+
+template <int N>
+S21FixedMatrix<N, N> DominantFixed() {
+  S21FixedMatrix<N, N> result;
+  for (auto i = 0; i < N; ++i)
+    for (auto j = 0; j < N; ++j)
+      result.SetValue(i, j, i == j ? 2.0 * N : std::sin(i * 7.0 + j));
+  return result;
+}
+
+// the same transforms with stack and heap storage
+template <int N>
+void BM_FixedMul(benchmark::State &state) {
+  auto a = DominantFixed<N>(), b = DominantFixed<N>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(a * b);
+  }
+}
+
+template <int N>
+void BM_DynamicMul(benchmark::State &state) {
+  S21Matrix a(DominantFixed<N>()), b(DominantFixed<N>());
+  for (auto _ : state) benchmark::DoNotOptimize(S21Matrix(a * b));
+}
+
+template <int N>
+void BM_FixedAdd(benchmark::State &state) {
+  auto a = DominantFixed<N>(), b = DominantFixed<N>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(a + b);
+  }
+}
+
+template <int N>
+void BM_DynamicAdd(benchmark::State &state) {
+  S21Matrix a(DominantFixed<N>()), b(DominantFixed<N>());
+  for (auto _ : state) benchmark::DoNotOptimize(S21Matrix(a + b));
+}
+
+template <int N>
+void BM_FixedInverse(benchmark::State &state) {
+  auto a = DominantFixed<N>();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a);
+    benchmark::DoNotOptimize(a.InverseMatrix());
+  }
+}
+
+template <int N>
+void BM_DynamicInverse(benchmark::State &state) {
+  S21Matrix a(DominantFixed<N>());
+  for (auto _ : state) benchmark::DoNotOptimize(a.InverseMatrix());
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_FixedMul, 3);
+BENCHMARK_TEMPLATE(BM_DynamicMul, 3);
+BENCHMARK_TEMPLATE(BM_FixedMul, 4);
+BENCHMARK_TEMPLATE(BM_DynamicMul, 4);
+BENCHMARK_TEMPLATE(BM_FixedMul, 6);
+BENCHMARK_TEMPLATE(BM_DynamicMul, 6);
+BENCHMARK_TEMPLATE(BM_FixedAdd, 4);
+BENCHMARK_TEMPLATE(BM_DynamicAdd, 4);
+BENCHMARK_TEMPLATE(BM_FixedInverse, 3);
+BENCHMARK_TEMPLATE(BM_DynamicInverse, 3);
+BENCHMARK_TEMPLATE(BM_FixedInverse, 4);
+BENCHMARK_TEMPLATE(BM_DynamicInverse, 4);
+BENCHMARK_TEMPLATE(BM_FixedInverse, 6);
+BENCHMARK_TEMPLATE(BM_DynamicInverse, 6);
@@ -0,0 +1,33 @@
+#include <benchmark/benchmark.h>
+
+#include "../s21_matrix_oop.h"
+
+namespace {
+
+S21Matrix FilledMatrix(int rows, int cols) {
+  S21Matrix result(rows, cols);
+  for (auto i = 0; i < rows; ++i)
+    for (auto j = 0; j < cols; ++j) result.SetValue(i, j, (i + j) % 7 * 0.25);
+  return result;
+}
+
+// square products reported in floating point operations per second
+void BM_MulMatrix(benchmark::State &state) {
+  const int n = state.range(0);
+  const S21Matrix a = FilledMatrix(n, n);
+  const S21Matrix b = FilledMatrix(n, n);
+  for (auto _ : state) {
+    S21Matrix c = a;
+    c.MulMatrix(b);
+    benchmark::DoNotOptimize(c);
+  }
+  state.counters["FLOPS"] = benchmark::Counter(
+      2.0 * n * n * n, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+}  // namespace
+
+BENCHMARK(BM_MulMatrix)
+    ->RangeMultiplier(2)
+    ->Range(16, 4096)
+    ->Unit(benchmark::kMillisecond);
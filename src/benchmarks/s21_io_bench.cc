@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+#include "../s21_io.h"
+
+namespace {
+
+S21Matrix Filled(int rows, int cols) {
+  S21Matrix result(rows, cols);
+  for (auto i = 0; i < rows; ++i)
+    for (auto j = 0; j < cols; ++j) result.SetValue(i, j, std::sin(i + j));
+  return result;
+}
+
+std::string BenchFile() {
+  return (std::filesystem::temp_directory_path() / "s21_io_bench.s21m")
+      .string();
+}
+
+void BM_SaveMatrix(benchmark::State &state) {
+  S21Matrix matrix = Filled(state.range(0), state.range(0));
+  for (auto _ : state) s21::SaveMatrix(matrix, BenchFile());
+  state.SetBytesProcessed(state.iterations() * matrix.GetRows() *
+                          matrix.GetCols() * sizeof(double));
+  std::remove(BenchFile().c_str());
+}
+
+// the whole file is read into a new matrix and its checksum is verified
+void BM_LoadMatrix(benchmark::State &state) {
+  S21Matrix matrix = Filled(state.range(0), state.range(0));
+  s21::SaveMatrix(matrix, BenchFile());
+  for (auto _ : state) benchmark::DoNotOptimize(s21::LoadMatrix(BenchFile()));
+  state.SetBytesProcessed(state.iterations() * matrix.GetRows() *
+                          matrix.GetCols() * sizeof(double));
+  std::remove(BenchFile().c_str());
+}
+
+// the mapping alone, the pages are read on the first access
+void BM_MapMatrix(benchmark::State &state) {
+  s21::SaveMatrix(Filled(state.range(0), state.range(0)), BenchFile());
+  for (auto _ : state) {
+    S21MappedMatrix mapped(BenchFile());
+    benchmark::DoNotOptimize(mapped.Matrix()(0, 0));
+  }
+  std::remove(BenchFile().c_str());
+}
+
+// the mapping and one pass over all the elements
+void BM_MapMatrixTouched(benchmark::State &state) {
+  s21::SaveMatrix(Filled(state.range(0), state.range(0)), BenchFile());
+  for (auto _ : state) {
+    S21MappedMatrix mapped(BenchFile());
+    const S21Matrix &view = mapped;
+    double sum = 0;
+    for (auto i = 0; i < view.GetRows(); ++i)
+      for (auto j = 0; j < view.GetCols(); ++j) sum += view(i, j);
+    benchmark::DoNotOptimize(sum);
+  }
+  std::remove(BenchFile().c_str());
+}
+
+}  // namespace
+
+BENCHMARK(BM_SaveMatrix)->Arg(2048)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LoadMatrix)->Arg(2048)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MapMatrix)->Arg(2048)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_MapMatrixTouched)->Arg(2048)->Unit(benchmark::kMillisecond);
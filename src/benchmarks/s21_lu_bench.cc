@@ -0,0 +1,45 @@
+#include <benchmark/benchmark.h>
+
+#include "../s21_lu.h"
+
+namespace {
+
+S21Matrix DominantMatrix(int n) {
+  S21Matrix result(n, n);
+  for (auto i = 0; i < n; ++i)
+    for (auto j = 0; j < n; ++j)
+      result.SetValue(i, j, i == j ? 2.0 * n : std::sin(i * 7.0 + j));
+  return result;
+}
+
+void BM_Determinant(benchmark::State &state) {
+  S21Matrix matrix = DominantMatrix(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(matrix.Determinant());
+}
+
+void BM_InverseMatrix(benchmark::State &state) {
+  S21Matrix matrix = DominantMatrix(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(matrix.InverseMatrix());
+}
+
+void BM_CalcComplements(benchmark::State &state) {
+  S21Matrix matrix = DominantMatrix(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(matrix.CalcComplements());
+}
+
+// one factorization reused for several right-hand sides
+void BM_LUSolve(benchmark::State &state) {
+  const int n = state.range(0);
+  S21LUDecomposition lu(DominantMatrix(n));
+  S21Matrix rhs(n, 1);
+  for (auto _ : state) benchmark::DoNotOptimize(lu.Solve(rhs));
+}
+
+}  // namespace
+
+BENCHMARK(BM_Determinant)->Arg(4)->Arg(12)->Arg(100)->Arg(500)->Unit(
+    benchmark::kMicrosecond);
+BENCHMARK(BM_InverseMatrix)->Arg(4)->Arg(12)->Arg(100)->Arg(500)->Unit(
+    benchmark::kMicrosecond);
+BENCHMARK(BM_CalcComplements)->Arg(12)->Arg(100)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_LUSolve)->Arg(100)->Arg(500)->Unit(benchmark::kMicrosecond);
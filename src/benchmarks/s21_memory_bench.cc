@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+
+#include "../s21_matrix_oop.h"
+#include "../s21_memory.h"
+
+namespace {
+
+// a short-lived temporary of the given order per iteration
+void BM_TemporaryDefault(benchmark::State &state) {
+  const int n = state.range(0);
+  for (auto _ : state) {
+    S21Matrix temporary(n, n);
+    benchmark::DoNotOptimize(temporary);
+  }
+}
+
+void BM_TemporaryPool(benchmark::State &state) {
+  const int n = state.range(0);
+  S21PoolResource pool;
+  for (auto _ : state) {
+    S21Matrix temporary(n, n, &pool);
+    benchmark::DoNotOptimize(temporary);
+  }
+}
+
+// a batch of temporaries freed at once at the end of a scope
+void BM_TemporaryArena(benchmark::State &state) {
+  const int n = state.range(0);
+  S21ArenaResource arena;
+  for (auto _ : state) {
+    for (auto i = 0; i < 16; ++i) {
+      S21Matrix temporary(n, n, &arena);
+      benchmark::DoNotOptimize(temporary);
+    }
+    arena.Release();
+  }
+}
+
+void BM_TemporaryDefaultBatch(benchmark::State &state) {
+  const int n = state.range(0);
+  for (auto _ : state)
+    for (auto i = 0; i < 16; ++i) {
+      S21Matrix temporary(n, n);
+      benchmark::DoNotOptimize(temporary);
+    }
+}
+
+}  // namespace
+
+BENCHMARK(BM_TemporaryDefault)->Arg(3)->Arg(16)->Arg(64);
+BENCHMARK(BM_TemporaryPool)->Arg(3)->Arg(16)->Arg(64);
+BENCHMARK(BM_TemporaryDefaultBatch)->Arg(3)->Arg(16)->Arg(64);
+BENCHMARK(BM_TemporaryArena)->Arg(3)->Arg(16)->Arg(64);
@@ -0,0 +1,385 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <utility>
+
+#include "../s21_matrix_oop.h"
+
+// Every public method and operator of S21Matrix over a sweep of shapes:
+// tiny (3 x 3), square, tall and wide. The methods defined for square
+// matrices only sweep the order. Together with the benchmarks of the other
+// files this is the suite compared against the baseline by make
+// bench_compare.
+
+namespace {
+
+// a diagonally dominant matrix, invertible for square shapes
+S21Matrix FilledMatrix(int rows, int cols) {
+  S21Matrix result(rows, cols);
+  for (auto i = 0; i < rows; ++i)
+    for (auto j = 0; j < cols; ++j)
+      result.SetValue(i, j, i == j ? 2.0 * cols : std::sin(i * 7.0 + j));
+  return result;
+}
+
+// elements read or written by one iteration of an element-wise operation
+void SetElements(benchmark::State &state, int rows, int cols) {
+  state.SetItemsProcessed(state.iterations() * rows * cols);
+}
+
+void Shapes(benchmark::internal::Benchmark *bench) {
+  bench->ArgNames({"rows", "cols"});
+  bench->Args({3, 3})->Args({64, 64})->Args({512, 512});
+  bench->Args({4096, 16})->Args({16, 4096});
+}
+
+void Orders(benchmark::internal::Benchmark *bench) {
+  bench->ArgNames({"n"});
+  bench->Arg(3)->Arg(4)->Arg(16)->Arg(64)->Arg(256);
+}
+
+// CONSTRUCTORS AND ASSIGNMENTS
+
+void BM_ApiDefaultConstructor(benchmark::State &state) {
+  for (auto _ : state) {
+    S21Matrix matrix;
+    benchmark::DoNotOptimize(matrix);
+  }
+}
+
+void BM_ApiConstructor(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  for (auto _ : state) {
+    S21Matrix matrix(rows, cols);
+    benchmark::DoNotOptimize(matrix);
+  }
+  SetElements(state, rows, cols);
+}
+
+void BM_ApiCopyConstructor(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  const S21Matrix source = FilledMatrix(rows, cols);
+  for (auto _ : state) {
+    S21Matrix copy(source);
+    benchmark::DoNotOptimize(copy);
+  }
+  SetElements(state, rows, cols);
+}
+
+// a round trip of two moves, no element is touched
+void BM_ApiMoveConstructor(benchmark::State &state) {
+  S21Matrix source = FilledMatrix(state.range(0), state.range(1));
+  for (auto _ : state) {
+    S21Matrix moved(std::move(source));
+    source = std::move(moved);
+    benchmark::DoNotOptimize(source);
+  }
+}
+
+// the destination has the right size, the storage is reused
+void BM_ApiCopyAssign(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  const S21Matrix source = FilledMatrix(rows, cols);
+  S21Matrix destination(rows, cols);
+  for (auto _ : state) {
+    destination = source;
+    benchmark::ClobberMemory();
+  }
+  SetElements(state, rows, cols);
+}
+
+void BM_ApiMoveAssign(benchmark::State &state) {
+  S21Matrix first = FilledMatrix(state.range(0), state.range(1)), second;
+  for (auto _ : state) {
+    second = std::move(first);
+    first = std::move(second);
+    benchmark::DoNotOptimize(first);
+  }
+}
+
+// ELEMENT-WISE OPERATIONS
+
+void BM_ApiEqMatrix(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  const S21Matrix a = FilledMatrix(rows, cols), b = a;
+  for (auto _ : state) benchmark::DoNotOptimize(a.EqMatrix(b));
+  SetElements(state, rows, cols);
+}
+
+void BM_ApiEqualOperator(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  S21Matrix a = FilledMatrix(rows, cols);
+  const S21Matrix b = a;
+  for (auto _ : state) benchmark::DoNotOptimize(a == b);
+  SetElements(state, rows, cols);
+}
+
+void BM_ApiSumMatrix(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  S21Matrix a = FilledMatrix(rows, cols);
+  const S21Matrix b = FilledMatrix(rows, cols);
+  for (auto _ : state) {
+    a.SumMatrix(b);
+    benchmark::ClobberMemory();
+  }
+  SetElements(state, rows, cols);
+}
+
+void BM_ApiSubMatrix(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  S21Matrix a = FilledMatrix(rows, cols);
+  const S21Matrix b = FilledMatrix(rows, cols);
+  for (auto _ : state) {
+    a.SubMatrix(b);
+    benchmark::ClobberMemory();
+  }
+  SetElements(state, rows, cols);
+}
+
+void BM_ApiMulNumber(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  S21Matrix a = FilledMatrix(rows, cols);
+  for (auto _ : state) {
+    a.MulNumber(1.0000001);
+    benchmark::ClobberMemory();
+  }
+  SetElements(state, rows, cols);
+}
+
+void BM_ApiAxpyMatrix(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  S21Matrix a = FilledMatrix(rows, cols);
+  const S21Matrix b = FilledMatrix(rows, cols);
+  for (auto _ : state) {
+    a.AxpyMatrix(1e-9, b);
+    benchmark::ClobberMemory();
+  }
+  SetElements(state, rows, cols);
+}
+
+void BM_ApiPlusOperator(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  const S21Matrix a = FilledMatrix(rows, cols), b = FilledMatrix(rows, cols);
+  for (auto _ : state) {
+    S21Matrix c = a + b;
+    benchmark::DoNotOptimize(c);
+  }
+  SetElements(state, rows, cols);
+}
+
+void BM_ApiMinusOperator(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  const S21Matrix a = FilledMatrix(rows, cols), b = FilledMatrix(rows, cols);
+  for (auto _ : state) {
+    S21Matrix c = a - b;
+    benchmark::DoNotOptimize(c);
+  }
+  SetElements(state, rows, cols);
+}
+
+void BM_ApiNumberOperator(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  const S21Matrix a = FilledMatrix(rows, cols);
+  for (auto _ : state) {
+    S21Matrix c = a * 2.0;
+    benchmark::DoNotOptimize(c);
+  }
+  SetElements(state, rows, cols);
+}
+
+void BM_ApiPlusAssignOperator(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  S21Matrix a = FilledMatrix(rows, cols);
+  const S21Matrix b = FilledMatrix(rows, cols);
+  for (auto _ : state) {
+    a += b;
+    benchmark::ClobberMemory();
+  }
+  SetElements(state, rows, cols);
+}
+
+void BM_ApiMinusAssignOperator(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  S21Matrix a = FilledMatrix(rows, cols);
+  const S21Matrix b = FilledMatrix(rows, cols);
+  for (auto _ : state) {
+    a -= b;
+    benchmark::ClobberMemory();
+  }
+  SetElements(state, rows, cols);
+}
+
+void BM_ApiNumberAssignOperator(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  S21Matrix a = FilledMatrix(rows, cols);
+  for (auto _ : state) {
+    a *= 1.0000001;
+    benchmark::ClobberMemory();
+  }
+  SetElements(state, rows, cols);
+}
+
+// PRODUCTS
+
+// A * A^T for every shape, so tall and wide operands give different products
+void BM_ApiMulMatrix(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  const S21Matrix a = FilledMatrix(rows, cols), b = a.Transpose();
+  for (auto _ : state) {
+    S21Matrix c = a;
+    c.MulMatrix(b);
+    benchmark::DoNotOptimize(c);
+  }
+  state.counters["FLOPS"] =
+      benchmark::Counter(2.0 * rows * rows * cols,
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void BM_ApiMulOperator(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  const S21Matrix a = FilledMatrix(rows, cols), b = a.Transpose();
+  for (auto _ : state) {
+    S21Matrix c = a * b;
+    benchmark::DoNotOptimize(c);
+  }
+  state.counters["FLOPS"] =
+      benchmark::Counter(2.0 * rows * rows * cols,
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// a square right operand keeps the shape of the destination
+void BM_ApiMulAssignOperator(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  S21Matrix a = FilledMatrix(rows, cols);
+  S21Matrix b(cols, cols);
+  for (auto i = 0; i < cols; ++i) b.SetValue(i, i, 1);
+  for (auto _ : state) {
+    a *= b;
+    benchmark::ClobberMemory();
+  }
+  state.counters["FLOPS"] =
+      benchmark::Counter(2.0 * rows * cols * cols,
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void BM_ApiTranspose(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  const S21Matrix a = FilledMatrix(rows, cols);
+  for (auto _ : state) benchmark::DoNotOptimize(a.Transpose());
+  SetElements(state, rows, cols);
+}
+
+// SQUARE MATRICES
+
+void BM_ApiDeterminant(benchmark::State &state) {
+  S21Matrix a = FilledMatrix(state.range(0), state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(a.Determinant());
+}
+
+void BM_ApiInverseMatrix(benchmark::State &state) {
+  S21Matrix a = FilledMatrix(state.range(0), state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(a.InverseMatrix());
+}
+
+void BM_ApiCalcComplements(benchmark::State &state) {
+  S21Matrix a = FilledMatrix(state.range(0), state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(a.CalcComplements());
+}
+
+void BM_ApiMinorMatrix(benchmark::State &state) {
+  S21Matrix a = FilledMatrix(state.range(0), state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(a.MinorMatrix(1, 1));
+}
+
+// ACCESSORS AND MUTATORS
+
+// one pass over all the elements through the checked accessors
+void BM_ApiGetValue(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  const S21Matrix a = FilledMatrix(rows, cols);
+  for (auto _ : state) {
+    double sum = 0;
+    for (auto i = 0; i < rows; ++i)
+      for (auto j = 0; j < cols; ++j) sum += a.GetValue(i, j);
+    benchmark::DoNotOptimize(sum);
+  }
+  SetElements(state, rows, cols);
+}
+
+void BM_ApiIndexOperator(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  const S21Matrix a = FilledMatrix(rows, cols);
+  for (auto _ : state) {
+    double sum = 0;
+    for (auto i = 0; i < rows; ++i)
+      for (auto j = 0; j < cols; ++j) sum += a(i, j);
+    benchmark::DoNotOptimize(sum);
+  }
+  SetElements(state, rows, cols);
+}
+
+void BM_ApiSetValue(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  S21Matrix a(rows, cols);
+  for (auto _ : state) {
+    for (auto i = 0; i < rows; ++i)
+      for (auto j = 0; j < cols; ++j) a.SetValue(i, j, i + j);
+    benchmark::ClobberMemory();
+  }
+  SetElements(state, rows, cols);
+}
+
+// growing by one row and column and shrinking back, the values are kept
+void BM_ApiResize(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  S21Matrix a = FilledMatrix(rows, cols);
+  for (auto _ : state) {
+    a.SetRows(rows + 1);
+    a.SetCols(cols + 1);
+    a.SetRows(rows);
+    a.SetCols(cols);
+    benchmark::ClobberMemory();
+  }
+  SetElements(state, rows, cols);
+}
+
+}  // namespace
+
+BENCHMARK(BM_ApiDefaultConstructor);
+BENCHMARK(BM_ApiConstructor)->Apply(Shapes);
+BENCHMARK(BM_ApiCopyConstructor)->Apply(Shapes);
+BENCHMARK(BM_ApiMoveConstructor)->Apply(Shapes);
+BENCHMARK(BM_ApiCopyAssign)->Apply(Shapes);
+BENCHMARK(BM_ApiMoveAssign)->Apply(Shapes);
+
+BENCHMARK(BM_ApiEqMatrix)->Apply(Shapes);
+BENCHMARK(BM_ApiEqualOperator)->Apply(Shapes);
+BENCHMARK(BM_ApiSumMatrix)->Apply(Shapes);
+BENCHMARK(BM_ApiSubMatrix)->Apply(Shapes);
+BENCHMARK(BM_ApiMulNumber)->Apply(Shapes);
+BENCHMARK(BM_ApiAxpyMatrix)->Apply(Shapes);
+BENCHMARK(BM_ApiPlusOperator)->Apply(Shapes);
+BENCHMARK(BM_ApiMinusOperator)->Apply(Shapes);
+BENCHMARK(BM_ApiNumberOperator)->Apply(Shapes);
+BENCHMARK(BM_ApiPlusAssignOperator)->Apply(Shapes);
+BENCHMARK(BM_ApiMinusAssignOperator)->Apply(Shapes);
+BENCHMARK(BM_ApiNumberAssignOperator)->Apply(Shapes);
+
+BENCHMARK(BM_ApiMulMatrix)->Apply(Shapes)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ApiMulOperator)->Apply(Shapes)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ApiMulAssignOperator)
+    ->Apply(Shapes)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ApiTranspose)->Apply(Shapes);
+
+BENCHMARK(BM_ApiDeterminant)->Apply(Orders);
+BENCHMARK(BM_ApiInverseMatrix)->Apply(Orders)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ApiCalcComplements)
+    ->Apply(Orders)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ApiMinorMatrix)->Apply(Orders);
+
+BENCHMARK(BM_ApiGetValue)->Apply(Shapes);
+BENCHMARK(BM_ApiIndexOperator)->Apply(Shapes);
+BENCHMARK(BM_ApiSetValue)->Apply(Shapes);
+BENCHMARK(BM_ApiResize)->Apply(Shapes);
@@ -0,0 +1,57 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+#include "../s21_io.h"
+#include "../s21_out_of_core.h"
+
+namespace {
+
+S21Matrix Filled(int rows, int cols) {
+  S21Matrix result(rows, cols);
+  for (auto i = 0; i < rows; ++i)
+    for (auto j = 0; j < cols; ++j) result.SetValue(i, j, std::sin(i + j));
+  return result;
+}
+
+std::string BenchFile(const std::string &name) {
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
+// the product of two n x n files with a budget of range(1) megabytes
+void BM_MulMatrixFiles(benchmark::State &state) {
+  const int n = state.range(0);
+  const std::string a = BenchFile("s21_ooc_a.s21m"),
+                    b = BenchFile("s21_ooc_b.s21m"),
+                    c = BenchFile("s21_ooc_c.s21m");
+  s21::SaveMatrix(Filled(n, n), a);
+  s21::SaveMatrix(Filled(n, n), b);
+  s21::OutOfCoreReport report = s21::OutOfCoreReport();
+  for (auto _ : state)
+    report = s21::MulMatrixFiles(a, b, c, state.range(1) << 20);
+  state.counters["tile"] = report.tile_rows;
+  state.counters["read_MB"] = report.bytes_read >> 20;
+  state.SetItemsProcessed(state.iterations() * 2LL * n * n * n);
+  std::remove(a.c_str());
+  std::remove(b.c_str());
+  std::remove(c.c_str());
+}
+
+// the same product of resident matrices
+void BM_MulMatrixResident(benchmark::State &state) {
+  const int n = state.range(0);
+  S21Matrix a = Filled(n, n), b = Filled(n, n);
+  for (auto _ : state) benchmark::DoNotOptimize(S21Matrix(a * b));
+  state.SetItemsProcessed(state.iterations() * 2LL * n * n * n);
+}
+
+}  // namespace
+
+BENCHMARK(BM_MulMatrixFiles)
+    ->Args({2048, 8})
+    ->Args({2048, 32})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MulMatrixResident)->Arg(2048)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "../s21_matrix_oop.h"
+
+namespace {
+
+S21Matrix FilledMatrix(int n) {
+  S21Matrix result(n, n);
+  for (auto i = 0; i < n; ++i)
+    for (auto j = 0; j < n; ++j) result(i, j) = std::sin(i * 0.37 + j);
+  return result;
+}
+
+// the Frobenius norm, range(1) is 0 for the GetValue loop, 1 for Norm
+void BM_FrobeniusNorm(benchmark::State &state) {
+  const int n = state.range(0);
+  const S21Matrix a = FilledMatrix(n);
+  for (auto _ : state) {
+    if (state.range(1) == 0) {
+      double sum = 0;
+      for (auto i = 0; i < n; ++i)
+        for (auto j = 0; j < n; ++j) sum += a.GetValue(i, j) * a.GetValue(i, j);
+      benchmark::DoNotOptimize(std::sqrt(sum));
+    } else {
+      benchmark::DoNotOptimize(a.Norm());
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * sizeof(double) * n * n);
+}
+
+// the sum, the Frobenius norm and the extrema: range(1) is 0 for four
+// passes, 1 for one pass of Summarize
+void BM_Summarize(benchmark::State &state) {
+  const int n = state.range(0);
+  const S21Matrix a = FilledMatrix(n);
+  for (auto _ : state) {
+    if (state.range(1) == 0) {
+      benchmark::DoNotOptimize(a.Sum());
+      benchmark::DoNotOptimize(a.Dot(a));
+      benchmark::DoNotOptimize(a.Min());
+      benchmark::DoNotOptimize(a.Max());
+    } else {
+      benchmark::DoNotOptimize(a.Summarize());
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * sizeof(double) * n * n);
+}
+
+void BM_Reduction(benchmark::State &state) {
+  const int n = state.range(0);
+  const S21Matrix a = FilledMatrix(n);
+  for (auto _ : state) {
+    switch (state.range(1)) {
+      case 0:
+        benchmark::DoNotOptimize(a.Sum());
+        break;
+      case 1:
+        benchmark::DoNotOptimize(a.RowSums());
+        break;
+      case 2:
+        benchmark::DoNotOptimize(a.ColSums());
+        break;
+      default:
+        benchmark::DoNotOptimize(a.Norm(s21::Norm::kOne));
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * sizeof(double) * n * n);
+}
+
+}  // namespace
+
+BENCHMARK(BM_FrobeniusNorm)->ArgsProduct({{256, 2048}, {0, 1}});
+BENCHMARK(BM_Summarize)->ArgsProduct({{256, 2048}, {0, 1}});
+// range(1): 0 Sum, 1 RowSums, 2 ColSums, 3 Norm(kOne)
+BENCHMARK(BM_Reduction)->ArgsProduct({{256, 2048}, {0, 1, 2, 3}});
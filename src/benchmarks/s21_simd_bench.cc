@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "../s21_matrix_oop.h"
+#include "../s21_simd.h"
+
+namespace {
+
+// y += x over one vector with the kernels of the level given by range(1)
+void BM_SimdAdd(benchmark::State &state) {
+  const std::size_t n = state.range(0);
+  const auto &simd = s21::SimdFor(static_cast<s21::SimdLevel>(state.range(1)));
+  std::vector<double> x(n, 1.5), y(n, 2.5);
+  for (auto _ : state) {
+    simd.add(y.data(), x.data(), n);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * 3 * n * sizeof(double));
+}
+
+// the update loop before the fused kernel: two passes over memory
+void BM_MulNumberSumMatrix(benchmark::State &state) {
+  const int n = state.range(0);
+  S21Matrix x(n, n), y(n, n);
+  for (auto _ : state) {
+    S21Matrix scaled = x;
+    scaled.MulNumber(0.5);
+    y.SumMatrix(scaled);
+    benchmark::ClobberMemory();
+  }
+}
+
+void BM_AxpyMatrix(benchmark::State &state) {
+  const int n = state.range(0);
+  S21Matrix x(n, n), y(n, n);
+  for (auto _ : state) {
+    y.AxpyMatrix(0.5, x);
+    benchmark::ClobberMemory();
+  }
+}
+
+void BM_EqMatrix(benchmark::State &state) {
+  const int n = state.range(0);
+  S21Matrix x(n, n), y(n, n);
+  for (auto _ : state) benchmark::DoNotOptimize(x.EqMatrix(y));
+}
+
+void SimdLevels(benchmark::internal::Benchmark *bench) {
+  for (int n : {1024, 1 << 16, 1 << 22})
+    for (int level = 0; level <= static_cast<int>(s21::SimdLevel::kAvx512);
+         ++level)
+      bench->Args({n, level});
+}
+
+}  // namespace
+
+BENCHMARK(BM_SimdAdd)->Apply(SimdLevels);
+BENCHMARK(BM_MulNumberSumMatrix)->Arg(64)->Arg(1024);
+BENCHMARK(BM_AxpyMatrix)->Arg(64)->Arg(1024);
+BENCHMARK(BM_EqMatrix)->Arg(64)->Arg(1024);
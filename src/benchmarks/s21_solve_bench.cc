@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "../s21_cholesky.h"
+#include "../s21_lu.h"
+#include "../s21_qr.h"
+
+namespace {
+
+// a symmetric positive definite n x n matrix
+S21Matrix SpdMatrix(int n) {
+  S21Matrix result(n, n);
+  for (auto i = 0; i < n; ++i)
+    for (auto j = 0; j < n; ++j)
+      result.SetValue(i, j, i == j ? 2.0 * n : std::sin(i + j));
+  return result;
+}
+
+S21Matrix Rhs(int rows, int cols) {
+  S21Matrix result(rows, cols);
+  for (auto i = 0; i < rows; ++i)
+    for (auto j = 0; j < cols; ++j) result.SetValue(i, j, std::cos(i + j));
+  return result;
+}
+
+// the previous route: the explicit inverse times range(1) right-hand sides
+void BM_InverseThenMul(benchmark::State &state) {
+  const int n = state.range(0);
+  S21Matrix a = SpdMatrix(n), b = Rhs(n, state.range(1));
+  for (auto _ : state) {
+    S21Matrix x = a.InverseMatrix();
+    x.MulMatrix(b);
+    benchmark::DoNotOptimize(x);
+  }
+}
+
+// factor and solve in one call
+void BM_Solve(benchmark::State &state) {
+  const int n = state.range(0);
+  S21Matrix a = SpdMatrix(n), b = Rhs(n, state.range(1));
+  for (auto _ : state) benchmark::DoNotOptimize(a.Solve(b));
+}
+
+void BM_CholeskySolve(benchmark::State &state) {
+  const int n = state.range(0);
+  S21Matrix a = SpdMatrix(n), b = Rhs(n, state.range(1));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(S21CholeskyDecomposition(a).Solve(b));
+}
+
+// the solves of a kept factorization alone
+void BM_CholeskyResolve(benchmark::State &state) {
+  const int n = state.range(0);
+  S21CholeskyDecomposition cholesky(SpdMatrix(n));
+  S21Matrix b = Rhs(n, state.range(1));
+  for (auto _ : state) benchmark::DoNotOptimize(cholesky.Solve(b));
+}
+
+void BM_CholeskyFactorize(benchmark::State &state) {
+  S21Matrix a = SpdMatrix(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(S21CholeskyDecomposition(a));
+}
+
+void BM_LUFactorize(benchmark::State &state) {
+  S21Matrix a = SpdMatrix(state.range(0));
+  for (auto _ : state) benchmark::DoNotOptimize(S21LUDecomposition(a));
+}
+
+// a least squares fit of 4n rows with n unknowns
+void BM_QRLeastSquares(benchmark::State &state) {
+  const int n = state.range(0);
+  S21Matrix a = Rhs(4 * n, n), b = Rhs(4 * n, 1);
+  for (int i = 0; i < n; ++i) a.SetValue(i, i, a(i, i) + 4);
+  for (auto _ : state) benchmark::DoNotOptimize(S21QRDecomposition(a).Solve(b));
+}
+
+}  // namespace
+
+BENCHMARK(BM_InverseThenMul)
+    ->Args({100, 1})
+    ->Args({500, 1})
+    ->Args({500, 50})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Solve)
+    ->Args({100, 1})
+    ->Args({500, 1})
+    ->Args({500, 50})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CholeskySolve)
+    ->Args({100, 1})
+    ->Args({500, 1})
+    ->Args({500, 50})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CholeskyResolve)
+    ->Args({500, 1})
+    ->Args({500, 50})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CholeskyFactorize)->Arg(500)->Arg(1000)->Unit(
+    benchmark::kMillisecond);
+BENCHMARK(BM_LUFactorize)->Arg(500)->Arg(1000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_QRLeastSquares)->Arg(100)->Arg(250)->Unit(
+    benchmark::kMillisecond);
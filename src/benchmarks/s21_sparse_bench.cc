@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <vector>
+
+#include "../s21_sparse.h"
+
+namespace {
+
+// a random graph of n vertices with about degree edges per vertex
+S21SparseMatrix Graph(int n, int degree, S21SparseMatrix::Format format) {
+  std::vector<S21SparseMatrix::Triplet> edges;
+  unsigned state = 12345;
+  for (auto i = 0; i < n; ++i)
+    for (auto e = 0; e < degree; ++e) {
+      state = state * 1103515245u + 12345u;
+      edges.push_back({i, static_cast<int>(state % n), 1.0 + e});
+    }
+  return S21SparseMatrix(n, n, edges, format);
+}
+
+S21Matrix Filled(int rows, int cols) {
+  S21Matrix result(rows, cols);
+  for (auto i = 0; i < rows; ++i)
+    for (auto j = 0; j < cols; ++j) result.SetValue(i, j, std::sin(i + j));
+  return result;
+}
+
+// y = A * x on a 100k x 100k graph, its dense form would take 80 GB
+void BM_SparseMulVector(benchmark::State &state) {
+  const auto format = static_cast<S21SparseMatrix::Format>(state.range(1));
+  S21SparseMatrix graph = Graph(state.range(0), 16, format);
+  std::vector<double> x(state.range(0), 1.0);
+  for (auto _ : state) benchmark::DoNotOptimize(graph.MulVector(x));
+  state.SetItemsProcessed(state.iterations() * graph.GetNonZeros());
+}
+
+// the product of a 1% dense square matrix and a dense n x 64 block, as a
+// sparse and as a dense matrix
+void BM_SparseMulMatrix(benchmark::State &state) {
+  const int n = state.range(0);
+  S21SparseMatrix a = Graph(n, n / 100, S21SparseMatrix::Format::kCsr);
+  S21Matrix b = Filled(n, 64);
+  for (auto _ : state) benchmark::DoNotOptimize(a * b);
+}
+
+void BM_DenseMulMatrix(benchmark::State &state) {
+  const int n = state.range(0);
+  S21Matrix a = Graph(n, n / 100, S21SparseMatrix::Format::kCsr).ToDense();
+  S21Matrix b = Filled(n, 64);
+  for (auto _ : state) benchmark::DoNotOptimize(S21Matrix(a * b));
+}
+
+void BM_SparseFromDense(benchmark::State &state) {
+  const int n = state.range(0);
+  S21Matrix a = Graph(n, n / 100, S21SparseMatrix::Format::kCsr).ToDense();
+  for (auto _ : state) benchmark::DoNotOptimize(S21SparseMatrix(a));
+}
+
+void BM_SparseToFormat(benchmark::State &state) {
+  S21SparseMatrix graph =
+      Graph(state.range(0), 16, S21SparseMatrix::Format::kCsr);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(graph.ToFormat(S21SparseMatrix::Format::kCsc));
+  state.SetItemsProcessed(state.iterations() * graph.GetNonZeros());
+}
+
+void BM_SparseSumMatrix(benchmark::State &state) {
+  S21SparseMatrix a = Graph(state.range(0), 16, S21SparseMatrix::Format::kCsr);
+  S21SparseMatrix b = a.Transpose().ToFormat(S21SparseMatrix::Format::kCsr);
+  for (auto _ : state) {
+    S21SparseMatrix sum(a);
+    sum.SumMatrix(b);
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_SparseMulVector)
+    ->Args({100000, static_cast<int>(S21SparseMatrix::Format::kCsr)})
+    ->Args({100000, static_cast<int>(S21SparseMatrix::Format::kCsc)})
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SparseMulMatrix)->Arg(1000)->Arg(2000)->Unit(
+    benchmark::kMicrosecond);
+BENCHMARK(BM_DenseMulMatrix)->Arg(1000)->Arg(2000)->Unit(
+    benchmark::kMicrosecond);
+BENCHMARK(BM_SparseFromDense)->Arg(2000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SparseToFormat)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SparseSumMatrix)->Arg(100000)->Unit(benchmark::kMicrosecond);
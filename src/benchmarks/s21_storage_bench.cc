@@ -0,0 +1,73 @@
+#include <benchmark/benchmark.h>
+
+#include "../common/s21_alloc_counter.h"
+#include "../s21_matrix_oop.h"
+
+namespace {
+
+// the previous storage layout: an array of row pointers with a separate
+// allocation per row, kept here as the reference point of the comparison
+struct RowPointersMatrix {
+  RowPointersMatrix(int rows, int cols) : rows_(rows), cols_(cols) {
+    matrix_ = new double *[rows]();
+    for (int i = 0; i < rows; ++i) matrix_[i] = new double[cols]();
+  }
+  RowPointersMatrix(const RowPointersMatrix &copy)
+      : RowPointersMatrix(copy.rows_, copy.cols_) {
+    for (int i = 0; i < rows_; ++i)
+      std::memcpy(matrix_[i], copy.matrix_[i], cols_ * sizeof(double));
+  }
+  ~RowPointersMatrix() {
+    for (int i = 0; i < rows_; ++i) delete[] matrix_[i];
+    delete[] matrix_;
+  }
+  int rows_, cols_;
+  double **matrix_;
+};
+
+// records the allocations made per iteration as benchmark counters
+void ReportAllocations(benchmark::State &state, std::size_t count,
+                       std::size_t bytes) {
+  auto iterations = static_cast<double>(state.iterations());
+  state.counters["allocs"] = count / iterations;
+  state.counters["bytes"] = bytes / iterations;
+}
+
+template <class Matrix>
+void BM_Construct(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  std::size_t count = s21_alloc::AllocationCount();
+  std::size_t bytes = s21_alloc::AllocatedBytes();
+  for (auto _ : state) {
+    Matrix matrix(rows, cols);
+    benchmark::DoNotOptimize(matrix);
+  }
+  ReportAllocations(state, s21_alloc::AllocationCount() - count,
+                    s21_alloc::AllocatedBytes() - bytes);
+}
+
+template <class Matrix>
+void BM_Copy(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  Matrix source(rows, cols);
+  std::size_t count = s21_alloc::AllocationCount();
+  std::size_t bytes = s21_alloc::AllocatedBytes();
+  for (auto _ : state) {
+    Matrix copy(source);
+    benchmark::DoNotOptimize(copy);
+  }
+  ReportAllocations(state, s21_alloc::AllocationCount() - count,
+                    s21_alloc::AllocatedBytes() - bytes);
+}
+
+void StorageShapes(benchmark::internal::Benchmark *bench) {
+  bench->Args({100000, 8})->Args({1000, 1000})->Args({8, 100000})->Args(
+      {4, 4});
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_Construct, S21Matrix)->Apply(StorageShapes);
+BENCHMARK_TEMPLATE(BM_Construct, RowPointersMatrix)->Apply(StorageShapes);
+BENCHMARK_TEMPLATE(BM_Copy, S21Matrix)->Apply(StorageShapes);
+BENCHMARK_TEMPLATE(BM_Copy, RowPointersMatrix)->Apply(StorageShapes);
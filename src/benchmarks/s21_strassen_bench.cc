@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "../s21_matrix_oop.h"
+#include "../s21_strassen.h"
+
+namespace {
+
+S21Matrix FilledMatrix(int n, double phase) {
+  S21Matrix result(n, n);
+  for (auto i = 0; i < n; ++i)
+    for (auto j = 0; j < n; ++j)
+      result.SetValue(i, j, std::sin(phase + i * 0.37 + j * 1.3));
+  return result;
+}
+
+// an n x n product with the crossover range(1), 0 is the classical kernel;
+// FLOPS counts the 2n^3 operations of the classical product, so that the
+// rates compare directly, and max_rel_error is the largest difference from
+// the classical result relative to its largest element
+void BM_StrassenMulMatrix(benchmark::State &state) {
+  const int n = state.range(0);
+  const S21Matrix a = FilledMatrix(n, 0), b = FilledMatrix(n, 1);
+  const int previous = s21::GetStrassenCrossover();
+  s21::SetStrassenCrossover(0);
+  const S21Matrix expected = a * b;
+  s21::SetStrassenCrossover(state.range(1));
+  S21Matrix c;
+  for (auto _ : state) {
+    c = a;
+    c.MulMatrix(b);
+    benchmark::DoNotOptimize(c);
+  }
+  s21::SetStrassenCrossover(previous);
+  double error = 0, scale = 0;
+  for (auto i = 0; i < n; ++i)
+    for (auto j = 0; j < n; ++j) {
+      error = std::max(error, std::fabs(c(i, j) - expected(i, j)));
+      scale = std::max(scale, std::fabs(expected(i, j)));
+    }
+  state.counters["FLOPS"] = benchmark::Counter(
+      2.0 * n * n * n, benchmark::Counter::kIsIterationInvariantRate);
+  state.counters["max_rel_error"] = error / scale;
+}
+
+}  // namespace
+
+BENCHMARK(BM_StrassenMulMatrix)
+    ->ArgsProduct({{1024, 2048}, {0, 128, 256, 512, 1024}})
+    ->Args({4096, 0})
+    ->Args({4096, 512})
+    ->Args({4096, 1024})
+    ->Unit(benchmark::kMillisecond);
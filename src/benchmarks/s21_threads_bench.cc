@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include <thread>
+
+#include "../s21_matrix_oop.h"
+#include "../s21_thread_pool.h"
+
+namespace {
+
+S21Matrix FilledMatrix(int n) {
+  S21Matrix result(n, n);
+  for (auto i = 0; i < n; ++i)
+    for (auto j = 0; j < n; ++j)
+      result.SetValue(i, j, i == j ? n : (i * 3 + j) % 5 * 0.5);
+  return result;
+}
+
+// every benchmark takes the size as range(0) and the threads as range(1)
+void BM_ThreadsMulMatrix(benchmark::State &state) {
+  const int n = state.range(0);
+  s21::SetNumThreads(state.range(1));
+  const S21Matrix a = FilledMatrix(n), b = FilledMatrix(n);
+  for (auto _ : state) {
+    S21Matrix c = a;
+    c.MulMatrix(b);
+    benchmark::DoNotOptimize(c);
+  }
+  state.counters["FLOPS"] = benchmark::Counter(
+      2.0 * n * n * n, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void BM_ThreadsSumMatrix(benchmark::State &state) {
+  const int n = state.range(0);
+  s21::SetNumThreads(state.range(1));
+  S21Matrix a = FilledMatrix(n);
+  const S21Matrix b = FilledMatrix(n);
+  for (auto _ : state) {
+    a.SumMatrix(b);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * 3.0 * n * n * sizeof(double));
+}
+
+void BM_ThreadsTranspose(benchmark::State &state) {
+  const int n = state.range(0);
+  s21::SetNumThreads(state.range(1));
+  S21Matrix a = FilledMatrix(n);
+  for (auto _ : state) benchmark::DoNotOptimize(a.Transpose());
+}
+
+void BM_ThreadsInverseMatrix(benchmark::State &state) {
+  const int n = state.range(0);
+  s21::SetNumThreads(state.range(1));
+  S21Matrix a = FilledMatrix(n);
+  for (auto _ : state) benchmark::DoNotOptimize(a.InverseMatrix());
+}
+
+// from one thread to all hardware threads, doubling
+template <int kSize>
+void ThreadCounts(benchmark::internal::Benchmark *bench) {
+  const int hardware = std::max(1u, std::thread::hardware_concurrency());
+  for (int threads = 1; threads < hardware; threads *= 2)
+    bench->Args({kSize, threads});
+  bench->Args({kSize, hardware});
+}
+
+}  // namespace
+
+BENCHMARK(BM_ThreadsMulMatrix)
+    ->Apply(ThreadCounts<1024>)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ThreadsSumMatrix)->Apply(ThreadCounts<4096>)->UseRealTime();
+BENCHMARK(BM_ThreadsTranspose)->Apply(ThreadCounts<4096>)->UseRealTime();
+BENCHMARK(BM_ThreadsInverseMatrix)
+    ->Apply(ThreadCounts<1000>)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <new>
+
+#include "../s21_matrix_oop.h"
+#include "../s21_transpose.h"
+
+namespace {
+
+// a cache-line aligned buffer of ones, like the storage of S21Matrix
+class AlignedBuffer {
+ public:
+  explicit AlignedBuffer(std::size_t size)
+      : data_(static_cast<double *>(
+            ::operator new(size * sizeof(double), std::align_val_t(64)))) {
+    std::fill(data_, data_ + size, 1.0);
+  }
+  AlignedBuffer(const AlignedBuffer &) = delete;
+  AlignedBuffer &operator=(const AlignedBuffer &) = delete;
+  ~AlignedBuffer() { ::operator delete(data_, std::align_val_t(64)); }
+  double *data() const noexcept { return data_; }
+
+ private:
+  double *data_;
+};
+
+// bytes read and written by one transposition, reported as bandwidth
+void SetTraffic(benchmark::State &state, int rows, int cols) {
+  state.SetBytesProcessed(state.iterations() * 2 *
+                          static_cast<int64_t>(rows) * cols * sizeof(double));
+}
+
+// the previous element-by-element loop, kept as the baseline
+void BM_TransposeNaive(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  const std::size_t size = static_cast<std::size_t>(rows) * cols;
+  AlignedBuffer a(size), b(size);
+  for (auto _ : state) {
+    for (auto j = 0; j < cols; ++j)
+      for (auto i = 0; i < rows; ++i)
+        b.data()[static_cast<std::size_t>(j) * rows + i] =
+            a.data()[static_cast<std::size_t>(i) * cols + j];
+    benchmark::DoNotOptimize(b.data());
+  }
+  SetTraffic(state, rows, cols);
+}
+
+void BM_TransposeTiled(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  const std::size_t size = static_cast<std::size_t>(rows) * cols;
+  AlignedBuffer a(size), b(size);
+  for (auto _ : state) {
+    s21::Transpose(rows, cols, a.data(), cols, b.data(), rows);
+    benchmark::DoNotOptimize(b.data());
+  }
+  SetTraffic(state, rows, cols);
+}
+
+// the member function, including the allocation of the result
+void BM_MatrixTranspose(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  S21Matrix matrix(rows, cols);
+  for (auto _ : state) benchmark::DoNotOptimize(matrix.Transpose());
+  SetTraffic(state, rows, cols);
+}
+
+void BM_TransposeSquareInPlace(benchmark::State &state) {
+  const int n = state.range(0);
+  AlignedBuffer a(static_cast<std::size_t>(n) * n);
+  for (auto _ : state) {
+    s21::TransposeSquare(n, a.data(), n);
+    benchmark::DoNotOptimize(a.data());
+  }
+  SetTraffic(state, n, n);
+}
+
+void BM_TransposeCycles(benchmark::State &state) {
+  const int rows = state.range(0), cols = state.range(1);
+  AlignedBuffer a(static_cast<std::size_t>(rows) * cols);
+  for (auto _ : state) {
+    s21::TransposeCycles(rows, cols, a.data());
+    benchmark::DoNotOptimize(a.data());
+  }
+  SetTraffic(state, rows, cols);
+}
+
+void Shapes(benchmark::internal::Benchmark *bench) {
+  bench->Args({64, 64})->Args({512, 512})->Args({4096, 4096});
+  bench->Args({4096, 1024})->Args({8192, 8192});
+}
+
+}  // namespace
+
+BENCHMARK(BM_TransposeNaive)->Apply(Shapes)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TransposeTiled)->Apply(Shapes)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_MatrixTranspose)->Apply(Shapes)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TransposeSquareInPlace)
+    ->Arg(64)
+    ->Arg(512)
+    ->Arg(4096)
+    ->Arg(8192)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TransposeCycles)
+    ->Args({24, 31})
+    ->Args({500, 300})
+    ->Args({4096, 1024})
+    ->Unit(benchmark::kMicrosecond);
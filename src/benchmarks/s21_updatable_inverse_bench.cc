@@ -0,0 +1,61 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "../s21_lu.h"
+#include "../s21_updatable_inverse.h"
+
+namespace {
+
+S21Matrix DominantMatrix(int n) {
+  S21Matrix result(n, n);
+  for (auto i = 0; i < n; ++i)
+    for (auto j = 0; j < n; ++j)
+      result(i, j) = i == j ? 2.0 * n : std::sin(i * 7.0 + j);
+  return result;
+}
+
+// the row i of the matrix with a perturbation that alternates in sign
+S21Matrix ChangedRow(const S21Matrix &matrix, int i, int iteration) {
+  const int n = matrix.GetCols();
+  S21Matrix row(1, n);
+  for (auto j = 0; j < n; ++j)
+    row(0, j) = matrix(i, j) + (iteration % 2 ? -1 : 1) * std::cos(j + i);
+  return row;
+}
+
+// a changed row followed by the determinant and the inverse: the Sherman-
+// Morrison update of the kept inverse in O(n^2) ...
+void BM_UpdatableSetRow(benchmark::State &state) {
+  const int n = state.range(0);
+  S21UpdatableInverse updatable(DominantMatrix(n));
+  int iteration = 0;
+  for (auto _ : state) {
+    const int i = iteration % n;
+    updatable.SetRow(i, ChangedRow(updatable.GetMatrix(), i, iteration++));
+    benchmark::DoNotOptimize(updatable.Determinant());
+    benchmark::DoNotOptimize(updatable.InverseMatrix().Data());
+  }
+}
+
+// ... and a new LU factorization in O(n^3)
+void BM_RefactorSetRow(benchmark::State &state) {
+  const int n = state.range(0);
+  S21Matrix matrix = DominantMatrix(n);
+  int iteration = 0;
+  for (auto _ : state) {
+    const int i = iteration % n;
+    const S21Matrix row = ChangedRow(matrix, i, iteration++);
+    for (auto j = 0; j < n; ++j) matrix(i, j) = row(0, j);
+    const S21LUDecomposition lu(matrix);
+    benchmark::DoNotOptimize(lu.Determinant());
+    benchmark::DoNotOptimize(lu.InverseMatrix());
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_UpdatableSetRow)->Arg(100)->Arg(500)->Arg(1000)->Unit(
+    benchmark::kMillisecond);
+BENCHMARK(BM_RefactorSetRow)->Arg(100)->Arg(500)->Arg(1000)->Unit(
+    benchmark::kMillisecond);
@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "../s21_matrix_oop.h"
+
+namespace {
+
+S21Matrix Filled(int rows, int cols) {
+  S21Matrix result(rows, cols);
+  for (auto i = 0; i < rows; ++i)
+    for (auto j = 0; j < cols; ++j) result.SetValue(i, j, std::sin(i + j));
+  return result;
+}
+
+// bytes read and written by the sum of two n x n blocks
+void SetTraffic(benchmark::State &state, int n) {
+  state.SetBytesProcessed(state.iterations() * 3 * static_cast<int64_t>(n) *
+                          n * sizeof(double));
+}
+
+// adding an n x n block of a 2n x 2n matrix by copying it out and back
+void BM_BlockSumCopy(benchmark::State &state) {
+  const int n = state.range(0);
+  S21Matrix matrix = Filled(2 * n, 2 * n), other = Filled(n, n);
+  for (auto _ : state) {
+    S21Matrix block(n, n);
+    for (auto i = 0; i < n; ++i)
+      for (auto j = 0; j < n; ++j)
+        block.SetValue(i, j, matrix.GetValue(n / 2 + i, n / 2 + j));
+    block.SumMatrix(other);
+    for (auto i = 0; i < n; ++i)
+      for (auto j = 0; j < n; ++j)
+        matrix.SetValue(n / 2 + i, n / 2 + j, block.GetValue(i, j));
+    benchmark::ClobberMemory();
+  }
+  SetTraffic(state, n);
+}
+
+// the same sum in place through a view of the block
+void BM_BlockSumView(benchmark::State &state) {
+  const int n = state.range(0);
+  S21Matrix matrix = Filled(2 * n, 2 * n), other = Filled(n, n);
+  for (auto _ : state) {
+    matrix.Block(n / 2, n / 2, n, n).SumMatrix(other);
+    benchmark::ClobberMemory();
+  }
+  SetTraffic(state, n);
+}
+
+// the sum of a transposed view, whose rows are gathered from the columns
+void BM_TransposedSumView(benchmark::State &state) {
+  const int n = state.range(0);
+  S21Matrix matrix = Filled(n, n), other = Filled(n, n);
+  for (auto _ : state) {
+    matrix.SumMatrix(other.View().Transposed());
+    benchmark::ClobberMemory();
+  }
+  SetTraffic(state, n);
+}
+
+// copying every second column out of an n x n matrix
+void BM_StridedColumnsCopy(benchmark::State &state) {
+  const int n = state.range(0);
+  S21Matrix matrix = Filled(n, n);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(S21Matrix(matrix.View().Strided(1, 2)));
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(n) * n *
+                          sizeof(double));
+}
+
+}  // namespace
+
+BENCHMARK(BM_BlockSumCopy)->Arg(64)->Arg(512);
+BENCHMARK(BM_BlockSumView)->Arg(64)->Arg(512);
+BENCHMARK(BM_TransposedSumView)->Arg(64)->Arg(512);
+BENCHMARK(BM_StridedColumnsCopy)->Arg(64)->Arg(512);
@@ -0,0 +1,66 @@
+#include "s21_alloc_counter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<std::size_t> alloc_count{0};
+std::atomic<std::size_t> alloc_bytes{0};
+
+void *CountedAlloc(std::size_t size, std::size_t align) {
+  alloc_count.fetch_add(1, std::memory_order_relaxed);
+  alloc_bytes.fetch_add(size, std::memory_order_relaxed);
+  if (size == 0) size = 1;
+  void *ptr = nullptr;
+  if (align <= alignof(std::max_align_t)) {
+    ptr = std::malloc(size);
+  } else {
+    // aligned_alloc requires the size to be a multiple of the alignment
+    ptr = std::aligned_alloc(align, (size + align - 1) / align * align);
+  }
+  if (!ptr) throw std::bad_alloc();
+  return ptr;
+}
+
+}  // namespace
+
+namespace s21_alloc {
+
+std::size_t AllocationCount() noexcept {
+  return alloc_count.load(std::memory_order_relaxed);
+}
+
+std::size_t AllocatedBytes() noexcept {
+  return alloc_bytes.load(std::memory_order_relaxed);
+}
+
+}  // namespace s21_alloc
+
+void *operator new(std::size_t size) {
+  return CountedAlloc(size, alignof(std::max_align_t));
+}
+void *operator new[](std::size_t size) {
+  return CountedAlloc(size, alignof(std::max_align_t));
+}
+void *operator new(std::size_t size, std::align_val_t align) {
+  return CountedAlloc(size, static_cast<std::size_t>(align));
+}
+void *operator new[](std::size_t size, std::align_val_t align) {
+  return CountedAlloc(size, static_cast<std::size_t>(align));
+}
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+void operator delete(void *ptr, std::size_t, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+void operator delete[](void *ptr, std::size_t, std::align_val_t) noexcept {
+  std::free(ptr);
+}
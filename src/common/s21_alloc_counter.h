@@ -0,0 +1,15 @@
+#ifndef SRC_COMMON_S21_ALLOC_COUNTER_H_
+#define SRC_COMMON_S21_ALLOC_COUNTER_H_
+
+#include <cstddef>
+
+// counters of the replaced global operator new, linked into the test and the
+// benchmark binaries
+namespace s21_alloc {
+
+std::size_t AllocationCount() noexcept;
+std::size_t AllocatedBytes() noexcept;
+
+}  // namespace s21_alloc
+
+#endif  // SRC_COMMON_S21_ALLOC_COUNTER_H_
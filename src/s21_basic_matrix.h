@@ -0,0 +1,445 @@
+#ifndef SRC_S21_BASIC_MATRIX_H_
+#define SRC_S21_BASIC_MATRIX_H_
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+#include "s21_runs.h"
+#include "s21_stats.h"
+#include "s21_thread_pool.h"
+
+// S21BasicMatrix<T>: a matrix of elements of type T (float, double,
+// std::complex<double>, ...). The storage, the element access, the
+// element-wise operations, the maps and the errors are those of
+// S21MatrixBase, shared with S21Matrix, the explicit specialization for
+// double; this template adds the generic kernels: the blocked product, the
+// transpose and the Gauss-Jordan elimination behind the determinant and the
+// inverse. The views, Solve, the decompositions, the sparse and batched
+// matrices and the files stay with S21Matrix. Single precision halves the
+// memory and the bandwidth of every operation and fits twice as many
+// elements into a vector register; the loops are written for the compiler
+// to vectorize them for any T. Products may accumulate their sums in
+// s21::WideType<T> (double for float), determinants and inverses are always
+// eliminated in it. The explicit conversions between element types are the
+// mixed-precision helpers: S21BasicMatrix<float> single(matrix) rounds a
+// matrix of doubles once, S21Matrix(single) widens it back.
+
+namespace s21 {
+
+// the type in which the sums of products of T are accumulated for accuracy
+template <class T>
+struct WideType {
+  using type = T;
+};
+template <>
+struct WideType<float> {
+  using type = double;
+};
+template <>
+struct WideType<std::complex<float>> {
+  using type = std::complex<double>;
+};
+
+template <class T>
+struct IsComplex : std::false_type {};
+template <class T>
+struct IsComplex<std::complex<T>> : std::true_type {};
+
+// the precision of the sums of S21BasicMatrix::MulMatrix: the element type,
+// or its WideType with the result rounded once at the end
+enum class Accumulation { kElement, kWide };
+
+// rows per task of the generic product, the columns and the depth of its
+// blocks and the rows updated together with one row of B
+constexpr int kBasicGemmRows = 16;
+constexpr int kBasicGemmCols = 256;
+constexpr int kBasicGemmDepth = 128;
+constexpr int kBasicGemmTile = 4;
+
+// out[i][j0:j1] += A[i][p0:p1] * B[p0:p1][j0:j1] for the rows of A, every
+// row of B is loaded once for kBasicGemmTile rows of the result
+template <class Acc, class T>
+void BasicGemmBlock(int rows, int j0, int j1, int p0, int p1, const T *a,
+                    std::ptrdiff_t lda, const T *b, std::ptrdiff_t ldb,
+                    Acc *out, std::ptrdiff_t ldo) {
+  int i = 0;
+  for (; i + kBasicGemmTile <= rows; i += kBasicGemmTile) {
+    Acc *o0 = out + i * ldo, *o1 = o0 + ldo, *o2 = o1 + ldo, *o3 = o2 + ldo;
+    const T *a0 = a + i * lda, *a1 = a0 + lda, *a2 = a1 + lda, *a3 = a2 + lda;
+    for (auto p = p0; p < p1; ++p) {
+      const Acc f0 = static_cast<Acc>(a0[p]), f1 = static_cast<Acc>(a1[p]),
+                f2 = static_cast<Acc>(a2[p]), f3 = static_cast<Acc>(a3[p]);
+      const T *b_row = b + p * ldb;
+      for (auto j = j0; j < j1; ++j) {
+        const Acc x = static_cast<Acc>(b_row[j]);
+        o0[j] += f0 * x;
+        o1[j] += f1 * x;
+        o2[j] += f2 * x;
+        o3[j] += f3 * x;
+      }
+    }
+  }
+  for (; i < rows; ++i) {
+    Acc *o = out + i * ldo;
+    const T *a_row = a + i * lda;
+    for (auto p = p0; p < p1; ++p) {
+      const Acc factor = static_cast<Acc>(a_row[p]);
+      const T *b_row = b + p * ldb;
+      for (auto j = j0; j < j1; ++j)
+        o[j] += factor * static_cast<Acc>(b_row[j]);
+    }
+  }
+}
+
+// C = A * B for a C filled with zeros, A is m x k and B is k x n with row
+// strides; the sums of a block of rows are kept in Acc and rounded to T once
+// when Acc is wider than T
+template <class Acc, class T>
+void BasicGemm(int m, int n, int k, const T *a, std::ptrdiff_t lda,
+               const T *b, std::ptrdiff_t ldb, T *c, std::ptrdiff_t ldc) {
+  constexpr bool kInPlace = std::is_same_v<Acc, T>;
+  auto row_range = [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    std::vector<Acc> buffer(kInPlace ? 0 : std::size_t(kBasicGemmRows) * n);
+    for (auto i0 = begin; i0 < end; i0 += kBasicGemmRows) {
+      const int rows = static_cast<int>(
+          std::min<std::ptrdiff_t>(kBasicGemmRows, end - i0));
+      Acc *acc;
+      std::ptrdiff_t ld;
+      if constexpr (kInPlace) {
+        acc = c + i0 * ldc;
+        ld = ldc;
+      } else {
+        acc = buffer.data();
+        ld = n;
+        std::fill(buffer.begin(), buffer.end(), Acc());
+      }
+      for (auto j0 = 0; j0 < n; j0 += kBasicGemmCols)
+        for (auto p0 = 0; p0 < k; p0 += kBasicGemmDepth)
+          BasicGemmBlock(rows, j0, std::min(n, j0 + kBasicGemmCols), p0,
+                         std::min(k, p0 + kBasicGemmDepth), a + i0 * lda, lda,
+                         b, ldb, acc, ld);
+      if constexpr (!kInPlace)
+        for (auto i = 0; i < rows; ++i)
+          for (auto j = 0; j < n; ++j)
+            c[(i0 + i) * ldc + j] = static_cast<T>(acc[i * ld + j]);
+    }
+  };
+  ParallelFor(m, kBasicGemmRows, row_range);
+}
+
+// Gauss-Jordan elimination with partial pivoting of the n x n row-major a,
+// applied to inverse as well when it is not null (it holds the identity);
+// returns the determinant, 0 with a and inverse left partly eliminated when
+// a pivot is exactly zero, as in S21LUDecomposition: a small pivot of a
+// badly scaled matrix is not a sign of singularity
+template <class W>
+W Eliminate(int n, W *a, W *inverse) {
+  using std::abs;
+  W det = 1;
+  auto at = [n](W *m, int row, int col) {
+    return m + static_cast<std::ptrdiff_t>(row) * n + col;
+  };
+  for (auto k = 0; k < n; ++k) {
+    int pivot = k;
+    for (auto i = k + 1; i < n; ++i)
+      if (abs(*at(a, i, k)) > abs(*at(a, pivot, k))) pivot = i;
+    if (*at(a, pivot, k) == W()) return 0;
+    if (pivot != k) {
+      std::swap_ranges(at(a, k, 0), at(a, k, n), at(a, pivot, 0));
+      if (inverse)
+        std::swap_ranges(at(inverse, k, 0), at(inverse, k, n),
+                         at(inverse, pivot, 0));
+      det = -det;
+    }
+    const W diagonal = *at(a, k, k);
+    det *= diagonal;
+    // the determinant needs only the rows below, the inverse all of them
+    const W scale_k = W(1) / diagonal;
+    for (auto j = 0; j < n; ++j) {
+      *at(a, k, j) *= scale_k;
+      if (inverse) *at(inverse, k, j) *= scale_k;
+    }
+    for (auto i = inverse ? 0 : k + 1; i < n; ++i) {
+      const W factor = *at(a, i, k);
+      if (i == k || factor == W()) continue;
+      W *row = at(a, i, 0);
+      const W *pivot_row = at(a, k, 0);
+      for (auto j = k; j < n; ++j) row[j] -= factor * pivot_row[j];
+      if (inverse) {
+        W *inverse_row = at(inverse, i, 0);
+        const W *inverse_pivot = at(inverse, k, 0);
+        for (auto j = 0; j < n; ++j)
+          inverse_row[j] -= factor * inverse_pivot[j];
+      }
+    }
+  }
+  return det;
+}
+
+}  // namespace s21
+
+template <class T>
+class S21BasicMatrix : public S21MatrixBase<T, S21BasicMatrix<T>> {
+  using Base = S21MatrixBase<T, S21BasicMatrix<T>>;
+  // the conversions between element types copy the rows directly
+  template <class U>
+  friend class S21BasicMatrix;
+
+ public:
+  using wide_type = typename s21::WideType<T>::type;
+
+  S21BasicMatrix() : S21BasicMatrix(3, 3) {}  // default constructor
+  S21BasicMatrix(int rows, int cols)          // parameterized constructor
+      : S21BasicMatrix(rows, cols, std::pmr::get_default_resource()) {}
+  // the same with the buffer taken from the memory resource
+  S21BasicMatrix(int rows, int cols, std::pmr::memory_resource *resource)
+      : Base(rows, cols, resource) {}
+  S21BasicMatrix(const S21BasicMatrix &copy,
+                 std::pmr::memory_resource *resource)
+      : Base(copy, resource) {}
+  // converting the elements of a matrix of another type, complex elements
+  // convert only to complex ones
+  template <class U>
+  explicit S21BasicMatrix(const S21BasicMatrix<U> &other);
+
+  bool operator==(const S21BasicMatrix &other) const noexcept {
+    return EqMatrix(other);
+  }
+  S21BasicMatrix &operator+=(const S21BasicMatrix &other) {
+    SumMatrix(other);
+    return *this;
+  }
+  S21BasicMatrix &operator-=(const S21BasicMatrix &other) {
+    SubMatrix(other);
+    return *this;
+  }
+  S21BasicMatrix &operator*=(const S21BasicMatrix &other) {
+    MulMatrix(other);
+    return *this;
+  }
+  S21BasicMatrix &operator*=(const T num) noexcept {
+    MulNumber(num);
+    return *this;
+  }
+
+  // the free operators are friends defined here, so that they are found
+  // only for the matrices of this template and never compete with the
+  // expression templates of S21Matrix
+  friend S21BasicMatrix operator+(S21BasicMatrix lhs,
+                                  const S21BasicMatrix &rhs) {
+    lhs.SumMatrix(rhs);
+    return lhs;
+  }
+  friend S21BasicMatrix operator-(S21BasicMatrix lhs,
+                                  const S21BasicMatrix &rhs) {
+    lhs.SubMatrix(rhs);
+    return lhs;
+  }
+  friend S21BasicMatrix operator*(S21BasicMatrix lhs,
+                                  const S21BasicMatrix &rhs) {
+    lhs.MulMatrix(rhs);
+    return lhs;
+  }
+  friend S21BasicMatrix operator*(S21BasicMatrix lhs, const T num) noexcept {
+    lhs.MulNumber(num);
+    return lhs;
+  }
+  friend S21BasicMatrix operator*(const T num, S21BasicMatrix rhs) noexcept {
+    rhs.MulNumber(num);
+    return rhs;
+  }
+
+  // public methods, the element-wise ones come from S21MatrixBase
+  using Base::EqMatrix;
+  using Base::MinorMatrix;
+  using Base::MulNumber;
+  using Base::SubMatrix;
+  using Base::SumMatrix;
+  void MulMatrix(const S21BasicMatrix &other,
+                 s21::Accumulation accumulation = s21::Accumulation::kElement);
+  S21BasicMatrix Transpose() const;
+  S21BasicMatrix CalcComplements() const;
+  // in the wide type, the product of the pivots of a float matrix easily
+  // leaves the range of float
+  wide_type Determinant() const;
+  S21BasicMatrix InverseMatrix() const;
+
+  // the transpose with an execution, as in S21Matrix
+  S21BasicMatrix Transpose(s21::Execution execution) const {
+    s21::ExecutionScope scope(execution);
+    return Transpose();
+  }
+  template <class Policy, class = s21::EnableIfPolicy<Policy>>
+  S21BasicMatrix Transpose(Policy &&) const {
+    return Transpose(s21::kExecutionOf<Policy>);
+  }
+
+ private:
+  // the order of the square blocks of the transpose
+  static constexpr int kTransposeBlock = 32;
+
+  using Base::cols_;
+  using Base::matrix_;
+  using Base::resource_;
+  using Base::rows_;
+  using Base::stride_;
+  using Base::CheckSquare;
+  using Base::Elements;
+  using Base::RowPtr;
+
+  // the elements converted to the wide type, densely packed
+  std::vector<wide_type> WideElements() const;
+};
+
+// CONVERSIONS OF S21Matrix
+
+template <class U>
+S21Matrix::S21BasicMatrix(const S21BasicMatrix<U> &other)
+    : S21Matrix(other.rows_, other.cols_) {
+  static_assert(!s21::IsComplex<U>::value,
+                "Complex elements do not convert to double");
+  for (auto i = 0; i < rows_; ++i)
+    std::copy(other.RowPtr(i), other.RowPtr(i) + cols_, RowPtr(i));
+}
+
+// AUXILIARY METHODS
+
+template <class T>
+std::vector<typename S21BasicMatrix<T>::wide_type>
+S21BasicMatrix<T>::WideElements() const {
+  std::vector<wide_type> wide(static_cast<std::size_t>(Elements()));
+  for (auto i = 0; i < rows_; ++i)
+    std::copy(RowPtr(i), RowPtr(i) + cols_, wide.begin() + i * cols_);
+  return wide;
+}
+
+// CONSTRUCTORS
+
+template <class T>
+template <class U>
+S21BasicMatrix<T>::S21BasicMatrix(const S21BasicMatrix<U> &other)
+    : S21BasicMatrix(other.rows_, other.cols_) {
+  static_assert(s21::IsComplex<T>::value || !s21::IsComplex<U>::value,
+                "Complex elements convert only to complex ones");
+  s21::ForEachRow(rows_, cols_, [&](int i) {
+    const U *from = other.RowPtr(i);
+    T *to = RowPtr(i);
+    for (auto j = 0; j < cols_; ++j) to[j] = static_cast<T>(from[j]);
+  });
+}
+
+// PUBLIC METHODS
+
+// the products of two floats are exact in double, so their wide sums are
+// computed by the GEMM kernel of S21Matrix on converted copies, which costs
+// O(n^2) conversions next to the O(n^3) product
+template <class T>
+void S21BasicMatrix<T>::MulMatrix(const S21BasicMatrix &other,
+                                  s21::Accumulation accumulation) {
+  S21_STATS_SCOPE(kMulMatrix, Elements());
+  if (cols_ != other.rows_)
+    throw std::invalid_argument(
+        "The number of columns of the matrix1 must be "
+        "equal to the number of rows of the matrix2");
+  S21BasicMatrix result(rows_, other.cols_, resource_);
+  if constexpr (std::is_same_v<wide_type, double>) {
+    if (accumulation == s21::Accumulation::kWide) {
+      const S21Matrix product = S21Matrix(*this) * S21Matrix(other);
+      s21::ForEachRow(result.rows_, result.cols_, [&](int i) {
+        std::copy(product.RowPtr(i), product.RowPtr(i) + result.cols_,
+                  result.RowPtr(i));
+      });
+      *this = std::move(result);
+      return;
+    }
+  }
+  if (accumulation == s21::Accumulation::kWide)
+    s21::BasicGemm<wide_type>(rows_, other.cols_, cols_, matrix_, stride_,
+                              other.matrix_, other.stride_, result.matrix_,
+                              result.stride_);
+  else
+    s21::BasicGemm<T>(rows_, other.cols_, cols_, matrix_, stride_,
+                      other.matrix_, other.stride_, result.matrix_,
+                      result.stride_);
+  *this = std::move(result);
+}
+
+// by square blocks, every column of a block of this matrix is written as a
+// contiguous piece of a row of the result
+template <class T>
+S21BasicMatrix<T> S21BasicMatrix<T>::Transpose() const {
+  S21_STATS_SCOPE(kTranspose, Elements());
+  S21BasicMatrix result(cols_, rows_, resource_);
+  for (auto i0 = 0; i0 < rows_; i0 += kTransposeBlock)
+    for (auto j0 = 0; j0 < cols_; j0 += kTransposeBlock) {
+      const int i1 = std::min(rows_, i0 + kTransposeBlock);
+      const int j1 = std::min(cols_, j0 + kTransposeBlock);
+      for (auto j = j0; j < j1; ++j) {
+        T *out = result.RowPtr(j);
+        for (auto i = i0; i < i1; ++i) out[i] = RowPtr(i)[j];
+      }
+    }
+  return result;
+}
+
+// the transposed inverse times the determinant for invertible matrices,
+// the signed minors otherwise; [1] for the order 1
+template <class T>
+S21BasicMatrix<T> S21BasicMatrix<T>::CalcComplements() const {
+  S21_STATS_SCOPE(kCalcComplements, Elements());
+  CheckSquare();
+  S21BasicMatrix calc_mx(rows_, cols_, resource_);
+  const int n = rows_;
+  if (n == 1) {
+    calc_mx.RowPtr(0)[0] = T(1);
+    return calc_mx;
+  }
+  std::vector<wide_type> a = WideElements(), inverse(a.size());
+  for (auto i = 0; i < n; ++i) inverse[i * n + i] = wide_type(1);
+  const wide_type det = s21::Eliminate(n, a.data(), inverse.data());
+  if (det != wide_type()) {
+    for (auto i = 0; i < n; ++i)
+      for (auto j = 0; j < n; ++j)
+        calc_mx.RowPtr(i)[j] = static_cast<T>(inverse[j * n + i] * det);
+    return calc_mx;
+  }
+  for (auto row = 0; row < n; ++row)
+    for (auto col = 0; col < n; ++col)
+      calc_mx.RowPtr(row)[col] = static_cast<T>(
+          ((row + col) % 2 ? wide_type(-1) : wide_type(1)) *
+          MinorMatrix(row, col).Determinant());
+  return calc_mx;
+}
+
+template <class T>
+typename S21BasicMatrix<T>::wide_type S21BasicMatrix<T>::Determinant() const {
+  S21_STATS_SCOPE(kDeterminant, Elements());
+  CheckSquare();
+  std::vector<wide_type> a = WideElements();
+  return s21::Eliminate<wide_type>(rows_, a.data(), nullptr);
+}
+
+template <class T>
+S21BasicMatrix<T> S21BasicMatrix<T>::InverseMatrix() const {
+  S21_STATS_SCOPE(kInverseMatrix, Elements());
+  CheckSquare();
+  const int n = rows_;
+  std::vector<wide_type> a = WideElements(), inverse(a.size());
+  for (auto i = 0; i < n; ++i) inverse[i * n + i] = wide_type(1);
+  if (s21::Eliminate(n, a.data(), inverse.data()) == wide_type())
+    throw std::invalid_argument("The determinant of the matrix is 0");
+  S21BasicMatrix inverse_mx(n, n, resource_);
+  for (auto i = 0; i < n; ++i)
+    for (auto j = 0; j < n; ++j)
+      inverse_mx.RowPtr(i)[j] = static_cast<T>(inverse[i * n + j]);
+  return inverse_mx;
+}
+
+#endif  // SRC_S21_BASIC_MATRIX_H_
@@ -0,0 +1,556 @@
+#include "s21_batch.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "s21_simd.h"
+#include "s21_thread_pool.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define S21_SIMD_X86 1
+#endif
+
+namespace {
+
+constexpr int kLanes = S21MatrixBatch::kLanes;
+
+// one element of all the matrices of a pack: a GCC vector that the compiler
+// maps to the registers of the instruction set of the function using it
+using Lanes = double __attribute__((vector_size(kLanes * sizeof(double))));
+// the result of comparing two Lanes, all bits set where the lane is true
+using LaneMask =
+    std::int64_t __attribute__((vector_size(kLanes * sizeof(double))));
+
+// multiply-adds per task of the parallel loops over the packs
+constexpr std::ptrdiff_t kParallelWork = 1 << 16;
+// elements per task of the element-wise operations
+constexpr std::ptrdiff_t kParallelGrain = 1 << 15;
+
+// KERNELS
+
+// the generic kernels over whole packs, they are inlined into the callers
+// below and compiled for the instruction set of each caller
+
+// the register tile of the product: kMulRows rows by kMulCols columns of c
+constexpr int kMulRows = 2, kMulCols = 4;
+
+// a kRows x kCols tile of c = a * b for one pack, a points at the first
+// row of the tile in the m x k pack, b and c at its first column
+template <int kRows, int kCols>
+__attribute__((always_inline)) inline void MulTile(int k, int n,
+                                                   const Lanes *a,
+                                                   const Lanes *b, Lanes *c) {
+  Lanes tile[kRows][kCols] = {};
+  for (auto q = 0; q < k; ++q)
+    for (auto r = 0; r < kRows; ++r) {
+      const Lanes factor = a[r * k + q];
+      for (auto j = 0; j < kCols; ++j) tile[r][j] += factor * b[q * n + j];
+    }
+  for (auto r = 0; r < kRows; ++r)
+    for (auto j = 0; j < kCols; ++j) c[r * n + j] = tile[r][j];
+}
+
+template <int kRows>
+__attribute__((always_inline)) inline void MulRows(int k, int n,
+                                                   const Lanes *a,
+                                                   const Lanes *b, Lanes *c) {
+  auto j = 0;
+  for (; j + kMulCols <= n; j += kMulCols)
+    MulTile<kRows, kMulCols>(k, n, a, b + j, c + j);
+  for (; j < n; ++j) MulTile<kRows, 1>(k, n, a, b + j, c + j);
+}
+
+// c = a * b for the m x k packs of a and the k x n packs of b
+__attribute__((always_inline)) inline void MulPacks(std::ptrdiff_t packs,
+                                                    int m, int k, int n,
+                                                    const double *a,
+                                                    const double *b,
+                                                    double *c) {
+  const std::ptrdiff_t a_size = m * k, b_size = k * n, c_size = m * n;
+  for (std::ptrdiff_t p = 0; p < packs; ++p) {
+    const auto *pack_a = reinterpret_cast<const Lanes *>(a) + p * a_size;
+    const auto *pack_b = reinterpret_cast<const Lanes *>(b) + p * b_size;
+    auto *pack_c = reinterpret_cast<Lanes *>(c) + p * c_size;
+    auto i = 0;
+    for (; i + kMulRows <= m; i += kMulRows)
+      MulRows<kMulRows>(k, n, pack_a + i * k, pack_b, pack_c + i * n);
+    for (; i < m; ++i) MulRows<1>(k, n, pack_a + i * k, pack_b, pack_c + i * n);
+  }
+}
+
+// Gaussian elimination with partial pivoting of the n x n packs of a in
+// place; with kInverse the row operations are also applied to x, which is
+// set to the identity first and ends as the inverse. det receives kLanes
+// determinants per pack, 0 for the matrices with a zero pivot, like in
+// S21LUDecomposition.
+template <bool kInverse>
+__attribute__((always_inline)) inline void EliminatePacks(std::ptrdiff_t packs,
+                                                          int n, double *a,
+                                                          double *x,
+                                                          double *det) {
+  const std::ptrdiff_t size = static_cast<std::ptrdiff_t>(n) * n;
+  const Lanes one = Lanes{} + 1.0;
+  for (std::ptrdiff_t p = 0; p < packs; ++p) {
+    Lanes *pack_a = reinterpret_cast<Lanes *>(a) + p * size;
+    Lanes *pack_x = reinterpret_cast<Lanes *>(kInverse ? x : a) + p * size;
+    if (kInverse) {
+      for (std::ptrdiff_t e = 0; e < size; ++e) pack_x[e] = Lanes{};
+      for (auto i = 0; i < n; ++i) pack_x[i * n + i] = one;
+    }
+
+    Lanes product = one;
+    LaneMask singular = LaneMask{};
+    for (auto k = 0; k < n; ++k) {
+      // the row of the largest element of the column below the diagonal
+      Lanes *row_k = pack_a + k * n;
+      Lanes largest = row_k[k] < 0.0 ? -row_k[k] : row_k[k];
+      Lanes pivot = Lanes{} + static_cast<double>(k);
+      for (auto i = k + 1; i < n; ++i) {
+        const Lanes value = pack_a[i * n + k];
+        const Lanes magnitude = value < 0.0 ? -value : value;
+        const LaneMask larger = magnitude > largest;
+        largest = larger ? magnitude : largest;
+        pivot = larger ? Lanes{} + static_cast<double>(i) : pivot;
+      }
+      // every lane swaps its own rows, so the swaps are done lane by lane
+      for (auto lane = 0; lane < kLanes; ++lane) {
+        const int r = static_cast<int>(pivot[lane]);
+        if (r == k) continue;
+        auto *lane_k = reinterpret_cast<double *>(row_k) + lane;
+        auto *lane_r = reinterpret_cast<double *>(pack_a + r * n) + lane;
+        for (auto j = 0; j < n; ++j)
+          std::swap(lane_k[j * kLanes], lane_r[j * kLanes]);
+        if (kInverse) {
+          lane_k = reinterpret_cast<double *>(pack_x + k * n) + lane;
+          lane_r = reinterpret_cast<double *>(pack_x + r * n) + lane;
+          for (auto j = 0; j < n; ++j)
+            std::swap(lane_k[j * kLanes], lane_r[j * kLanes]);
+        }
+        product[lane] = -product[lane];
+      }
+      const Lanes diagonal = row_k[k];
+      singular |= largest == 0.0;
+      product *= diagonal;
+      for (auto i = k + 1; i < n; ++i) {
+        Lanes *row_i = pack_a + i * n;
+        const Lanes factor = row_i[k] / diagonal;
+        for (auto j = k + 1; j < n; ++j) row_i[j] -= factor * row_k[j];
+        if (kInverse) {
+          Lanes *x_row_i = pack_x + i * n;
+          const Lanes *x_row_k = pack_x + k * n;
+          for (auto j = 0; j < n; ++j) x_row_i[j] -= factor * x_row_k[j];
+        }
+      }
+    }
+    // det is not aligned to whole vectors
+    const Lanes determinants = singular ? Lanes{} : product;
+    std::memcpy(det + p * kLanes, &determinants, sizeof(determinants));
+    if (!kInverse) continue;
+
+    // U * X = Y, a row of X at a time from the last one
+    for (auto i = n - 1; i >= 0; --i) {
+      Lanes *x_row_i = pack_x + i * n;
+      for (auto q = i + 1; q < n; ++q) {
+        const Lanes factor = pack_a[i * n + q];
+        const Lanes *x_row_q = pack_x + q * n;
+        for (auto j = 0; j < n; ++j) x_row_i[j] -= factor * x_row_q[j];
+      }
+      const Lanes diagonal = pack_a[i * n + i];
+      for (auto j = 0; j < n; ++j) x_row_i[j] /= diagonal;
+    }
+  }
+}
+
+void MulGeneric(std::ptrdiff_t packs, int m, int k, int n, const double *a,
+                const double *b, double *c) {
+  MulPacks(packs, m, k, n, a, b, c);
+}
+
+void DeterminantGeneric(std::ptrdiff_t packs, int n, double *a, double *det) {
+  EliminatePacks<false>(packs, n, a, nullptr, det);
+}
+
+void InverseGeneric(std::ptrdiff_t packs, int n, double *a, double *x,
+                    double *det) {
+  EliminatePacks<true>(packs, n, a, x, det);
+}
+
+#ifdef S21_SIMD_X86
+
+__attribute__((target("avx2,fma"))) void MulAvx2(std::ptrdiff_t packs, int m,
+                                                 int k, int n, const double *a,
+                                                 const double *b, double *c) {
+  MulPacks(packs, m, k, n, a, b, c);
+}
+
+__attribute__((target("avx2,fma"))) void DeterminantAvx2(std::ptrdiff_t packs,
+                                                         int n, double *a,
+                                                         double *det) {
+  EliminatePacks<false>(packs, n, a, nullptr, det);
+}
+
+__attribute__((target("avx2,fma"))) void InverseAvx2(std::ptrdiff_t packs,
+                                                     int n, double *a,
+                                                     double *x, double *det) {
+  EliminatePacks<true>(packs, n, a, x, det);
+}
+
+__attribute__((target("avx512f"))) void MulAvx512(std::ptrdiff_t packs, int m,
+                                                  int k, int n,
+                                                  const double *a,
+                                                  const double *b, double *c) {
+  MulPacks(packs, m, k, n, a, b, c);
+}
+
+__attribute__((target("avx512f"))) void DeterminantAvx512(std::ptrdiff_t packs,
+                                                          int n, double *a,
+                                                          double *det) {
+  EliminatePacks<false>(packs, n, a, nullptr, det);
+}
+
+__attribute__((target("avx512f"))) void InverseAvx512(std::ptrdiff_t packs,
+                                                      int n, double *a,
+                                                      double *x, double *det) {
+  EliminatePacks<true>(packs, n, a, x, det);
+}
+
+#endif  // S21_SIMD_X86
+
+// the pack kernels of one instruction set
+struct BatchKernels {
+  void (*mul)(std::ptrdiff_t packs, int m, int k, int n, const double *a,
+              const double *b, double *c);
+  void (*determinant)(std::ptrdiff_t packs, int n, double *a, double *det);
+  void (*inverse)(std::ptrdiff_t packs, int n, double *a, double *x,
+                  double *det);
+};
+
+// the kernels of the level of s21::Simd(), the generic ones are compiled
+// for the baseline of the target, SSE2 on x86-64
+const BatchKernels &Kernels() noexcept {
+  static const BatchKernels kGeneric = {MulGeneric, DeterminantGeneric,
+                                        InverseGeneric};
+#ifdef S21_SIMD_X86
+  static const BatchKernels kAvx2 = {MulAvx2, DeterminantAvx2, InverseAvx2};
+  static const BatchKernels kAvx512 = {MulAvx512, DeterminantAvx512,
+                                       InverseAvx512};
+  switch (s21::Simd().level) {
+    case s21::SimdLevel::kAvx512:
+      return kAvx512;
+    case s21::SimdLevel::kAvx2:
+      return kAvx2;
+    default:
+      break;
+  }
+#endif  // S21_SIMD_X86
+  return kGeneric;
+}
+
+// calls body(begin, end) on ranges of the packs with about kParallelWork
+// multiply-adds each, work is the number of multiply-adds of one pack
+template <class Body>
+void ForEachPacks(std::ptrdiff_t packs, std::ptrdiff_t work,
+                  const Body &body) {
+  const std::ptrdiff_t grain = std::max<std::ptrdiff_t>(
+      1, kParallelWork / std::max<std::ptrdiff_t>(1, work));
+  if (packs < 2 * grain) return body(0, packs);
+  s21::ParallelFor(packs, grain, body);
+}
+
+// calls kernel(y, x, n) on the chunks of the n elements of two buffers
+template <class Kernel>
+void ForEachChunk(std::ptrdiff_t n, double *y, const double *x,
+                  Kernel kernel) {
+  if (n < 2 * kParallelGrain) return kernel(y, x, n);
+  s21::ParallelFor(n, kParallelGrain,
+                   [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+                     kernel(y + begin, x + begin, end - begin);
+                   });
+}
+
+}  // namespace
+
+// AUXILIARY METHODS
+
+std::ptrdiff_t S21MatrixBatch::Packs() const noexcept {
+  return (static_cast<std::ptrdiff_t>(count_) + kLanes - 1) / kLanes;
+}
+
+// the number of elements of a pack
+std::ptrdiff_t S21MatrixBatch::PackSize() const noexcept {
+  return static_cast<std::ptrdiff_t>(rows_) * cols_ * kLanes;
+}
+
+std::size_t S21MatrixBatch::Bytes() const noexcept {
+  return static_cast<std::size_t>(Packs() * PackSize()) * sizeof(double);
+}
+
+// one aligned buffer for the packs of the current shape
+double *S21MatrixBatch::Allocate() {
+  if (!count_) return nullptr;
+  return static_cast<double *>(resource_->allocate(Bytes(), kAlignment));
+}
+
+void S21MatrixBatch::Clear() noexcept {
+  if (data_) resource_->deallocate(data_, Bytes(), kAlignment);
+  data_ = nullptr;
+}
+
+void S21MatrixBatch::CheckItem(int item) const {
+  if (item < 0 || count_ <= item)
+    throw std::out_of_range("The matrix index is incorrect");
+}
+
+void S21MatrixBatch::CheckShape(const S21MatrixBatch &other) const {
+  if (count_ != other.count_ || rows_ != other.rows_ || cols_ != other.cols_)
+    throw std::invalid_argument(
+        "The batches must have the same number of matrices of the same "
+        "dimensions");
+}
+
+std::ptrdiff_t S21MatrixBatch::Index(int item, int row,
+                                     int col) const noexcept {
+  return (item / kLanes) * PackSize() +
+         (static_cast<std::ptrdiff_t>(row) * cols_ + col) * kLanes +
+         item % kLanes;
+}
+
+// CONSTRUCTORS
+
+S21MatrixBatch::S21MatrixBatch() noexcept
+    : count_(0),
+      rows_(0),
+      cols_(0),
+      data_(nullptr),
+      resource_(std::pmr::get_default_resource()) {}
+
+S21MatrixBatch::S21MatrixBatch(int count, int rows, int cols)
+    : S21MatrixBatch(count, rows, cols, std::pmr::get_default_resource()) {}
+
+S21MatrixBatch::S21MatrixBatch(int count, int rows, int cols,
+                               std::pmr::memory_resource *resource)
+    : count_(count),
+      rows_(rows),
+      cols_(cols),
+      data_(nullptr),
+      resource_(resource) {
+  if (count < 0)
+    throw std::invalid_argument("The number of matrices must not be negative");
+  if (rows < 1 || cols < 1)
+    throw std::invalid_argument(
+        "The number of rows and columns must be greater than 1");
+  data_ = Allocate();
+  if (data_) std::memset(data_, 0, Bytes());
+}
+
+S21MatrixBatch::S21MatrixBatch(const std::vector<S21Matrix> &matrices)
+    : S21MatrixBatch(static_cast<int>(matrices.size()),
+                     matrices.empty() ? 1 : matrices.front().GetRows(),
+                     matrices.empty() ? 1 : matrices.front().GetCols()) {
+  for (auto item = 0; item < count_; ++item) SetMatrix(item, matrices[item]);
+}
+
+// like S21Matrix the copy takes the default memory resource
+S21MatrixBatch::S21MatrixBatch(const S21MatrixBatch &copy)
+    : count_(copy.count_),
+      rows_(copy.rows_),
+      cols_(copy.cols_),
+      data_(nullptr),
+      resource_(std::pmr::get_default_resource()) {
+  data_ = Allocate();
+  if (data_) std::memcpy(data_, copy.data_, Bytes());
+}
+
+S21MatrixBatch::S21MatrixBatch(S21MatrixBatch &&moved) noexcept
+    : count_(moved.count_),
+      rows_(moved.rows_),
+      cols_(moved.cols_),
+      data_(moved.data_),
+      resource_(moved.resource_) {
+  moved.count_ = 0;
+  moved.data_ = nullptr;
+}
+
+S21MatrixBatch::~S21MatrixBatch() { Clear(); }
+
+S21MatrixBatch &S21MatrixBatch::operator=(const S21MatrixBatch &other) {
+  if (this == &other) return *this;
+  if (Bytes() != other.Bytes()) {
+    Clear();
+    count_ = 0;
+    data_ = other.data_ ? static_cast<double *>(
+                              resource_->allocate(other.Bytes(), kAlignment))
+                        : nullptr;
+  }
+  count_ = other.count_;
+  rows_ = other.rows_;
+  cols_ = other.cols_;
+  if (data_) std::memcpy(data_, other.data_, Bytes());
+  return *this;
+}
+
+S21MatrixBatch &S21MatrixBatch::operator=(S21MatrixBatch &&other) noexcept {
+  if (this == &other) return *this;
+  Clear();
+  count_ = std::exchange(other.count_, 0);
+  rows_ = other.rows_;
+  cols_ = other.cols_;
+  data_ = std::exchange(other.data_, nullptr);
+  resource_ = other.resource_;
+  return *this;
+}
+
+// ACCESSORS
+
+int S21MatrixBatch::GetCount() const noexcept { return count_; }
+
+int S21MatrixBatch::GetRows() const noexcept { return rows_; }
+
+int S21MatrixBatch::GetCols() const noexcept { return cols_; }
+
+std::pmr::memory_resource *S21MatrixBatch::GetResource() const noexcept {
+  return resource_;
+}
+
+double S21MatrixBatch::GetValue(int item, int row, int col) const {
+  CheckItem(item);
+  if (row < 0 || rows_ <= row)
+    throw std::out_of_range("The row index is incorrect");
+  if (col < 0 || cols_ <= col)
+    throw std::out_of_range("The column index is incorrect");
+  return data_[Index(item, row, col)];
+}
+
+// the matrix gathered from the lane of its pack
+S21Matrix S21MatrixBatch::GetMatrix(int item) const {
+  CheckItem(item);
+  S21Matrix result(rows_, cols_);
+  const double *lane = data_ + Index(item, 0, 0);
+  for (auto i = 0; i < rows_; ++i)
+    for (auto j = 0; j < cols_; ++j, lane += kLanes)
+      result.SetValue(i, j, *lane);
+  return result;
+}
+
+// MUTATORS
+
+void S21MatrixBatch::SetValue(int item, int row, int col, double value) {
+  CheckItem(item);
+  if (row < 0 || rows_ <= row)
+    throw std::out_of_range("The row index is incorrect");
+  if (col < 0 || cols_ <= col)
+    throw std::out_of_range("The column index is incorrect");
+  data_[Index(item, row, col)] = value;
+}
+
+// the matrix scattered into the lane of its pack
+void S21MatrixBatch::SetMatrix(int item, const S21Matrix &matrix) {
+  CheckItem(item);
+  if (matrix.GetRows() != rows_ || matrix.GetCols() != cols_)
+    throw std::invalid_argument(
+        "The matrix must have the dimensions of the batch");
+  double *lane = data_ + Index(item, 0, 0);
+  for (auto i = 0; i < rows_; ++i)
+    for (auto j = 0; j < cols_; ++j, lane += kLanes) *lane = matrix(i, j);
+}
+
+// OPERATIONS
+
+// the full packs are compared as one run, the last one lane by lane
+bool S21MatrixBatch::EqMatrix(const S21MatrixBatch &other) const noexcept {
+  if (count_ != other.count_ || rows_ != other.rows_ || cols_ != other.cols_)
+    return false;
+  if (!count_) return true;
+  const std::ptrdiff_t full = count_ / kLanes * PackSize();
+  if (!s21::Simd().equal(data_, other.data_, full)) return false;
+  const int lanes = count_ % kLanes;
+  for (std::ptrdiff_t e = full; e < Packs() * PackSize(); e += kLanes)
+    for (auto lane = 0; lane < lanes; ++lane)
+      if (!(data_[e + lane] == other.data_[e + lane])) return false;
+  return true;
+}
+
+// the padding lanes are added too, the batches are added as flat buffers
+void S21MatrixBatch::SumMatrix(const S21MatrixBatch &other) {
+  CheckShape(other);
+  ForEachChunk(Packs() * PackSize(), data_, other.data_, s21::Simd().add);
+}
+
+void S21MatrixBatch::SubMatrix(const S21MatrixBatch &other) {
+  CheckShape(other);
+  ForEachChunk(Packs() * PackSize(), data_, other.data_, s21::Simd().sub);
+}
+
+void S21MatrixBatch::MulNumber(const double num) noexcept {
+  const auto scale = s21::Simd().scale;
+  ForEachChunk(Packs() * PackSize(), data_, data_,
+               [&](double *y, const double *, std::size_t n) {
+                 scale(y, num, n);
+               });
+}
+
+// every matrix is multiplied by the matrix with the same index in other
+void S21MatrixBatch::MulMatrix(const S21MatrixBatch &other) {
+  if (count_ != other.count_)
+    throw std::invalid_argument(
+        "The batches must have the same number of matrices");
+  if (cols_ != other.rows_)
+    throw std::invalid_argument(
+        "The number of columns of the first matrix must be equal to the "
+        "number of rows of the second matrix");
+  S21MatrixBatch result(count_, rows_, other.cols_, resource_);
+  const auto mul = Kernels().mul;
+  const std::ptrdiff_t a_size = PackSize(), b_size = other.PackSize(),
+                       c_size = result.PackSize();
+  ForEachPacks(Packs(), a_size * other.cols_,
+               [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+                 mul(end - begin, rows_, cols_, other.cols_,
+                     data_ + begin * a_size, other.data_ + begin * b_size,
+                     result.data_ + begin * c_size);
+               });
+  *this = std::move(result);
+}
+
+std::vector<double> S21MatrixBatch::Determinant() const {
+  if (rows_ != cols_) throw std::invalid_argument("The matrix is not square");
+  std::vector<double> result(count_);
+  if (!count_) return result;
+  // the factorization overwrites a copy, the determinants of the padding
+  // lanes go to the tail of the buffer
+  S21MatrixBatch lu(*this);
+  std::vector<double> det(Packs() * kLanes);
+  const auto determinant = Kernels().determinant;
+  const std::ptrdiff_t size = PackSize();
+  ForEachPacks(Packs(), size * rows_ / 3,
+               [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+                 determinant(end - begin, rows_, lu.data_ + begin * size,
+                             det.data() + begin * kLanes);
+               });
+  std::copy_n(det.begin(), count_, result.begin());
+  return result;
+}
+
+S21MatrixBatch S21MatrixBatch::InverseMatrix() const {
+  if (rows_ != cols_) throw std::invalid_argument("The matrix is not square");
+  S21MatrixBatch result(count_, rows_, cols_, resource_);
+  if (!count_) return result;
+  S21MatrixBatch lu(*this);
+  // the padding lanes are made identities so that they stay regular
+  for (auto item = count_; item < Packs() * kLanes; ++item)
+    for (auto i = 0; i < rows_; ++i)
+      for (auto j = 0; j < cols_; ++j)
+        lu.data_[lu.Index(item, i, j)] = i == j;
+  std::vector<double> det(Packs() * kLanes);
+  const auto inverse = Kernels().inverse;
+  const std::ptrdiff_t size = PackSize();
+  ForEachPacks(Packs(), size * rows_,
+               [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+                 inverse(end - begin, rows_, lu.data_ + begin * size,
+                         result.data_ + begin * size,
+                         det.data() + begin * kLanes);
+               });
+  if (std::find(det.begin(), det.begin() + count_, 0.0) !=
+      det.begin() + count_)
+    throw std::invalid_argument("The determinant of the matrix is 0");
+  return result;
+}
@@ -0,0 +1,81 @@
+#ifndef SRC_S21_BATCH_H_
+#define SRC_S21_BATCH_H_
+
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// A batch of independent matrices of the same shape stored interleaved:
+// the matrices are grouped into packs of kLanes, and a pack keeps element
+// (i, j) of all its matrices next to each other in one cache line. The
+// operations then process kLanes matrices at once with every vector
+// instruction, whatever the order of the matrices, and one allocation
+// holds the whole batch. The last pack is padded with lanes that hold no
+// matrix; their values are unspecified and never read.
+class S21MatrixBatch {
+ public:
+  // matrices per pack, one AVX-512 register of doubles
+  static constexpr int kLanes = 8;
+
+ private:
+  static constexpr std::size_t kAlignment = 64;
+
+  int count_;        // the number of matrices
+  int rows_, cols_;  // the shape of every matrix
+  double *data_;     // packs of rows_ * cols_ * kLanes elements
+  std::pmr::memory_resource *resource_;  // source of the buffer memory
+
+  std::ptrdiff_t Packs() const noexcept;
+  std::ptrdiff_t PackSize() const noexcept;
+  std::size_t Bytes() const noexcept;
+  double *Allocate();
+  void Clear() noexcept;
+  void CheckItem(int item) const;
+  void CheckShape(const S21MatrixBatch &other) const;
+  // the position of element (row, col) of the matrix in data_
+  std::ptrdiff_t Index(int item, int row, int col) const noexcept;
+
+ public:
+  S21MatrixBatch() noexcept;  // an empty batch
+  // count zero matrices of rows x cols
+  S21MatrixBatch(int count, int rows, int cols);
+  S21MatrixBatch(int count, int rows, int cols,
+                 std::pmr::memory_resource *resource);
+  // the copies of the matrices, all of them must have the same shape
+  explicit S21MatrixBatch(const std::vector<S21Matrix> &matrices);
+  S21MatrixBatch(const S21MatrixBatch &copy);
+  S21MatrixBatch(S21MatrixBatch &&moved) noexcept;
+  ~S21MatrixBatch();
+
+  S21MatrixBatch &operator=(const S21MatrixBatch &other);
+  S21MatrixBatch &operator=(S21MatrixBatch &&other) noexcept;
+
+  // getters
+  int GetCount() const noexcept;
+  int GetRows() const noexcept;
+  int GetCols() const noexcept;
+  std::pmr::memory_resource *GetResource() const noexcept;
+  double GetValue(int item, int row, int col) const;
+  S21Matrix GetMatrix(int item) const;
+
+  // setters
+  void SetValue(int item, int row, int col, double value);
+  void SetMatrix(int item, const S21Matrix &matrix);
+
+  // the operations of S21Matrix applied to every matrix of the batch,
+  // the operands are the matrices with the same index in the other batch
+  bool EqMatrix(const S21MatrixBatch &other) const noexcept;
+  void SumMatrix(const S21MatrixBatch &other);
+  void SubMatrix(const S21MatrixBatch &other);
+  void MulNumber(const double num) noexcept;
+  void MulMatrix(const S21MatrixBatch &other);
+  // the determinants by LU factorization with partial pivoting
+  std::vector<double> Determinant() const;
+  // the inverses by Gaussian elimination with partial pivoting applied to
+  // the identity, throws when any of the matrices is singular
+  S21MatrixBatch InverseMatrix() const;
+};
+
+#endif  // SRC_S21_BATCH_H_
@@ -0,0 +1,117 @@
+#include "s21_cholesky.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "s21_gemm.h"
+#include "s21_transpose.h"
+#include "s21_triangular.h"
+
+// CONSTRUCTORS
+
+// factorizes a copy of the square matrix allocated from its memory resource,
+// the copy of a matrix over external rows uses the default resource
+S21CholeskyDecomposition::S21CholeskyDecomposition(const S21Matrix &matrix)
+    : l_(matrix, matrix.ResultResource()), positive_definite_(true) {
+  if (matrix.GetRows() != matrix.GetCols())
+    throw std::invalid_argument("The matrix is not square");
+  Factorize();
+}
+
+// blocked right-looking factorization in place: the columns of a panel of
+// kBlock columns are computed from dot products of rows, then the lower
+// triangle of the trailing submatrix is updated by matrix products, one
+// block of rows at a time so that the part above the diagonal is skipped
+void S21CholeskyDecomposition::Factorize() {
+  const int n = l_.rows_;
+  const int stride = l_.stride_;
+  // the transposed columns of the panel below it, the right operand of Gemm
+  std::vector<double> panel_t(static_cast<std::size_t>(kBlock) * n);
+
+  for (auto k0 = 0; k0 < n && positive_definite_; k0 += kBlock) {
+    const int k1 = std::min(n, k0 + kBlock);
+    for (auto k = k0; k < k1; ++k) {
+      double *pivot_row = l_.RowPtr(k);
+      double pivot = pivot_row[k];
+      for (auto p = k0; p < k; ++p) pivot -= pivot_row[p] * pivot_row[p];
+      // a small positive pivot may come from a badly scaled row, only one
+      // that is not positive proves the matrix is not positive definite
+      if (!(pivot > 0)) {
+        positive_definite_ = false;
+        break;
+      }
+      pivot = std::sqrt(pivot);
+      pivot_row[k] = pivot;
+      for (auto i = k + 1; i < n; ++i) {
+        double *row = l_.RowPtr(i);
+        double sum = row[k];
+        for (auto p = k0; p < k; ++p) sum -= row[p] * pivot_row[p];
+        row[k] = sum / pivot;
+      }
+    }
+    if (k1 == n || !positive_definite_) break;
+    // A22 -= L21 * L21^T, on and below the diagonal
+    const int rest = n - k1;
+    s21::Transpose(rest, k1 - k0, l_.RowPtr(k1) + k0, stride, panel_t.data(),
+                   rest);
+    for (auto r0 = k1; r0 < n; r0 += kBlock) {
+      const int r1 = std::min(n, r0 + kBlock);
+      s21::Gemm(r1 - r0, r1 - k1, k1 - k0, -1, l_.RowPtr(r0) + k0, stride,
+                panel_t.data(), rest, l_.RowPtr(r0) + k1, stride);
+    }
+  }
+  for (auto i = 0; i < n; ++i)
+    std::fill(l_.RowPtr(i) + i + 1, l_.RowPtr(i) + n, 0.0);
+}
+
+// ACCESSORS
+
+int S21CholeskyDecomposition::GetSize() const noexcept { return l_.rows_; }
+
+bool S21CholeskyDecomposition::IsPositiveDefinite() const noexcept {
+  return positive_definite_;
+}
+
+// returns the lower triangular factor L
+const S21Matrix &S21CholeskyDecomposition::GetFactor() const noexcept {
+  return l_;
+}
+
+// OPERATIONS
+
+// the determinant is the squared product of the diagonal of L
+double S21CholeskyDecomposition::Determinant() const noexcept {
+  if (!positive_definite_) return 0;
+  double det = 1;
+  for (auto i = 0; i < l_.rows_; ++i) det *= l_.RowPtr(i)[i];
+  return det * det;
+}
+
+S21Matrix S21CholeskyDecomposition::InverseMatrix() const {
+  if (!positive_definite_)
+    throw std::invalid_argument("The matrix is not positive definite");
+  const int n = l_.rows_;
+  S21Matrix identity(n, n);
+  for (auto i = 0; i < n; ++i) identity.RowPtr(i)[i] = 1;
+  return Solve(identity);
+}
+
+// solving A * X = B for all columns of B at once: forward substitution with
+// L, then backward substitution with L^T
+S21Matrix S21CholeskyDecomposition::Solve(const S21Matrix &rhs) const {
+  const int n = l_.rows_;
+  if (rhs.rows_ != n)
+    throw std::invalid_argument(
+        "The number of rows of the right-hand side must be "
+        "equal to the order of the matrix");
+  if (!positive_definite_)
+    throw std::invalid_argument("The matrix is not positive definite");
+  S21Matrix result(rhs);
+  s21::SolveTriangular(s21::Triangle::kLower, n, result.cols_, l_.matrix_,
+                       l_.stride_, result.matrix_, result.stride_);
+  s21::SolveTriangular(s21::Triangle::kLowerTransposed, n, result.cols_,
+                       l_.matrix_, l_.stride_, result.matrix_,
+                       result.stride_);
+  return result;
+}
@@ -0,0 +1,32 @@
+#ifndef SRC_S21_CHOLESKY_H_
+#define SRC_S21_CHOLESKY_H_
+
+#include "s21_matrix_oop.h"
+
+// Cholesky factorization of a symmetric positive definite matrix:
+// A = L * L^T with a lower triangular L. Only the lower triangle of A is
+// read. It takes half the work of LU and needs no pivoting, and like LU it is
+// computed once and reused for any number of linear solves.
+class S21CholeskyDecomposition {
+ private:
+  // columns in a panel of the blocked factorization
+  static constexpr int kBlock = 64;
+
+  S21Matrix l_;             // L on and below the diagonal, zeros above it
+  bool positive_definite_;  // every pivot was positive
+
+  void Factorize();
+
+ public:
+  explicit S21CholeskyDecomposition(const S21Matrix &matrix);
+
+  int GetSize() const noexcept;
+  bool IsPositiveDefinite() const noexcept;
+  const S21Matrix &GetFactor() const noexcept;
+
+  double Determinant() const noexcept;
+  S21Matrix InverseMatrix() const;
+  S21Matrix Solve(const S21Matrix &rhs) const;
+};
+
+#endif  // SRC_S21_CHOLESKY_H_
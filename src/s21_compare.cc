@@ -0,0 +1,82 @@
+#include "s21_compare.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+#include "s21_runs.h"
+#include "s21_simd.h"
+#include "s21_stats.h"
+
+namespace {
+
+// elements per call of the max_difference kernel, the position is searched
+// only in the blocks that raise the maximum
+constexpr int kCompareBlock = 256;
+
+// the largest number of doubles apart that the near kernels count exactly
+constexpr std::int64_t kMaxUlps = std::int64_t{1} << 52;
+
+// the largest difference of a part of the matrix at a row-major index
+struct Difference {
+  double value = 0;
+  std::ptrdiff_t index = -1;
+
+  bool IsNan() const noexcept { return std::isnan(value); }
+  // a later part replaces the maximum only when it is larger, a NaN is
+  // never replaced
+  void Merge(const Difference &other) noexcept {
+    if (IsNan() || other.index < 0) return;
+    if (index < 0 || other.IsNan() || other.value > value) *this = other;
+  }
+};
+
+}  // namespace
+
+// COMPARISON
+
+bool S21Matrix::EqMatrix(const S21Matrix &other,
+                         s21::Tolerance tolerance) const noexcept {
+  S21_STATS_SCOPE(kEqMatrix, Elements());
+  if (rows_ != other.rows_ || cols_ != other.cols_) return false;
+  const auto &simd = s21::Simd();
+  const std::int64_t ulps = std::clamp<std::int64_t>(tolerance.ulps, 0,
+                                                     kMaxUlps);
+  return s21::AllRows(rows_, cols_, [&](int i) {
+    return simd.near(RowPtr(i), other.RowPtr(i), cols_, tolerance.absolute,
+                     tolerance.relative, ulps);
+  });
+}
+
+// the tasks keep the first position of their maximum and are merged in the
+// order of the rows; a task stops at its first NaN difference
+s21::Extremum S21Matrix::MaxDifference(const S21Matrix &other) const {
+  S21_STATS_SCOPE(kReduce, Elements());
+  if (rows_ != other.rows_ || cols_ != other.cols_)
+    throw std::invalid_argument("Matrices should have the same size");
+  const auto &simd = s21::Simd();
+  const auto partial = s21::ReduceRowTasks<Difference>(
+      rows_, cols_, [&](Difference &max, int begin, int end) {
+        for (auto i = begin; i < end && !max.IsNan(); ++i) {
+          const double *x = RowPtr(i), *y = other.RowPtr(i);
+          for (auto b = 0; b < cols_ && !max.IsNan(); b += kCompareBlock) {
+            const int n = std::min(kCompareBlock, cols_ - b);
+            const double block = simd.max_difference(x + b, y + b, n);
+            if (!(block > max.value || std::isnan(block)) && max.index >= 0)
+              continue;
+            auto j = 0;
+            while (j < n && std::fabs(x[b + j] - y[b + j]) != block &&
+                   !std::isnan(x[b + j] - y[b + j]))
+              ++j;
+            max = {block, static_cast<std::ptrdiff_t>(i) * cols_ + b + j};
+          }
+        }
+      });
+  Difference max;
+  for (const auto &task : partial) max.Merge(task);
+  if (max.index < 0) return {0, -1, -1};
+  return {max.value, static_cast<int>(max.index / cols_),
+          static_cast<int>(max.index % cols_)};
+}
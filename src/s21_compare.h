@@ -0,0 +1,28 @@
+#ifndef SRC_S21_COMPARE_H_
+#define SRC_S21_COMPARE_H_
+
+#include <cstdint>
+
+namespace s21 {
+
+// the tolerance of S21Matrix::EqMatrix: two elements match when they are
+// equal, when their difference is finite and at most absolute or relative
+// times the larger magnitude, or when at most ulps doubles lie between them
+// (ulps up to 2^52); NaN matches nothing
+struct Tolerance {
+  double absolute = 0;
+  double relative = 0;
+  std::int64_t ulps = 0;
+
+  static Tolerance Absolute(double absolute) noexcept {
+    return {absolute, 0, 0};
+  }
+  static Tolerance Relative(double relative) noexcept {
+    return {0, relative, 0};
+  }
+  static Tolerance Ulps(std::int64_t ulps) noexcept { return {0, 0, ulps}; }
+};
+
+}  // namespace s21
+
+#endif  // SRC_S21_COMPARE_H_
@@ -1,40 +1,55 @@
 #include "s21_matrix_oop.h"
 
+#include <climits>
+
+#include "s21_transpose.h"
+
 // CONSTRUCTORS
 
-S21Matrix::S21Matrix() {
-  rows_ = 3;
-  cols_ = 3;
-  matrix_ = MatrixMemoryAllocation(rows_, cols_);
-}
+S21Matrix::S21BasicMatrix() : S21Matrix(3, 3) {}
 
 // parameterized constructor
-S21Matrix::S21Matrix(int rows, int cols) : rows_(rows), cols_(cols) {
-  if (rows < 1 || cols < 1)
-    throw std::invalid_argument(
-        "The number of rows and columns must be greater than 1");
-  matrix_ = MatrixMemoryAllocation(rows, cols);
-}
+S21Matrix::S21BasicMatrix(int rows, int cols)
+    : S21Matrix(rows, cols, std::pmr::get_default_resource()) {}
 
-// copy cnstructor
-S21Matrix::S21Matrix(const S21Matrix &copy)
-    : rows_(copy.rows_), cols_(copy.cols_) {
-  matrix_ = MatrixMemoryAllocation(rows_, cols_);
-  for (auto i = 0; i < rows_; ++i)
-    std::memcpy(matrix_[i], copy.matrix_[i], copy.cols_ * sizeof(double));
-}
+// parameterized constructor with the buffer from the memory resource
+S21Matrix::S21BasicMatrix(int rows, int cols,
+                          std::pmr::memory_resource *resource)
+    : Base(rows, cols, resource) {}
 
-// move cnstructor
-S21Matrix::S21Matrix(S21Matrix &&moved)
-    : rows_(moved.rows_), cols_(moved.cols_), matrix_(moved.matrix_) {
-  moved.matrix_ = nullptr;
-  moved.rows_ = 0;
-  moved.cols_ = 0;
+// copy cnstructor, like the standard containers the copy does not inherit
+// the memory resource and uses the default one
+S21Matrix::S21BasicMatrix(const S21Matrix &copy) : Base(copy) {}
+
+// copy constructor with the buffer from the memory resource
+S21Matrix::S21BasicMatrix(const S21Matrix &copy,
+                          std::pmr::memory_resource *resource)
+    : Base(copy, resource) {}
+
+// copying the elements of a view, the rows are copied at once when their
+// elements are adjacent and a transposed view is transposed back by tiles
+S21Matrix::S21BasicMatrix(S21MatrixView view)
+    : S21Matrix(view, std::pmr::get_default_resource()) {}
+
+S21Matrix::S21BasicMatrix(S21MatrixView view,
+                          std::pmr::memory_resource *resource)
+    : S21Matrix(view.GetRows(), view.GetCols(), resource) {
+  const double *data = view.Data();
+  const std::ptrdiff_t row_stride = view.GetRowStride(),
+                       col_stride = view.GetColStride();
+  if (col_stride == 1) {
+    for (auto i = 0; i < rows_; ++i)
+      std::memcpy(RowPtr(i), data + i * row_stride, cols_ * sizeof(double));
+  } else if (row_stride == 1 && col_stride <= INT_MAX) {
+    s21::Transpose(cols_, rows_, data, static_cast<int>(col_stride), matrix_,
+                   stride_);
+  } else {
+    for (auto i = 0; i < rows_; ++i)
+      for (auto j = 0; j < cols_; ++j)
+        RowPtr(i)[j] = data[i * row_stride + j * col_stride];
+  }
 }
 
-// destructor
-S21Matrix::~S21Matrix() {
-  ClearMatrix();
-  rows_ = 0;
-  cols_ = 0;
-}
\ No newline at end of file
+// move cnstructor
+S21Matrix::S21BasicMatrix(S21Matrix &&moved) noexcept
+    : Base(std::move(moved)) {}
@@ -0,0 +1,35 @@
+#ifndef SRC_S21_EXECUTION_H_
+#define SRC_S21_EXECUTION_H_
+
+#include <execution>
+
+#include "s21_matrix_oop.h"
+
+// The policies of <execution> as the s21::Execution of the matrix
+// operations, so that m.SumMatrix(std::execution::par, other) or
+// m.Apply(std::execution::par_unseq, f) compile. The parallel policies run
+// on the thread pool of s21_thread_pool.h; the element loops are vectorized
+// under every policy, so par_unseq behaves as par. The header is separate
+// because libstdc++ implements <execution> with TBB, which the programs that
+// include it must link; s21::Execution itself needs neither.
+
+namespace s21 {
+
+template <>
+struct ExecutionOf<std::execution::sequenced_policy> {
+  static constexpr Execution value = Execution::kSequenced;
+};
+
+template <>
+struct ExecutionOf<std::execution::parallel_policy> {
+  static constexpr Execution value = Execution::kParallel;
+};
+
+template <>
+struct ExecutionOf<std::execution::parallel_unsequenced_policy> {
+  static constexpr Execution value = Execution::kParallelUnsequenced;
+};
+
+}  // namespace s21
+
+#endif  // SRC_S21_EXECUTION_H_
@@ -0,0 +1,308 @@
+#ifndef SRC_S21_EXPRESSION_H_
+#define SRC_S21_EXPRESSION_H_
+
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "s21_gemm.h"
+#include "s21_matrix_oop.h"
+#include "s21_stats.h"
+#include "s21_strassen.h"
+#include "s21_thread_pool.h"
+
+// Expression templates: the operators +, - and * build lightweight nodes
+// instead of matrices, and the whole expression is evaluated element by
+// element when it is assigned to an S21Matrix, so A + B - C * k allocates
+// the result once and reads every operand once. Matrix products are not
+// element-wise and are computed into their own matrix when the node is
+// created. The nodes keep references to their S21Matrix operands, so an
+// expression must be evaluated within the statement that builds it.
+
+namespace s21 {
+
+// elements below which an expression is evaluated on the calling thread
+constexpr std::ptrdiff_t kExprParallelGrain = 1 << 15;
+
+// operands are kept by reference when they own storage (matrices and
+// computed products) and by value when they are lightweight nodes
+template <class E>
+struct ExprStorage {
+  using type = const E;
+};
+template <>
+struct ExprStorage<S21Matrix> {
+  using type = const S21Matrix &;
+};
+template <class L, class R>
+struct ExprStorage<S21ProductExpr<L, R>> {
+  using type = const S21ProductExpr<L, R> &;
+};
+
+// the readers of one row of a node
+template <class LRow, class RRow, class Op>
+struct BinaryRow {
+  LRow lhs;
+  RRow rhs;
+  double operator[](int j) const { return Op()(lhs[j], rhs[j]); }
+};
+
+template <class Row>
+struct ScaledRow {
+  Row row;
+  double factor;
+  double operator[](int j) const { return row[j] * factor; }
+};
+
+}  // namespace s21
+
+// element-wise addition or subtraction of two expressions of the same size
+template <class L, class R, class Op>
+class S21BinaryExpr : public S21MatrixExpr<S21BinaryExpr<L, R, Op>> {
+ public:
+  S21BinaryExpr(const L &lhs, const R &rhs) : lhs_(lhs), rhs_(rhs) {
+    if (lhs.GetRows() != rhs.GetRows() || lhs.GetCols() != rhs.GetCols())
+      throw std::invalid_argument("Matrices should have the same size");
+  }
+
+  int GetRows() const noexcept { return lhs_.GetRows(); }
+  int GetCols() const noexcept { return lhs_.GetCols(); }
+
+  auto RowPtr(int row) const noexcept {
+    using Row = s21::BinaryRow<decltype(lhs_.RowPtr(row)),
+                               decltype(rhs_.RowPtr(row)), Op>;
+    return Row{lhs_.RowPtr(row), rhs_.RowPtr(row)};
+  }
+
+ private:
+  typename s21::ExprStorage<L>::type lhs_;
+  typename s21::ExprStorage<R>::type rhs_;
+};
+
+// an expression multiplied by a number
+template <class E>
+class S21ScaledExpr : public S21MatrixExpr<S21ScaledExpr<E>> {
+ public:
+  S21ScaledExpr(const E &expr, double factor) : expr_(expr), factor_(factor) {}
+
+  int GetRows() const noexcept { return expr_.GetRows(); }
+  int GetCols() const noexcept { return expr_.GetCols(); }
+
+  auto RowPtr(int row) const noexcept {
+    return s21::ScaledRow<decltype(expr_.RowPtr(row))>{expr_.RowPtr(row),
+                                                       factor_};
+  }
+
+ private:
+  typename s21::ExprStorage<E>::type expr_;
+  double factor_;
+};
+
+// the product of two expressions, computed by the GEMM kernel or
+// Strassen-Winograd (see s21_strassen.h) when the node is built; operands
+// that are element-wise expressions are evaluated first
+template <class L, class R>
+class S21ProductExpr : public S21MatrixExpr<S21ProductExpr<L, R>> {
+ public:
+  S21ProductExpr(const L &lhs, const R &rhs) {
+    if (lhs.GetCols() != rhs.GetRows())
+      throw std::invalid_argument(
+          "The number of columns of the matrix1 must be "
+          "equal to the number of rows of the matrix2");
+    const S21Matrix &a = Evaluate(lhs, lhs_storage_);
+    const S21Matrix &b = Evaluate(rhs, rhs_storage_);
+    S21_STATS_SCOPE(kMulMatrix, a.Elements());
+    result_.Reshape(a.rows_, b.cols_);
+    s21::Multiply(a.rows_, b.cols_, a.cols_, a.matrix_, a.stride_, b.matrix_,
+                  b.stride_, result_.matrix_, result_.stride_);
+  }
+
+  int GetRows() const noexcept { return result_.rows_; }
+  int GetCols() const noexcept { return result_.cols_; }
+  const double *RowPtr(int row) const noexcept { return result_.RowPtr(row); }
+
+  const S21Matrix &Result() const noexcept { return result_; }
+  // hands the computed matrix over without copying its elements
+  S21Matrix Release() && noexcept { return std::move(result_); }
+
+ private:
+  static const S21Matrix &Evaluate(const S21Matrix &operand, S21Matrix &) {
+    return operand;
+  }
+  template <class A, class B>
+  static const S21Matrix &Evaluate(const S21ProductExpr<A, B> &operand,
+                                   S21Matrix &) {
+    return operand.Result();
+  }
+  template <class E>
+  static const S21Matrix &Evaluate(const E &operand, S21Matrix &storage) {
+    storage = operand;
+    return storage;
+  }
+
+  S21Matrix lhs_storage_{nullptr}, rhs_storage_{nullptr}, result_{nullptr};
+};
+
+// OPERATORS
+
+template <class L, class R>
+S21BinaryExpr<L, R, std::plus<>> operator+(const S21MatrixExpr<L> &lhs,
+                                           const S21MatrixExpr<R> &rhs) {
+  return {lhs.Self(), rhs.Self()};
+}
+
+template <class L, class R>
+S21BinaryExpr<L, R, std::minus<>> operator-(const S21MatrixExpr<L> &lhs,
+                                            const S21MatrixExpr<R> &rhs) {
+  return {lhs.Self(), rhs.Self()};
+}
+
+template <class E>
+S21ScaledExpr<E> operator*(const S21MatrixExpr<E> &expr, double num) {
+  return {expr.Self(), num};
+}
+
+template <class E>
+S21ScaledExpr<E> operator*(double num, const S21MatrixExpr<E> &expr) {
+  return {expr.Self(), num};
+}
+
+template <class L, class R>
+S21ProductExpr<L, R> operator*(const S21MatrixExpr<L> &lhs,
+                               const S21MatrixExpr<R> &rhs) {
+  return {lhs.Self(), rhs.Self()};
+}
+
+// OPERATORS ON TEMPORARIES
+// a matrix that is about to be destroyed is reused for the result
+
+template <class R>
+S21Matrix operator+(S21Matrix &&lhs, const S21MatrixExpr<R> &rhs) {
+  lhs += rhs.Self();
+  return std::move(lhs);
+}
+
+template <class L>
+S21Matrix operator+(const S21MatrixExpr<L> &lhs, S21Matrix &&rhs) {
+  rhs = lhs.Self() + rhs;
+  return std::move(rhs);
+}
+
+inline S21Matrix operator+(S21Matrix &&lhs, S21Matrix &&rhs) {
+  lhs += rhs;
+  return std::move(lhs);
+}
+
+template <class R>
+S21Matrix operator-(S21Matrix &&lhs, const S21MatrixExpr<R> &rhs) {
+  lhs -= rhs.Self();
+  return std::move(lhs);
+}
+
+template <class L>
+S21Matrix operator-(const S21MatrixExpr<L> &lhs, S21Matrix &&rhs) {
+  rhs = lhs.Self() - rhs;
+  return std::move(rhs);
+}
+
+inline S21Matrix operator-(S21Matrix &&lhs, S21Matrix &&rhs) {
+  lhs -= rhs;
+  return std::move(lhs);
+}
+
+inline S21Matrix operator*(S21Matrix &&matrix, double num) {
+  matrix.MulNumber(num);
+  return std::move(matrix);
+}
+
+inline S21Matrix operator*(double num, S21Matrix &&matrix) {
+  matrix.MulNumber(num);
+  return std::move(matrix);
+}
+
+// EVALUATION
+
+namespace s21 {
+
+// calls assign(dest_row, expr_row, cols) for every row of the expression,
+// large expressions are split over the thread pool
+template <class E, class Assign>
+void EvaluateRows(const E &expr, double *dest, std::ptrdiff_t dest_stride,
+                  Assign assign) {
+  const int rows = expr.GetRows(), cols = expr.GetCols();
+  auto row_range = [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    for (auto i = static_cast<int>(begin); i < end; ++i) {
+      double *out = dest + i * dest_stride;
+      auto in = expr.RowPtr(i);
+      for (auto j = 0; j < cols; ++j) assign(out[j], in[j]);
+    }
+  };
+  if (static_cast<std::ptrdiff_t>(rows) * cols < 2 * kExprParallelGrain)
+    row_range(0, rows);
+  else
+    ParallelFor(rows, std::max(1, static_cast<int>(kExprParallelGrain / cols)),
+                row_range);
+}
+
+template <class E>
+struct IsProductExpr : std::false_type {};
+template <class L, class R>
+struct IsProductExpr<S21ProductExpr<L, R>> : std::true_type {};
+
+}  // namespace s21
+
+template <class E>
+S21Matrix::S21BasicMatrix(const S21MatrixExpr<E> &expr)
+    : S21Matrix(nullptr) {
+  *this = expr;
+}
+
+template <class L, class R>
+S21Matrix::S21BasicMatrix(S21ProductExpr<L, R> &&product) noexcept
+    : S21Matrix(std::move(product).Release()) {}
+
+// every element of the result depends only on the elements of the operands
+// at the same position (products are computed beforehand), so the matrix
+// may appear in the expression it is assigned
+template <class E>
+S21Matrix &S21Matrix::operator=(const S21MatrixExpr<E> &expr) {
+  const E &self = expr.Self();
+  if constexpr (s21::IsProductExpr<E>::value) {
+    *this = self.Result();
+  } else {
+    Reshape(self.GetRows(), self.GetCols());
+    s21::EvaluateRows(self, matrix_, stride_,
+                      [](double &out, double in) { out = in; });
+  }
+  return *this;
+}
+
+// a product that is about to be destroyed gives away its matrix, which is
+// copied only when the matrix uses another memory resource
+template <class L, class R>
+S21Matrix &S21Matrix::operator=(S21ProductExpr<L, R> &&product) {
+  return *this = std::move(product).Release();
+}
+
+template <class E>
+S21Matrix &S21Matrix::operator+=(const S21MatrixExpr<E> &expr) {
+  const E &self = expr.Self();
+  if (rows_ != self.GetRows() || cols_ != self.GetCols())
+    throw std::invalid_argument("Matrices should have the same size");
+  s21::EvaluateRows(self, matrix_, stride_,
+                    [](double &out, double in) { out += in; });
+  return *this;
+}
+
+template <class E>
+S21Matrix &S21Matrix::operator-=(const S21MatrixExpr<E> &expr) {
+  const E &self = expr.Self();
+  if (rows_ != self.GetRows() || cols_ != self.GetCols())
+    throw std::invalid_argument("Matrices should have the same size");
+  s21::EvaluateRows(self, matrix_, stride_,
+                    [](double &out, double in) { out -= in; });
+  return *this;
+}
+
+#endif  // SRC_S21_EXPRESSION_H_
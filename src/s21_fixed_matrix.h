@@ -0,0 +1,395 @@
+#ifndef SRC_S21_FIXED_MATRIX_H_
+#define SRC_S21_FIXED_MATRIX_H_
+
+#include <cmath>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_matrix_oop.h"
+
+// A matrix with dimensions fixed at compile time: the values are stored
+// inline (on the stack for local matrices), the element loops are unrolled
+// over the constant dimensions and mismatching dimensions of operands do not
+// compile. Small square matrices use closed-form determinants and inverses.
+// Conversions to and from S21Matrix allow mixing both kinds.
+
+namespace s21 {
+
+// calls f(0), f(1), ..., f(N - 1) as one unrolled sequence
+template <class F, std::size_t... I>
+constexpr void UnrollImpl(F &&f, std::index_sequence<I...>) {
+  (f(I), ...);
+}
+
+template <std::size_t N, class F>
+constexpr void Unroll(F &&f) {
+  UnrollImpl(f, std::make_index_sequence<N>());
+}
+
+}  // namespace s21
+
+template <int R, int C>
+class S21FixedMatrix {
+  static_assert(R > 0 && C > 0,
+                "The number of rows and columns must be greater than 0");
+
+  template <int, int>
+  friend class S21FixedMatrix;
+
+ public:
+  static constexpr int kRows = R;
+  static constexpr int kCols = C;
+
+  // zero matrix
+  constexpr S21FixedMatrix() noexcept : matrix_() {}
+  // values in row-major order, the missing ones are zero
+  constexpr S21FixedMatrix(std::initializer_list<double> values) : matrix_() {
+    if (values.size() > static_cast<std::size_t>(R * C))
+      throw std::invalid_argument("Too many values for the matrix");
+    int index = 0;
+    for (double value : values) matrix_[index++] = value;
+  }
+  // conversion from a matrix of the same dimensions
+  explicit S21FixedMatrix(const S21Matrix &other) : matrix_() {
+    if (other.rows_ != R || other.cols_ != C)
+      throw std::invalid_argument("Matrices should have the same size");
+    for (auto i = 0; i < R; ++i)
+      for (auto j = 0; j < C; ++j) At(i, j) = other.RowPtr(i)[j];
+  }
+  // conversion to a heap matrix
+  explicit operator S21Matrix() const {
+    S21Matrix result(R, C);
+    for (auto i = 0; i < R; ++i)
+      for (auto j = 0; j < C; ++j) result.RowPtr(i)[j] = At(i, j);
+    return result;
+  }
+
+  static constexpr S21FixedMatrix Identity() noexcept {
+    static_assert(R == C, "The matrix is not square");
+    S21FixedMatrix result;
+    s21::Unroll<R>([&](std::size_t i) { result.matrix_[i * C + i] = 1; });
+    return result;
+  }
+
+  // operators overloads
+  constexpr bool operator==(const S21FixedMatrix &other) const noexcept {
+    return EqMatrix(other);
+  }
+  constexpr double operator()(int row, int col) const {
+    CheckIndex(row, col);
+    return At(row, col);
+  }
+  constexpr S21FixedMatrix &operator+=(const S21FixedMatrix &other) noexcept {
+    SumMatrix(other);
+    return *this;
+  }
+  constexpr S21FixedMatrix &operator-=(const S21FixedMatrix &other) noexcept {
+    SubMatrix(other);
+    return *this;
+  }
+  // only a square right operand keeps the dimensions
+  constexpr S21FixedMatrix &operator*=(
+      const S21FixedMatrix<C, C> &other) noexcept {
+    MulMatrix(other);
+    return *this;
+  }
+  constexpr S21FixedMatrix &operator*=(const double num) noexcept {
+    MulNumber(num);
+    return *this;
+  }
+
+  // public methods
+  constexpr bool EqMatrix(const S21FixedMatrix &other) const noexcept {
+    bool equality = true;
+    s21::Unroll<R * C>([&](std::size_t i) {
+      equality = equality && matrix_[i] == other.matrix_[i];
+    });
+    return equality;
+  }
+  constexpr void SumMatrix(const S21FixedMatrix &other) noexcept {
+    s21::Unroll<R * C>([&](std::size_t i) { matrix_[i] += other.matrix_[i]; });
+  }
+  constexpr void SubMatrix(const S21FixedMatrix &other) noexcept {
+    s21::Unroll<R * C>([&](std::size_t i) { matrix_[i] -= other.matrix_[i]; });
+  }
+  constexpr void MulNumber(const double num) noexcept {
+    s21::Unroll<R * C>([&](std::size_t i) { matrix_[i] *= num; });
+  }
+  constexpr void MulMatrix(const S21FixedMatrix<C, C> &other) noexcept {
+    *this = Product(other);
+  }
+  // the product with a matrix of K columns is a matrix of R x K
+  template <int K>
+  constexpr S21FixedMatrix<R, K> Product(
+      const S21FixedMatrix<C, K> &other) const noexcept {
+    S21FixedMatrix<R, K> result;
+    s21::Unroll<R * K>([&](std::size_t index) {
+      const std::size_t i = index / K, j = index % K;
+      double sum = 0;
+      s21::Unroll<C>([&](std::size_t k) {
+        sum += matrix_[i * C + k] * other.matrix_[k * K + j];
+      });
+      result.matrix_[index] = sum;
+    });
+    return result;
+  }
+  constexpr S21FixedMatrix<C, R> Transpose() const noexcept {
+    S21FixedMatrix<C, R> result;
+    s21::Unroll<R * C>([&](std::size_t index) {
+      const std::size_t i = index / C, j = index % C;
+      result.matrix_[j * R + i] = matrix_[index];
+    });
+    return result;
+  }
+  S21FixedMatrix CalcComplements() const;
+  double Determinant() const;
+  S21FixedMatrix InverseMatrix() const;
+  S21FixedMatrix<R - 1, C - 1> MinorMatrix(int rm_row, int rm_col) const;
+
+  // getters
+  static constexpr int GetRows() noexcept { return R; }
+  static constexpr int GetCols() noexcept { return C; }
+  constexpr double GetValue(int row, int col) const {
+    CheckIndex(row, col);
+    return At(row, col);
+  }
+
+  // setters
+  constexpr void SetValue(int row, int col, double value) {
+    CheckIndex(row, col);
+    At(row, col) = value;
+  }
+
+ private:
+  // the largest order with a closed-form inverse
+  static constexpr int kClosedFormMaxOrder = 4;
+
+  double matrix_[R * C];  // row-major values
+
+  constexpr double &At(int row, int col) noexcept {
+    return matrix_[row * C + col];
+  }
+  constexpr const double &At(int row, int col) const noexcept {
+    return matrix_[row * C + col];
+  }
+  static constexpr void CheckIndex(int row, int col) {
+    if (row < 0 || R <= row)
+      throw std::out_of_range("The row index is incorrect");
+    if (col < 0 || C <= col)
+      throw std::out_of_range("The column index is incorrect");
+  }
+
+  double EliminationDeterminant() const noexcept;
+  S21FixedMatrix EliminationInverse() const;
+  S21FixedMatrix<4, 4> ClosedFormInverse4() const;
+};
+
+// the free operators produce a new matrix, the dimensions of the operands
+// are checked by the compiler
+
+template <int R, int C>
+constexpr S21FixedMatrix<R, C> operator+(S21FixedMatrix<R, C> lhs,
+                                         const S21FixedMatrix<R, C> &rhs) {
+  lhs.SumMatrix(rhs);
+  return lhs;
+}
+
+template <int R, int C>
+constexpr S21FixedMatrix<R, C> operator-(S21FixedMatrix<R, C> lhs,
+                                         const S21FixedMatrix<R, C> &rhs) {
+  lhs.SubMatrix(rhs);
+  return lhs;
+}
+
+template <int R, int C, int K>
+constexpr S21FixedMatrix<R, K> operator*(const S21FixedMatrix<R, C> &lhs,
+                                         const S21FixedMatrix<C, K> &rhs) {
+  return lhs.Product(rhs);
+}
+
+template <int R, int C>
+constexpr S21FixedMatrix<R, C> operator*(S21FixedMatrix<R, C> lhs,
+                                         const double num) {
+  lhs.MulNumber(num);
+  return lhs;
+}
+
+template <int R, int C>
+constexpr S21FixedMatrix<R, C> operator*(const double num,
+                                         S21FixedMatrix<R, C> rhs) {
+  rhs.MulNumber(num);
+  return rhs;
+}
+
+// the matrix without the row rm_row and the column rm_col
+template <int R, int C>
+S21FixedMatrix<R - 1, C - 1> S21FixedMatrix<R, C>::MinorMatrix(
+    int rm_row, int rm_col) const {
+  static_assert(R == C, "The matrix is not square");
+  static_assert(R > 1, "A matrix of order 1 has no minors");
+  CheckIndex(rm_row, rm_col);
+  S21FixedMatrix<R - 1, C - 1> minor_mx;
+  for (auto i = 0, minor_i = 0; i < R; ++i) {
+    if (i == rm_row) continue;
+    for (auto j = 0, minor_j = 0; j < C; ++j)
+      if (j != rm_col) minor_mx.At(minor_i, minor_j++) = At(i, j);
+    ++minor_i;
+  }
+  return minor_mx;
+}
+
+// closed forms up to order 3, Gaussian elimination on a copy above
+template <int R, int C>
+double S21FixedMatrix<R, C>::Determinant() const {
+  static_assert(R == C, "The matrix is not square");
+  const double *m = matrix_;
+  if constexpr (R == 1) {
+    return m[0];
+  } else if constexpr (R == 2) {
+    return m[0] * m[3] - m[1] * m[2];
+  } else if constexpr (R == 3) {
+    return m[0] * (m[4] * m[8] - m[5] * m[7]) -
+           m[1] * (m[3] * m[8] - m[5] * m[6]) +
+           m[2] * (m[3] * m[7] - m[4] * m[6]);
+  } else {
+    return EliminationDeterminant();
+  }
+}
+
+// matrix of algebraic complements (cofactors), [1] for the order 1
+template <int R, int C>
+S21FixedMatrix<R, C> S21FixedMatrix<R, C>::CalcComplements() const {
+  static_assert(R == C, "The matrix is not square");
+  S21FixedMatrix calc_mx;
+  if constexpr (R == 1) {
+    calc_mx.matrix_[0] = 1;
+  } else {
+    for (auto row = 0; row < R; ++row)
+      for (auto col = 0; col < C; ++col)
+        calc_mx.At(row, col) =
+            ((row + col) % 2 ? -1 : 1) * MinorMatrix(row, col).Determinant();
+  }
+  return calc_mx;
+}
+
+// closed forms (the adjugate divided by the determinant) up to order 4,
+// Gauss-Jordan elimination on a copy above
+template <int R, int C>
+S21FixedMatrix<R, C> S21FixedMatrix<R, C>::InverseMatrix() const {
+  static_assert(R == C, "The matrix is not square");
+  if constexpr (R > kClosedFormMaxOrder) {
+    return EliminationInverse();
+  } else if constexpr (R == 4) {
+    return ClosedFormInverse4();
+  } else {
+    double det = Determinant();
+    if (!det)
+      throw std::invalid_argument("The determinant of the matrix is 0");
+    S21FixedMatrix inverse_mx;
+    if constexpr (R == 1) {
+      inverse_mx.matrix_[0] = 1 / det;
+    } else {
+      inverse_mx = CalcComplements().Transpose();
+      inverse_mx.MulNumber(1 / det);
+    }
+    return inverse_mx;
+  }
+}
+
+// the inverse of order 4 from the six 2x2 minors of the upper and the lower
+// halves of the matrix, the determinant comes from the same minors
+template <int R, int C>
+S21FixedMatrix<4, 4> S21FixedMatrix<R, C>::ClosedFormInverse4() const {
+  const double *m = matrix_;
+  const double s0 = m[0] * m[5] - m[4] * m[1];
+  const double s1 = m[0] * m[6] - m[4] * m[2];
+  const double s2 = m[0] * m[7] - m[4] * m[3];
+  const double s3 = m[1] * m[6] - m[5] * m[2];
+  const double s4 = m[1] * m[7] - m[5] * m[3];
+  const double s5 = m[2] * m[7] - m[6] * m[3];
+  const double c5 = m[10] * m[15] - m[14] * m[11];
+  const double c4 = m[9] * m[15] - m[13] * m[11];
+  const double c3 = m[9] * m[14] - m[13] * m[10];
+  const double c2 = m[8] * m[15] - m[12] * m[11];
+  const double c1 = m[8] * m[14] - m[12] * m[10];
+  const double c0 = m[8] * m[13] - m[12] * m[9];
+  const double det =
+      s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+  if (!det) throw std::invalid_argument("The determinant of the matrix is 0");
+  const double inv = 1 / det;
+  return S21FixedMatrix<4, 4>{
+      (m[5] * c5 - m[6] * c4 + m[7] * c3) * inv,
+      (-m[1] * c5 + m[2] * c4 - m[3] * c3) * inv,
+      (m[13] * s5 - m[14] * s4 + m[15] * s3) * inv,
+      (-m[9] * s5 + m[10] * s4 - m[11] * s3) * inv,
+      (-m[4] * c5 + m[6] * c2 - m[7] * c1) * inv,
+      (m[0] * c5 - m[2] * c2 + m[3] * c1) * inv,
+      (-m[12] * s5 + m[14] * s2 - m[15] * s1) * inv,
+      (m[8] * s5 - m[10] * s2 + m[11] * s1) * inv,
+      (m[4] * c4 - m[5] * c2 + m[7] * c0) * inv,
+      (-m[0] * c4 + m[1] * c2 - m[3] * c0) * inv,
+      (m[12] * s4 - m[13] * s2 + m[15] * s0) * inv,
+      (-m[8] * s4 + m[9] * s2 - m[11] * s0) * inv,
+      (-m[4] * c3 + m[5] * c1 - m[6] * c0) * inv,
+      (m[0] * c3 - m[1] * c1 + m[2] * c0) * inv,
+      (-m[12] * s3 + m[13] * s1 - m[14] * s0) * inv,
+      (m[8] * s3 - m[9] * s1 + m[10] * s0) * inv};
+}
+
+// elimination with partial pivoting, the determinant is the signed product
+// of the pivots
+template <int R, int C>
+double S21FixedMatrix<R, C>::EliminationDeterminant() const noexcept {
+  S21FixedMatrix lu = *this;
+  double det = 1;
+  for (auto k = 0; k < R; ++k) {
+    int pivot = k;
+    for (auto i = k + 1; i < R; ++i)
+      if (std::fabs(lu.At(i, k)) > std::fabs(lu.At(pivot, k))) pivot = i;
+    if (!lu.At(pivot, k)) return 0;
+    if (pivot != k) {
+      for (auto j = k; j < C; ++j) std::swap(lu.At(k, j), lu.At(pivot, j));
+      det = -det;
+    }
+    det *= lu.At(k, k);
+    for (auto i = k + 1; i < R; ++i) {
+      const double factor = lu.At(i, k) / lu.At(k, k);
+      for (auto j = k + 1; j < C; ++j) lu.At(i, j) -= factor * lu.At(k, j);
+    }
+  }
+  return det;
+}
+
+// Gauss-Jordan elimination with partial pivoting applied to the identity
+template <int R, int C>
+S21FixedMatrix<R, C> S21FixedMatrix<R, C>::EliminationInverse() const {
+  S21FixedMatrix lu = *this, inverse_mx = Identity();
+  for (auto k = 0; k < R; ++k) {
+    int pivot = k;
+    for (auto i = k + 1; i < R; ++i)
+      if (std::fabs(lu.At(i, k)) > std::fabs(lu.At(pivot, k))) pivot = i;
+    if (!lu.At(pivot, k))
+      throw std::invalid_argument("The determinant of the matrix is 0");
+    for (auto j = 0; j < C; ++j) {
+      std::swap(lu.At(k, j), lu.At(pivot, j));
+      std::swap(inverse_mx.At(k, j), inverse_mx.At(pivot, j));
+    }
+    const double scale = 1 / lu.At(k, k);
+    for (auto j = 0; j < C; ++j) {
+      lu.At(k, j) *= scale;
+      inverse_mx.At(k, j) *= scale;
+    }
+    for (auto i = 0; i < R; ++i) {
+      if (i == k || !lu.At(i, k)) continue;
+      const double factor = lu.At(i, k);
+      for (auto j = 0; j < C; ++j) {
+        lu.At(i, j) -= factor * lu.At(k, j);
+        inverse_mx.At(i, j) -= factor * inverse_mx.At(k, j);
+      }
+    }
+  }
+  return inverse_mx;
+}
+
+#endif  // SRC_S21_FIXED_MATRIX_H_
@@ -0,0 +1,149 @@
+#include "s21_gemm.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "s21_simd.h"
+#include "s21_thread_pool.h"
+
+namespace s21 {
+
+namespace {
+
+// the micro-kernel keeps an kMR x kNR tile of C in registers
+constexpr int kMR = kGemmMR;
+constexpr int kNR = kGemmNR;
+// a kMR x kKC sliver of A and a kKC x kNR sliver of B stay in L1
+constexpr int kKC = 256;
+// a packed kMC x kKC block of A stays in L2
+constexpr int kMC = 128;
+// a packed kKC x kNC panel of B stays in L3
+constexpr int kNC = 4096;
+// products with fewer multiply-adds are not worth packing
+constexpr long long kDirectMaxFlops = 32 * 32 * 32;
+// products with fewer multiply-adds are not worth waking the thread pool
+constexpr long long kParallelMinFlops = 96 * 96 * 96;
+
+// C += alpha * A * B with the loop order that streams rows of B and C
+void DirectGemm(int m, int n, int k, double alpha, const double *a, int lda,
+                const double *b, int ldb, double *c, int ldc) {
+  for (auto i = 0; i < m; ++i) {
+    double *c_row = c + static_cast<std::ptrdiff_t>(i) * ldc;
+    const double *a_row = a + static_cast<std::ptrdiff_t>(i) * lda;
+    for (auto p = 0; p < k; ++p) {
+      const double a_ip = alpha * a_row[p];
+      const double *b_row = b + static_cast<std::ptrdiff_t>(p) * ldb;
+      for (auto j = 0; j < n; ++j) c_row[j] += a_ip * b_row[j];
+    }
+  }
+}
+
+// copies an mc x kc block of A into slivers of kMR rows stored column by
+// column, the rows missing in the last sliver are filled with zeros
+void PackA(int mc, int kc, const double *a, int lda, double *packed) {
+  for (auto i = 0; i < mc; i += kMR) {
+    const int mr = std::min(kMR, mc - i);
+    for (auto p = 0; p < kc; ++p) {
+      for (auto ii = 0; ii < mr; ++ii)
+        packed[ii] = a[static_cast<std::ptrdiff_t>(i + ii) * lda + p];
+      for (auto ii = mr; ii < kMR; ++ii) packed[ii] = 0;
+      packed += kMR;
+    }
+  }
+}
+
+// copies a kc x nc panel of B into slivers of kNR columns stored row by
+// row, the columns missing in the last sliver are filled with zeros
+void PackB(int kc, int nc, const double *b, int ldb, double *packed) {
+  for (auto j = 0; j < nc; j += kNR) {
+    const int nr = std::min(kNR, nc - j);
+    for (auto p = 0; p < kc; ++p) {
+      const double *b_row = b + static_cast<std::ptrdiff_t>(p) * ldb + j;
+      for (auto jj = 0; jj < nr; ++jj) packed[jj] = b_row[jj];
+      for (auto jj = nr; jj < kNR; ++jj) packed[jj] = 0;
+      packed += kNR;
+    }
+  }
+}
+
+// the mr x nr corner of the tile C += alpha * (packed sliver of A) *
+// (packed sliver of B), the whole kMR x kNR tile is accumulated by the
+// dispatched kernel
+void MicroKernel(int kc, double alpha, const double *a, const double *b,
+                 double *c, int ldc, int mr, int nr) {
+  alignas(64) double acc[kMR * kNR];
+  Simd().gemm_tile(kc, a, b, acc);
+  for (auto i = 0; i < mr; ++i) {
+    double *c_row = c + static_cast<std::ptrdiff_t>(i) * ldc;
+    for (auto j = 0; j < nr; ++j) c_row[j] += alpha * acc[i * kNR + j];
+  }
+}
+
+// multiplies a packed block of A by a packed panel of B tile by tile
+void MacroKernel(int mc, int nc, int kc, double alpha, const double *packed_a,
+                 const double *packed_b, double *c, int ldc) {
+  for (auto j = 0; j < nc; j += kNR) {
+    const int nr = std::min(kNR, nc - j);
+    const double *b_sliver = packed_b + static_cast<std::ptrdiff_t>(j) * kc;
+    for (auto i = 0; i < mc; i += kMR) {
+      const int mr = std::min(kMR, mc - i);
+      MicroKernel(kc, alpha, packed_a + static_cast<std::ptrdiff_t>(i) * kc,
+                  b_sliver, c + static_cast<std::ptrdiff_t>(i) * ldc + j, ldc,
+                  mr, nr);
+    }
+  }
+}
+
+}  // namespace
+
+void Gemm(int m, int n, int k, double alpha, const double *a, int lda,
+          const double *b, int ldb, double *c, int ldc) {
+  if (m <= 0 || n <= 0 || k <= 0 || alpha == 0) return;
+  const long long flops = static_cast<long long>(m) * n * k;
+  if (flops <= kDirectMaxFlops) {
+    DirectGemm(m, n, k, alpha, a, lda, b, ldb, c, ldc);
+    return;
+  }
+  // with several threads the rows are split so that every thread gets a
+  // block, but a block never outgrows L2
+  int mc_block = kMC;
+  const int threads = flops < kParallelMinFlops ? 1 : GetNumThreads();
+  if (threads > 1) {
+    const int rows_per_thread = (m + threads - 1) / threads;
+    mc_block = std::min(kMC, (rows_per_thread + kMR - 1) / kMR * kMR);
+  }
+  const int m_blocks = (m + mc_block - 1) / mc_block;
+  const int nc_max = std::min(kNC, (n + kNR - 1) / kNR * kNR);
+  const int kc_max = std::min(kKC, k);
+  std::vector<double> packed_b(static_cast<std::size_t>(kc_max) * nc_max);
+  // loops around the macro-kernel: panels of B, then the shared dimension,
+  // then blocks of A, so every packed block is reused from its cache level
+  for (auto jc = 0; jc < n; jc += kNC) {
+    const int nc = std::min(kNC, n - jc);
+    for (auto pc = 0; pc < k; pc += kKC) {
+      const int kc = std::min(kKC, k - pc);
+      PackB(kc, nc, b + static_cast<std::ptrdiff_t>(pc) * ldb + jc, ldb,
+            packed_b.data());
+      auto row_blocks = [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        // every thread packs its blocks of A into its own buffer
+        thread_local std::vector<double> packed_a;
+        packed_a.resize(static_cast<std::size_t>(mc_block) * kc_max);
+        for (auto block = first; block < last; ++block) {
+          const int ic = static_cast<int>(block) * mc_block;
+          const int mc = std::min(mc_block, m - ic);
+          PackA(mc, kc, a + static_cast<std::ptrdiff_t>(ic) * lda + pc, lda,
+                packed_a.data());
+          MacroKernel(mc, nc, kc, alpha, packed_a.data(), packed_b.data(),
+                      c + static_cast<std::ptrdiff_t>(ic) * ldc + jc, ldc);
+        }
+      };
+      if (threads > 1)
+        ParallelFor(m_blocks, 1, row_blocks);
+      else
+        row_blocks(0, m_blocks);
+    }
+  }
+}
+
+}  // namespace s21
@@ -0,0 +1,16 @@
+#ifndef SRC_S21_GEMM_H_
+#define SRC_S21_GEMM_H_
+
+namespace s21 {
+
+// C += alpha * A * B for row-major operands given by the first element and
+// the leading dimension (distance between rows): A is m x k, B is k x n, C
+// is m x n. Large products are packed into cache-sized blocks and computed
+// by a register-tiled micro-kernel, blocks of rows of C are distributed over
+// the thread pool; small products use a direct loop.
+void Gemm(int m, int n, int k, double alpha, const double *a, int lda,
+          const double *b, int ldb, double *c, int ldc);
+
+}  // namespace s21
+
+#endif  // SRC_S21_GEMM_H_
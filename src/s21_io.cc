@@ -0,0 +1,430 @@
+#include "s21_io.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <climits>
+#include <fstream>
+#include <vector>
+
+namespace s21 {
+
+// the access to the storage of S21Matrix for the files
+class MatrixFile {
+ public:
+  static MatrixFileHeader Header(int rows, int cols, int stride,
+                                 std::uint64_t checksum) noexcept;
+  static MatrixFileHeader Header(const S21Matrix &matrix);
+  static int Stride(int cols) noexcept;
+  static std::uint64_t Checksum(const S21Matrix &matrix) noexcept;
+  static void Write(const S21Matrix &matrix, std::ostream &out);
+  static S21Matrix Read(std::istream &in, std::pmr::memory_resource *resource);
+  static S21Matrix ReadRows(std::istream &in, const MatrixFileHeader &header,
+                            std::pmr::memory_resource *resource);
+  static S21Matrix ReadChunks(std::istream &in, const MatrixFileHeader &header,
+                              std::pmr::memory_resource *resource);
+  static S21Matrix Empty() noexcept;
+  static void Attach(S21Matrix &matrix, const MatrixFileHeader &header,
+                     const char *file);
+  static void Detach(S21Matrix &matrix) noexcept;
+};
+
+namespace {
+
+constexpr char kMagic[8] = {'S', '2', '1', 'M', 'A', 'T', 'R', 'X'};
+// the first row is aligned like the buffers of S21Matrix
+constexpr std::uint64_t kDataOffset = 64;
+
+// the number of elements a stream of unknown length is read by
+constexpr std::size_t kReadChunk = std::size_t(1) << 16;
+
+// XXH64 primes
+constexpr std::uint64_t kPrime1 = 11400714785074694791ull;
+constexpr std::uint64_t kPrime2 = 14029467366897019727ull;
+constexpr std::uint64_t kPrime3 = 1609587929392839161ull;
+constexpr std::uint64_t kPrime4 = 9650029242287828579ull;
+constexpr std::uint64_t kPrime5 = 2870177450012600261ull;
+
+std::uint64_t RotateLeft(std::uint64_t x, int bits) noexcept {
+  return (x << bits) | (x >> (64 - bits));
+}
+
+std::uint64_t Load64(const unsigned char *p) noexcept {
+  std::uint64_t value;
+  std::memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+std::uint32_t Load32(const unsigned char *p) noexcept {
+  std::uint32_t value;
+  std::memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+std::uint64_t Round(std::uint64_t acc, std::uint64_t input) noexcept {
+  return RotateLeft(acc + input * kPrime2, 31) * kPrime1;
+}
+
+std::uint64_t Merge(std::uint64_t acc, std::uint64_t value) noexcept {
+  return (acc ^ Round(0, value)) * kPrime1 + kPrime4;
+}
+
+bool LittleEndian() noexcept {
+  const std::uint16_t probe = 1;
+  unsigned char first;
+  std::memcpy(&first, &probe, 1);
+  return first == 1;
+}
+
+[[noreturn]] void Fail(const std::string &message) {
+  throw std::runtime_error(message);
+}
+
+// the bytes left in the stream, -1 when it cannot seek
+std::streamoff Remaining(std::istream &in) {
+  const std::istream::pos_type position = in.tellg();
+  if (position == std::istream::pos_type(-1)) return -1;
+  in.seekg(0, std::ios::end);
+  const std::istream::pos_type end = in.tellg();
+  in.clear();
+  in.seekg(position);
+  if (end == std::istream::pos_type(-1)) return -1;
+  return end - position;
+}
+
+// the checks of the header that do not need the file size, returns the
+// number of bytes of the rows
+std::uint64_t Validate(const MatrixFileHeader &header) {
+  if (!LittleEndian()) Fail("Only little-endian hosts are supported");
+  if (std::memcmp(header.magic, kMagic, sizeof(kMagic)))
+    Fail("The file is not a matrix file");
+  if (header.version != kMatrixFileVersion)
+    Fail("The version of the matrix file is not supported");
+  if (header.dtype != DType::kFloat64)
+    Fail("The element type of the matrix file is not supported");
+  if (header.rows < 1 || header.rows > INT_MAX || header.cols < 1 ||
+      header.cols > INT_MAX || header.stride < header.cols ||
+      header.stride > INT_MAX)
+    Fail("The dimensions of the matrix file are incorrect");
+  if (header.data_offset < sizeof(MatrixFileHeader) ||
+      header.data_offset % kDataOffset)
+    Fail("The data offset of the matrix file is incorrect");
+  const auto elements = static_cast<std::uint64_t>(header.rows) *
+                        static_cast<std::uint64_t>(header.stride);
+  if (elements > (UINT64_MAX - header.data_offset) / sizeof(double))
+    Fail("The dimensions of the matrix file are incorrect");
+  return elements * sizeof(double);
+}
+
+}  // namespace
+
+std::uint64_t Hash64(const void *data, std::size_t bytes,
+                     std::uint64_t seed) noexcept {
+  Hasher64 hasher(seed);
+  hasher.Update(data, bytes);
+  return hasher.Digest();
+}
+
+// HASHER
+
+Hasher64::Hasher64(std::uint64_t seed) noexcept
+    : seed_(seed),
+      lanes_{seed + kPrime1 + kPrime2, seed + kPrime2, seed, seed - kPrime1},
+      total_(0),
+      buffer_(),
+      buffered_(0) {}
+
+// the input is consumed in stripes of 32 bytes, the rest waits in the buffer
+void Hasher64::Update(const void *data, std::size_t bytes) noexcept {
+  const auto *p = static_cast<const unsigned char *>(data);
+  const unsigned char *const end = p + bytes;
+  total_ += bytes;
+  if (buffered_ + bytes < sizeof(buffer_)) {
+    if (bytes) std::memcpy(buffer_ + buffered_, p, bytes);
+    buffered_ += bytes;
+    return;
+  }
+  if (buffered_) {
+    const std::size_t fill = sizeof(buffer_) - buffered_;
+    std::memcpy(buffer_ + buffered_, p, fill);
+    p += fill;
+    for (auto lane = 0; lane < 4; ++lane)
+      lanes_[lane] = Round(lanes_[lane], Load64(buffer_ + lane * 8));
+    buffered_ = 0;
+  }
+  for (; p + 32 <= end; p += 32)
+    for (auto lane = 0; lane < 4; ++lane)
+      lanes_[lane] = Round(lanes_[lane], Load64(p + lane * 8));
+  buffered_ = end - p;
+  if (buffered_) std::memcpy(buffer_, p, buffered_);
+}
+
+std::uint64_t Hasher64::Digest() const noexcept {
+  std::uint64_t hash;
+  if (total_ >= 32) {
+    hash = RotateLeft(lanes_[0], 1) + RotateLeft(lanes_[1], 7) +
+           RotateLeft(lanes_[2], 12) + RotateLeft(lanes_[3], 18);
+    for (auto lane = 0; lane < 4; ++lane) hash = Merge(hash, lanes_[lane]);
+  } else {
+    hash = seed_ + kPrime5;
+  }
+  hash += total_;
+  const unsigned char *p = buffer_;
+  const unsigned char *const end = buffer_ + buffered_;
+  for (; p + 8 <= end; p += 8)
+    hash = RotateLeft(hash ^ Round(0, Load64(p)), 27) * kPrime1 + kPrime4;
+  if (p + 4 <= end) {
+    hash = RotateLeft(hash ^ (Load32(p) * kPrime1), 23) * kPrime2 + kPrime3;
+    p += 4;
+  }
+  for (; p < end; ++p)
+    hash = RotateLeft(hash ^ (*p * kPrime5), 11) * kPrime1;
+  hash ^= hash >> 33;
+  hash *= kPrime2;
+  hash ^= hash >> 29;
+  hash *= kPrime3;
+  return hash ^ (hash >> 32);
+}
+
+// MATRIX FILE
+
+MatrixFileHeader MatrixFile::Header(int rows, int cols, int stride,
+                                    std::uint64_t checksum) noexcept {
+  MatrixFileHeader header = MatrixFileHeader();
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kMatrixFileVersion;
+  header.dtype = DType::kFloat64;
+  header.rows = rows;
+  header.cols = cols;
+  header.stride = stride;
+  header.data_offset = kDataOffset;
+  header.checksum = checksum;
+  return header;
+}
+
+MatrixFileHeader MatrixFile::Header(const S21Matrix &matrix) {
+  return Header(matrix.rows_, matrix.cols_, matrix.stride_, Checksum(matrix));
+}
+
+int MatrixFile::Stride(int cols) noexcept {
+  return S21Matrix::CalcStride(cols);
+}
+
+// the padding of the rows is not hashed, it is written as zeros
+std::uint64_t MatrixFile::Checksum(const S21Matrix &matrix) noexcept {
+  std::uint64_t hash = 0;
+  for (auto i = 0; i < matrix.rows_; ++i)
+    hash = Hash64(matrix.RowPtr(i), matrix.cols_ * sizeof(double), hash);
+  return hash;
+}
+
+void MatrixFile::Write(const S21Matrix &matrix, std::ostream &out) {
+  if (!LittleEndian()) Fail("Only little-endian hosts are supported");
+  const MatrixFileHeader header = Header(matrix);
+  out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  const std::vector<double> padding(matrix.stride_ - matrix.cols_);
+  for (auto i = 0; i < matrix.rows_; ++i) {
+    out.write(reinterpret_cast<const char *>(matrix.RowPtr(i)),
+              matrix.cols_ * sizeof(double));
+    out.write(reinterpret_cast<const char *>(padding.data()),
+              padding.size() * sizeof(double));
+  }
+  if (!out) Fail("The matrix could not be written");
+}
+
+// the shape of the header is checked against the bytes left in the stream
+// before the matrix is allocated; a stream that cannot tell them, like a
+// pipe, is read in chunks of bounded size, so a header claiming more rows
+// than the stream has fails when the stream ends
+S21Matrix MatrixFile::Read(std::istream &in,
+                           std::pmr::memory_resource *resource) {
+  MatrixFileHeader header;
+  if (!in.read(reinterpret_cast<char *>(&header), sizeof(header)))
+    Fail("The header of the matrix file could not be read");
+  const std::uint64_t bytes = Validate(header);
+  const std::streamoff remaining = Remaining(in);
+  if (remaining >= 0 && header.data_offset - sizeof(header) + bytes >
+                            static_cast<std::uint64_t>(remaining))
+    Fail("The matrix file is truncated");
+  in.ignore(header.data_offset - sizeof(header));
+  S21Matrix result = remaining >= 0 ? ReadRows(in, header, resource)
+                                    : ReadChunks(in, header, resource);
+  if (Checksum(result) != header.checksum)
+    Fail("The checksum of the matrix file does not match");
+  return result;
+}
+
+// the rows with the stride of the matrix are read at once, the others row
+// by row
+S21Matrix MatrixFile::ReadRows(std::istream &in, const MatrixFileHeader &header,
+                               std::pmr::memory_resource *resource) {
+  S21Matrix result(static_cast<int>(header.rows),
+                   static_cast<int>(header.cols), resource);
+  if (header.stride == result.stride_) {
+    in.read(reinterpret_cast<char *>(result.matrix_),
+            static_cast<std::streamsize>(result.rows_) * result.stride_ *
+                sizeof(double));
+  } else {
+    for (auto i = 0; i < result.rows_ && in; ++i) {
+      in.read(reinterpret_cast<char *>(result.RowPtr(i)),
+              result.cols_ * sizeof(double));
+      in.ignore((header.stride - header.cols) * sizeof(double));
+    }
+  }
+  if (!in) Fail("The rows of the matrix file could not be read");
+  // the padding of the file is not trusted
+  for (auto i = 0; i < result.rows_; ++i)
+    std::fill(result.RowPtr(i) + result.cols_,
+              result.RowPtr(i) + result.stride_, 0.0);
+  return result;
+}
+
+// the elements are gathered into a buffer that grows only by what the
+// stream has delivered, the matrix is allocated once all of them are read
+S21Matrix MatrixFile::ReadChunks(std::istream &in,
+                                 const MatrixFileHeader &header,
+                                 std::pmr::memory_resource *resource) {
+  const auto cols = static_cast<std::size_t>(header.cols);
+  std::vector<double> elements;
+  for (std::int64_t i = 0; i < header.rows; ++i) {
+    for (std::size_t read = 0; read < cols;) {
+      const std::size_t count = std::min(cols - read, kReadChunk);
+      const std::size_t size = elements.size();
+      elements.resize(size + count);
+      if (!in.read(reinterpret_cast<char *>(elements.data() + size),
+                   static_cast<std::streamsize>(count * sizeof(double))))
+        Fail("The rows of the matrix file could not be read");
+      read += count;
+    }
+    in.ignore((header.stride - header.cols) * sizeof(double));
+  }
+  S21Matrix result(static_cast<int>(header.rows),
+                   static_cast<int>(header.cols), resource);
+  for (auto i = 0; i < result.rows_; ++i)
+    std::copy_n(elements.data() + i * cols, cols, result.RowPtr(i));
+  return result;
+}
+
+S21Matrix MatrixFile::Empty() noexcept { return S21Matrix(nullptr); }
+
+// the empty matrix takes over the view with its null memory resource, which
+// an assignment would not do
+void MatrixFile::Attach(S21Matrix &matrix, const MatrixFileHeader &header,
+                        const char *file) {
+  auto *rows = reinterpret_cast<double *>(
+      const_cast<char *>(file + header.data_offset));
+  S21Matrix view(rows, static_cast<int>(header.rows),
+                 static_cast<int>(header.cols),
+                 static_cast<int>(header.stride));
+  matrix.SwapStorage(view);
+}
+
+// the view forgets the mapped rows before they are unmapped
+void MatrixFile::Detach(S21Matrix &matrix) noexcept {
+  matrix.matrix_ = nullptr;
+}
+
+// SAVING AND LOADING
+
+void SaveMatrix(const S21Matrix &matrix, std::ostream &out) {
+  MatrixFile::Write(matrix, out);
+}
+
+void SaveMatrix(const S21Matrix &matrix, const std::string &path) {
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out) Fail("The file " + path + " could not be created");
+  MatrixFile::Write(matrix, out);
+  out.close();
+  if (!out) Fail("The file " + path + " could not be written");
+}
+
+MatrixFileHeader MakeMatrixHeader(int rows, int cols,
+                                  std::uint64_t checksum) {
+  if (rows < 1 || cols < 1)
+    throw std::invalid_argument(
+        "The number of rows and columns must be greater than 1");
+  return MatrixFile::Header(rows, cols, MatrixFile::Stride(cols), checksum);
+}
+
+MatrixFileHeader ReadMatrixHeader(const std::string &path) {
+  std::ifstream in(path, std::ios::binary | std::ios::ate);
+  if (!in) Fail("The file " + path + " could not be opened");
+  const auto length = static_cast<std::uint64_t>(in.tellg());
+  MatrixFileHeader header;
+  in.seekg(0);
+  if (!in.read(reinterpret_cast<char *>(&header), sizeof(header)))
+    Fail("The header of the matrix file could not be read");
+  const std::uint64_t bytes = Validate(header);
+  if (header.data_offset + bytes > length)
+    Fail("The matrix file is truncated");
+  return header;
+}
+
+S21Matrix LoadMatrix(std::istream &in, std::pmr::memory_resource *resource) {
+  return MatrixFile::Read(in, resource);
+}
+
+S21Matrix LoadMatrix(const std::string &path,
+                     std::pmr::memory_resource *resource) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) Fail("The file " + path + " could not be opened");
+  return MatrixFile::Read(in, resource);
+}
+
+}  // namespace s21
+
+// MAPPED MATRIX
+
+S21MappedMatrix::S21MappedMatrix(const std::string &path, bool verify)
+    : mapping_(MAP_FAILED),
+      length_(0),
+      matrix_(s21::MatrixFile::Empty()) {
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) s21::Fail("The file " + path + " could not be opened");
+  struct stat status;
+  if (::fstat(fd, &status) == 0 &&
+      static_cast<std::uint64_t>(status.st_size) >=
+          sizeof(s21::MatrixFileHeader)) {
+    length_ = static_cast<std::size_t>(status.st_size);
+    mapping_ = ::mmap(nullptr, length_, PROT_READ, MAP_SHARED, fd, 0);
+  }
+  ::close(fd);
+  if (mapping_ == MAP_FAILED)
+    s21::Fail("The file " + path + " could not be mapped");
+  try {
+    const auto *file = static_cast<const char *>(mapping_);
+    s21::MatrixFileHeader header;
+    std::memcpy(&header, file, sizeof(header));
+    const std::uint64_t bytes = s21::Validate(header);
+    if (header.data_offset + bytes > length_)
+      s21::Fail("The matrix file is truncated");
+    s21::MatrixFile::Attach(matrix_, header, file);
+    if (verify && s21::MatrixFile::Checksum(matrix_) != header.checksum)
+      s21::Fail("The checksum of the matrix file does not match");
+  } catch (...) {
+    Unmap();
+    throw;
+  }
+}
+
+S21MappedMatrix::S21MappedMatrix(S21MappedMatrix &&moved) noexcept
+    : mapping_(std::exchange(moved.mapping_, MAP_FAILED)),
+      length_(std::exchange(moved.length_, 0)),
+      matrix_(std::move(moved.matrix_)) {}
+
+S21MappedMatrix::~S21MappedMatrix() { Unmap(); }
+
+void S21MappedMatrix::Unmap() noexcept {
+  s21::MatrixFile::Detach(matrix_);
+  if (mapping_ != MAP_FAILED) ::munmap(mapping_, length_);
+  mapping_ = MAP_FAILED;
+}
+
+const S21Matrix &S21MappedMatrix::Matrix() const noexcept { return matrix_; }
+
+S21MappedMatrix::operator const S21Matrix &() const noexcept {
+  return matrix_;
+}
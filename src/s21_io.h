@@ -0,0 +1,110 @@
+#ifndef SRC_S21_IO_H_
+#define SRC_S21_IO_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory_resource>
+#include <string>
+
+#include "s21_matrix_oop.h"
+
+// The binary file of a matrix: a 64-byte header followed by the rows.
+//
+//   offset  size  field
+//        0     8  magic "S21MATRX"
+//        8     4  version, kMatrixFileVersion
+//       12     4  dtype, kFloat64: IEEE 754 doubles
+//       16     8  rows
+//       24     8  cols
+//       32     8  stride, the elements between the starts of two rows
+//       40     8  data_offset, the position of the first row, a multiple of 64
+//       48     8  checksum, XXH64 of the cols elements of every row, the hash
+//                 of a row is the seed of the next one, the first seed is 0
+//       56     8  reserved, 0
+//
+// The integers and the elements are little-endian. The rows are written
+// with the stride of S21Matrix, so the file can be mapped into memory and
+// used in place by S21MappedMatrix; the padding of the rows is zeros.
+
+namespace s21 {
+
+constexpr std::uint32_t kMatrixFileVersion = 1;
+
+enum class DType : std::uint32_t { kFloat64 = 1 };
+
+struct MatrixFileHeader {
+  char magic[8];
+  std::uint32_t version;
+  DType dtype;
+  std::int64_t rows, cols, stride;
+  std::uint64_t data_offset;
+  std::uint64_t checksum;
+  std::uint64_t reserved;
+};
+static_assert(sizeof(MatrixFileHeader) == 64, "the header is 64 bytes");
+
+// XXH64 of the bytes with the seed
+std::uint64_t Hash64(const void *data, std::size_t bytes,
+                     std::uint64_t seed = 0) noexcept;
+
+// the same hash of bytes that arrive in pieces
+class Hasher64 {
+ public:
+  explicit Hasher64(std::uint64_t seed = 0) noexcept;
+  void Update(const void *data, std::size_t bytes) noexcept;
+  std::uint64_t Digest() const noexcept;
+
+ private:
+  std::uint64_t seed_;
+  std::uint64_t lanes_[4];
+  std::uint64_t total_;       // the bytes passed to Update
+  unsigned char buffer_[32];  // the bytes of an incomplete stripe
+  std::size_t buffered_;
+};
+
+// the header of a file with the rows of a rows x cols S21Matrix
+MatrixFileHeader MakeMatrixHeader(int rows, int cols,
+                                  std::uint64_t checksum);
+// the header of the file at the path, checked like LoadMatrix does and
+// against the size of the file; the rows are not read
+MatrixFileHeader ReadMatrixHeader(const std::string &path);
+
+// writing and reading the whole matrix; the loading checks the header and
+// the checksum and throws std::runtime_error when the file is not valid
+void SaveMatrix(const S21Matrix &matrix, std::ostream &out);
+void SaveMatrix(const S21Matrix &matrix, const std::string &path);
+S21Matrix LoadMatrix(
+    std::istream &in,
+    std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+S21Matrix LoadMatrix(
+    const std::string &path,
+    std::pmr::memory_resource *resource = std::pmr::get_default_resource());
+
+}  // namespace s21
+
+// A read-only matrix that maps a file of SaveMatrix into memory and uses
+// the rows in place: opening it costs the same for any size, the pages are
+// read from the disk when they are first touched and are shared with the
+// page cache. The header is always checked, the checksum only on request
+// because it reads the whole file. The matrix must not outlive the view.
+class S21MappedMatrix {
+ public:
+  explicit S21MappedMatrix(const std::string &path, bool verify = false);
+  S21MappedMatrix(const S21MappedMatrix &) = delete;
+  S21MappedMatrix &operator=(const S21MappedMatrix &) = delete;
+  S21MappedMatrix(S21MappedMatrix &&moved) noexcept;
+  ~S21MappedMatrix();
+
+  const S21Matrix &Matrix() const noexcept;
+  operator const S21Matrix &() const noexcept;  // NOLINT
+
+ private:
+  void Unmap() noexcept;
+
+  void *mapping_;
+  std::size_t length_;
+  S21Matrix matrix_;  // the rows point into the mapping
+};
+
+#endif  // SRC_S21_IO_H_
@@ -0,0 +1,126 @@
+#include "s21_lu.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "s21_gemm.h"
+#include "s21_triangular.h"
+
+// CONSTRUCTORS
+
+// factorizes a copy of the square matrix allocated from its memory resource,
+// the copy of a matrix over external rows uses the default resource
+S21LUDecomposition::S21LUDecomposition(const S21Matrix &matrix)
+    : lu_(matrix, matrix.ResultResource()),
+      pivots_(matrix.GetRows()),
+      sign_(1),
+      singular_(false) {
+  if (matrix.GetRows() != matrix.GetCols())
+    throw std::invalid_argument("The matrix is not square");
+  Factorize();
+}
+
+// blocked right-looking elimination in place: a panel of kBlock columns is
+// factorized with partial pivoting, the rows to its right are solved with
+// the unit lower triangle of the panel, and the trailing submatrix is
+// updated with one matrix product
+void S21LUDecomposition::Factorize() {
+  const int n = lu_.rows_;
+  const int stride = lu_.stride_;
+  for (auto k0 = 0; k0 < n; k0 += kBlock) {
+    const int k1 = std::min(n, k0 + kBlock);
+    for (auto k = k0; k < k1; ++k) {
+      int pivot = k;
+      for (auto i = k + 1; i < n; ++i)
+        if (std::fabs(lu_.RowPtr(i)[k]) > std::fabs(lu_.RowPtr(pivot)[k]))
+          pivot = i;
+      pivots_[k] = pivot;
+      // whole rows are swapped: the factored columns to the left and the
+      // columns to the right that are not updated yet
+      if (pivot != k) {
+        std::swap_ranges(lu_.RowPtr(k), lu_.RowPtr(k) + n, lu_.RowPtr(pivot));
+        sign_ = -sign_;
+      }
+      const double *pivot_row = lu_.RowPtr(k);
+      // only a zero pivot makes the matrix singular: a small one may just
+      // come from a badly scaled row, which a cutoff relative to the largest
+      // element would reject
+      if (pivot_row[k] == 0) {
+        singular_ = true;
+        continue;
+      }
+      for (auto i = k + 1; i < n; ++i) {
+        double *row = lu_.RowPtr(i);
+        double factor = row[k] / pivot_row[k];
+        row[k] = factor;
+        if (factor == 0) continue;
+        for (auto j = k + 1; j < k1; ++j) row[j] -= factor * pivot_row[j];
+      }
+    }
+    if (k1 == n) break;
+    // U12 = L11^-1 * A12
+    for (auto i = k0 + 1; i < k1; ++i) {
+      double *row = lu_.RowPtr(i);
+      for (auto p = k0; p < i; ++p) {
+        const double factor = row[p];
+        const double *upper_row = lu_.RowPtr(p);
+        for (auto j = k1; j < n; ++j) row[j] -= factor * upper_row[j];
+      }
+    }
+    // A22 -= L21 * U12
+    s21::Gemm(n - k1, n - k1, k1 - k0, -1, lu_.RowPtr(k1) + k0, stride,
+              lu_.RowPtr(k0) + k1, stride, lu_.RowPtr(k1) + k1, stride);
+  }
+}
+
+// ACCESSORS
+
+int S21LUDecomposition::GetSize() const noexcept { return lu_.rows_; }
+
+bool S21LUDecomposition::IsSingular() const noexcept { return singular_; }
+
+// returns the packed factors: L without its unit diagonal and U
+const S21Matrix &S21LUDecomposition::GetFactors() const noexcept {
+  return lu_;
+}
+
+// OPERATIONS
+
+// the determinant is the signed product of the diagonal of U
+double S21LUDecomposition::Determinant() const noexcept {
+  double det = sign_;
+  for (auto i = 0; i < lu_.rows_; ++i) det *= lu_.RowPtr(i)[i];
+  return det;
+}
+
+S21Matrix S21LUDecomposition::InverseMatrix() const {
+  if (singular_)
+    throw std::invalid_argument("The determinant of the matrix is 0");
+  const int n = lu_.rows_;
+  S21Matrix identity(n, n);
+  for (auto i = 0; i < n; ++i) identity.RowPtr(i)[i] = 1;
+  return Solve(identity);
+}
+
+// solving A * X = B for all columns of B at once: the row permutation,
+// then forward substitution with L and backward substitution with U
+S21Matrix S21LUDecomposition::Solve(const S21Matrix &rhs) const {
+  const int n = lu_.rows_;
+  if (rhs.rows_ != n)
+    throw std::invalid_argument(
+        "The number of rows of the right-hand side must be "
+        "equal to the order of the matrix");
+  if (singular_)
+    throw std::invalid_argument("The determinant of the matrix is 0");
+  S21Matrix result(rhs);
+  for (auto k = 0; k < n; ++k)
+    if (pivots_[k] != k)
+      std::swap_ranges(result.RowPtr(k), result.RowPtr(k) + result.cols_,
+                       result.RowPtr(pivots_[k]));
+  s21::SolveTriangular(s21::Triangle::kUnitLower, n, result.cols_,
+                       lu_.matrix_, lu_.stride_, result.matrix_,
+                       result.stride_);
+  s21::SolveTriangular(s21::Triangle::kUpper, n, result.cols_, lu_.matrix_,
+                       lu_.stride_, result.matrix_, result.stride_);
+  return result;
+}
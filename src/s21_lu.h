@@ -0,0 +1,36 @@
+#ifndef SRC_S21_LU_H_
+#define SRC_S21_LU_H_
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// LU factorization with partial pivoting: P * A = L * U, where L is a unit
+// lower triangular matrix and U is an upper triangular one. Both factors are
+// kept in a single matrix, so the factorization is computed once in O(n^3)
+// and then reused for the determinant, the inverse and linear solves.
+class S21LUDecomposition {
+ private:
+  // columns in a panel of the blocked factorization
+  static constexpr int kBlock = 64;
+
+  S21Matrix lu_;             // L below the diagonal, U on and above it
+  std::vector<int> pivots_;  // pivots_[k] is the row swapped with row k
+  int sign_;                 // sign of the permutation P
+  bool singular_;            // a pivot is exactly zero
+
+  void Factorize();
+
+ public:
+  explicit S21LUDecomposition(const S21Matrix &matrix);
+
+  int GetSize() const noexcept;
+  bool IsSingular() const noexcept;
+  const S21Matrix &GetFactors() const noexcept;
+
+  double Determinant() const noexcept;
+  S21Matrix InverseMatrix() const;
+  S21Matrix Solve(const S21Matrix &rhs) const;
+};
+
+#endif  // SRC_S21_LU_H_
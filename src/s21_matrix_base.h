@@ -0,0 +1,612 @@
+#ifndef SRC_S21_MATRIX_BASE_H_
+#define SRC_S21_MATRIX_BASE_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_matrix_iterator.h"
+#include "s21_runs.h"
+#include "s21_simd.h"
+#include "s21_stats.h"
+#include "s21_thread_pool.h"
+
+// S21MatrixBase<T, Matrix>: the part of S21BasicMatrix<T> that does not
+// depend on the element type, written once for S21Matrix and the matrices of
+// other element types. It owns the storage (one aligned row-major buffer
+// from a memory resource), gives the checked and unchecked access to the
+// elements and runs the element-wise operations, the maps and the minors.
+// Matrix is the derived matrix type (CRTP), the type of the operands and the
+// results; the kernels that differ between the element types (products,
+// transposes, factorizations) stay in the derived classes.
+
+namespace s21 {
+
+// the s21::Execution of a policy of <execution>, defined in s21_execution.h
+template <class Policy>
+struct ExecutionOf;
+template <class Policy>
+constexpr Execution kExecutionOf = ExecutionOf<std::decay_t<Policy>>::value;
+// the overloads of the policies take only the types that ExecutionOf knows
+template <class Policy>
+using EnableIfPolicy =
+    std::void_t<decltype(ExecutionOf<std::decay_t<Policy>>::value)>;
+
+// the element-wise kernels of S21MatrixBase over n contiguous elements, the
+// loops are written for the compiler to vectorize them for any T
+template <class T>
+struct ElementKernels {
+  static void Add(T *y, const T *x, std::size_t n) noexcept {
+    for (std::size_t i = 0; i < n; ++i) y[i] += x[i];
+  }
+  static void Sub(T *y, const T *x, std::size_t n) noexcept {
+    for (std::size_t i = 0; i < n; ++i) y[i] -= x[i];
+  }
+  static void Scale(T *y, T a, std::size_t n) noexcept {
+    for (std::size_t i = 0; i < n; ++i) y[i] *= a;
+  }
+  static void Axpy(T *y, T a, const T *x, std::size_t n) noexcept {
+    for (std::size_t i = 0; i < n; ++i) y[i] += a * x[i];
+  }
+  static bool Equal(const T *x, const T *y, std::size_t n) noexcept {
+    return std::equal(x, x + n, y);
+  }
+};
+
+// doubles run on the SIMD kernels of s21_simd.h
+template <>
+struct ElementKernels<double> {
+  static void Add(double *y, const double *x, std::size_t n) noexcept {
+    Simd().add(y, x, n);
+  }
+  static void Sub(double *y, const double *x, std::size_t n) noexcept {
+    Simd().sub(y, x, n);
+  }
+  static void Scale(double *y, double a, std::size_t n) noexcept {
+    Simd().scale(y, a, n);
+  }
+  static void Axpy(double *y, double a, const double *x,
+                   std::size_t n) noexcept {
+    Simd().axpy(y, a, x, n);
+  }
+  static bool Equal(const double *x, const double *y, std::size_t n) noexcept {
+    return Simd().equal(x, y, n);
+  }
+};
+
+}  // namespace s21
+
+template <class T, class Matrix>
+class S21MatrixBase {
+ public:
+  using value_type = T;
+  using iterator = S21MatrixIterator<T>;
+  using const_iterator = S21MatrixIterator<const T>;
+
+  // unchecked element access for inner loops: the indices are asserted in
+  // debug builds only, GetValue and SetValue check them and throw
+  T &operator()(int row, int col) noexcept {
+    assert(0 <= row && row < rows_ && 0 <= col && col < cols_);
+    return RowPtr(row)[col];
+  }
+  const T &operator()(int row, int col) const noexcept {
+    assert(0 <= row && row < rows_ && 0 <= col && col < cols_);
+    return RowPtr(row)[col];
+  }
+
+  // the element-wise operations, the comparison stops at the first vector
+  // with a mismatch
+  bool EqMatrix(const Matrix &other) const noexcept;
+  void SumMatrix(const Matrix &other);
+  void SubMatrix(const Matrix &other);
+  void MulNumber(const T num) noexcept;
+  // this = num * other + this in one pass
+  void AxpyMatrix(const T num, const Matrix &other);
+  Matrix MinorMatrix(int rm_row, int rm_col) const;
+
+  // the same with an execution: s21::Execution or, with s21_execution.h, a
+  // policy of <execution> (std::execution::seq, par or par_unseq); the
+  // sequenced one runs on the calling thread, the others on the thread pool
+  // for large matrices
+  bool EqMatrix(s21::Execution execution, const Matrix &other) const noexcept {
+    s21::ExecutionScope scope(execution);
+    return EqMatrix(other);
+  }
+  void SumMatrix(s21::Execution execution, const Matrix &other) {
+    s21::ExecutionScope scope(execution);
+    SumMatrix(other);
+  }
+  void SubMatrix(s21::Execution execution, const Matrix &other) {
+    s21::ExecutionScope scope(execution);
+    SubMatrix(other);
+  }
+  void MulNumber(s21::Execution execution, const T num) noexcept {
+    s21::ExecutionScope scope(execution);
+    MulNumber(num);
+  }
+  template <class Policy, class = s21::EnableIfPolicy<Policy>>
+  bool EqMatrix(Policy &&, const Matrix &other) const noexcept {
+    return EqMatrix(s21::kExecutionOf<Policy>, other);
+  }
+  template <class Policy, class = s21::EnableIfPolicy<Policy>>
+  void SumMatrix(Policy &&, const Matrix &other) {
+    SumMatrix(s21::kExecutionOf<Policy>, other);
+  }
+  template <class Policy, class = s21::EnableIfPolicy<Policy>>
+  void SubMatrix(Policy &&, const Matrix &other) {
+    SubMatrix(s21::kExecutionOf<Policy>, other);
+  }
+  template <class Policy, class = s21::EnableIfPolicy<Policy>>
+  void MulNumber(Policy &&, const T num) noexcept {
+    MulNumber(s21::kExecutionOf<Policy>, num);
+  }
+
+  // maps with a user function: Apply replaces every element x with f(x),
+  // Zip with f(x, y) for the element y of other at the same position;
+  // without an execution f is called sequentially on the calling thread,
+  // otherwise it may be called concurrently for different rows
+  template <class F>
+  void Apply(F f) {
+    Apply(s21::Execution::kSequenced, f);
+  }
+  template <class F>
+  void Apply(s21::Execution execution, F f);
+  template <class Policy, class F, class = s21::EnableIfPolicy<Policy>>
+  void Apply(Policy &&, F f) {
+    Apply(s21::kExecutionOf<Policy>, f);
+  }
+  template <class F>
+  void Zip(const Matrix &other, F f) {
+    Zip(s21::Execution::kSequenced, other, f);
+  }
+  template <class F>
+  void Zip(s21::Execution execution, const Matrix &other, F f);
+  template <class Policy, class F, class = s21::EnableIfPolicy<Policy>>
+  void Zip(Policy &&, const Matrix &other, F f) {
+    Zip(s21::kExecutionOf<Policy>, other, f);
+  }
+
+  // the elements in row-major order, see s21_matrix_iterator.h
+  iterator begin() noexcept { return {matrix_, cols_, stride_, 1, 0}; }
+  iterator end() noexcept { return {matrix_, cols_, stride_, 1, Elements()}; }
+  const_iterator begin() const noexcept {
+    return {matrix_, cols_, stride_, 1, 0};
+  }
+  const_iterator end() const noexcept {
+    return {matrix_, cols_, stride_, 1, Elements()};
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  // the storage: the row i starts at Data() + i * GetStride(), the elements
+  // of a row are adjacent
+  T *Data() noexcept { return matrix_; }
+  const T *Data() const noexcept { return matrix_; }
+  int GetStride() const noexcept { return stride_; }
+
+  // getters
+  int GetRows() const noexcept { return rows_; }
+  int GetCols() const noexcept { return cols_; }
+  T GetValue(int row, int col) const;
+  std::pmr::memory_resource *GetResource() const noexcept { return resource_; }
+
+  // setters
+  void SetValue(int row, int col, T value);
+  void SetRows(int rows);
+  void SetCols(int cols);
+
+ protected:
+  // alignment of the matrix buffer in bytes (one cache line)
+  static constexpr std::size_t kAlignment = 64;
+
+  // attributes
+  int rows_, cols_;  // rows and columns attributes
+  int stride_;       // distance in elements between the starts of two rows
+  T *matrix_;        // single row-major buffer of rows_ * stride_ elements
+  std::pmr::memory_resource *resource_;  // source of the buffer memory
+
+  // empty matrix without storage, the state of a moved-from matrix
+  explicit S21MatrixBase(std::nullptr_t) noexcept
+      : rows_(0),
+        cols_(0),
+        stride_(0),
+        matrix_(nullptr),
+        resource_(std::pmr::get_default_resource()) {}
+  // a view of external storage: the null resource never frees the buffer
+  S21MatrixBase(T *storage, int rows, int cols, int stride) noexcept
+      : rows_(rows),
+        cols_(cols),
+        stride_(stride),
+        matrix_(storage),
+        resource_(std::pmr::null_memory_resource()) {}
+  S21MatrixBase(int rows, int cols, std::pmr::memory_resource *resource);
+  // like the standard containers the copy does not inherit the memory
+  // resource and uses the default one
+  S21MatrixBase(const S21MatrixBase &copy)
+      : S21MatrixBase(copy, std::pmr::get_default_resource()) {}
+  S21MatrixBase(const S21MatrixBase &copy,
+                std::pmr::memory_resource *resource);
+  S21MatrixBase(S21MatrixBase &&moved) noexcept;
+  ~S21MatrixBase() { ClearMatrix(); }
+
+  S21MatrixBase &operator=(const S21MatrixBase &other);
+  S21MatrixBase &operator=(S21MatrixBase &&other);
+
+  static int CalcStride(int cols) noexcept;
+  T *MatrixMemoryAllocation(int rows, int stride);
+  void ClearMatrix() noexcept;
+  void ChangeSize(int n_rows, int n_cols);
+  void SwapStorage(S21MatrixBase &other) noexcept;
+  void Reshape(int rows, int cols);
+  void CheckSameSize(const S21MatrixBase &other) const;
+  void CheckSquare() const;
+
+  // pointer to the first element of the row
+  T *RowPtr(int row) noexcept {
+    return matrix_ + static_cast<std::ptrdiff_t>(row) * stride_;
+  }
+  const T *RowPtr(int row) const noexcept {
+    return matrix_ + static_cast<std::ptrdiff_t>(row) * stride_;
+  }
+  // the resource of the matrices derived from this one, a view of external
+  // storage passes on the default resource instead of the null one
+  std::pmr::memory_resource *ResultResource() const noexcept {
+    return resource_ == std::pmr::null_memory_resource()
+               ? std::pmr::get_default_resource()
+               : resource_;
+  }
+  // the rows follow each other without padding
+  bool IsContiguous() const noexcept { return stride_ == cols_; }
+  // the number of elements, the size of the operations in s21_stats.h
+  std::ptrdiff_t Elements() const noexcept {
+    return static_cast<std::ptrdiff_t>(rows_) * cols_;
+  }
+  // the rows of the matrix as an operand of s21::ForEachRun
+  s21::RunOperand<T> Rows() noexcept { return {matrix_, stride_, 1}; }
+  s21::RunOperand<const T> Rows() const noexcept {
+    return {matrix_, stride_, 1};
+  }
+};
+
+// AUXILIARY METHODS
+
+// the number of elements between the starts of two adjacent rows:
+// wide rows are padded to a whole number of cache lines so that every row
+// starts aligned, narrow rows are packed densely to avoid wasting memory
+// input: the number of columns
+template <class T, class Matrix>
+int S21MatrixBase<T, Matrix>::CalcStride(int cols) noexcept {
+  constexpr int kLineElems =
+      std::max(1, static_cast<int>(kAlignment / sizeof(T)));
+  constexpr int kPaddingFrom = 4 * kLineElems;
+  if (cols < kPaddingFrom) return cols;
+  return (cols + kLineElems - 1) / kLineElems * kLineElems;
+}
+
+// allocation of one aligned zero-filled buffer for the whole matrix
+// from the memory resource of the matrix
+// input: the number of rows and the row stride
+template <class T, class Matrix>
+T *S21MatrixBase<T, Matrix>::MatrixMemoryAllocation(int rows, int stride) {
+  const std::size_t count = static_cast<std::size_t>(rows) * stride;
+  auto *buf_mx =
+      static_cast<T *>(resource_->allocate(count * sizeof(T), kAlignment));
+  S21_STATS_ALLOCATION(count * sizeof(T));
+  if constexpr (std::is_trivial_v<T>)
+    std::memset(buf_mx, 0, count * sizeof(T));
+  else
+    std::uninitialized_value_construct_n(buf_mx, count);
+  return buf_mx;
+}
+
+// freeing the matrix memory
+// releasing the pointer to the matrix
+template <class T, class Matrix>
+void S21MatrixBase<T, Matrix>::ClearMatrix() noexcept {
+  if (matrix_) {
+    const std::size_t bytes =
+        static_cast<std::size_t>(rows_) * stride_ * sizeof(T);
+    resource_->deallocate(matrix_, bytes, kAlignment);
+    S21_STATS_DEALLOCATION(bytes);
+    matrix_ = nullptr;
+  }
+}
+
+// changing the size of the matrix
+// when changing the value of the rows_ and cols fields_
+// input: new values of <rows_> <cols_>, the values that fit into the new
+// dimensions are kept, the rest are zeros
+template <class T, class Matrix>
+void S21MatrixBase<T, Matrix>::ChangeSize(int n_rows, int n_cols) {
+  const int n_stride = CalcStride(n_cols);
+  T *buf_mx = MatrixMemoryAllocation(n_rows, n_stride);
+  const int rows_count = std::min(rows_, n_rows);
+  const int cols_count = std::min(cols_, n_cols);
+  for (auto i = 0; i < rows_count; ++i)
+    std::copy(RowPtr(i), RowPtr(i) + cols_count,
+              buf_mx + static_cast<std::ptrdiff_t>(i) * n_stride);
+  ClearMatrix();
+  matrix_ = buf_mx;
+  stride_ = n_stride;
+}
+
+// exchanging the storage, its memory resource and the dimensions
+// with another matrix
+template <class T, class Matrix>
+void S21MatrixBase<T, Matrix>::SwapStorage(S21MatrixBase &other) noexcept {
+  std::swap(rows_, other.rows_);
+  std::swap(cols_, other.cols_);
+  std::swap(stride_, other.stride_);
+  std::swap(matrix_, other.matrix_);
+  std::swap(resource_, other.resource_);
+}
+
+// giving the matrix the dimensions <rows> <cols>,
+// the storage is reallocated only when the dimensions change
+// and the values are not preserved in that case
+template <class T, class Matrix>
+void S21MatrixBase<T, Matrix>::Reshape(int rows, int cols) {
+  if (rows_ == rows && cols_ == cols && matrix_) return;
+  const int n_stride = CalcStride(cols);
+  T *buf_mx = MatrixMemoryAllocation(rows, n_stride);
+  ClearMatrix();
+  matrix_ = buf_mx;
+  rows_ = rows;
+  cols_ = cols;
+  stride_ = n_stride;
+}
+
+template <class T, class Matrix>
+void S21MatrixBase<T, Matrix>::CheckSameSize(
+    const S21MatrixBase &other) const {
+  if (rows_ != other.rows_ || cols_ != other.cols_)
+    throw std::invalid_argument("Matrices should have the same size");
+}
+
+template <class T, class Matrix>
+void S21MatrixBase<T, Matrix>::CheckSquare() const {
+  if (rows_ != cols_) throw std::invalid_argument("The matrix is not square");
+}
+
+// CONSTRUCTORS
+
+// parameterized constructor with the buffer from the memory resource
+template <class T, class Matrix>
+S21MatrixBase<T, Matrix>::S21MatrixBase(int rows, int cols,
+                                        std::pmr::memory_resource *resource)
+    : rows_(rows),
+      cols_(cols),
+      stride_(0),
+      matrix_(nullptr),
+      resource_(resource) {
+  if (rows < 1 || cols < 1)
+    throw std::invalid_argument(
+        "The number of rows and columns must be greater than 1");
+  stride_ = CalcStride(cols);
+  matrix_ = MatrixMemoryAllocation(rows, stride_);
+}
+
+// copy constructor with the buffer from the memory resource, the strides
+// are equal, so the whole buffer is copied at once
+template <class T, class Matrix>
+S21MatrixBase<T, Matrix>::S21MatrixBase(const S21MatrixBase &copy,
+                                        std::pmr::memory_resource *resource)
+    : rows_(copy.rows_),
+      cols_(copy.cols_),
+      stride_(copy.stride_),
+      matrix_(nullptr),
+      resource_(resource) {
+  matrix_ = MatrixMemoryAllocation(rows_, stride_);
+  std::copy(copy.matrix_,
+            copy.matrix_ + static_cast<std::ptrdiff_t>(rows_) * stride_,
+            matrix_);
+}
+
+// move constructor, the moved matrix is left empty
+template <class T, class Matrix>
+S21MatrixBase<T, Matrix>::S21MatrixBase(S21MatrixBase &&moved) noexcept
+    : rows_(std::exchange(moved.rows_, 0)),
+      cols_(std::exchange(moved.cols_, 0)),
+      stride_(std::exchange(moved.stride_, 0)),
+      matrix_(std::exchange(moved.matrix_, nullptr)),
+      resource_(moved.resource_) {}
+
+// OPERATOR OVERLOADING
+
+// the existing storage is reused when the dimensions match,
+// otherwise the new buffer is allocated before the old one is released
+template <class T, class Matrix>
+S21MatrixBase<T, Matrix> &S21MatrixBase<T, Matrix>::operator=(
+    const S21MatrixBase &other) {
+  if (this == &other) return *this;
+  if (rows_ != other.rows_ || cols_ != other.cols_ || !matrix_) {
+    T *buf_mx = MatrixMemoryAllocation(other.rows_, other.stride_);
+    ClearMatrix();
+    matrix_ = buf_mx;
+    rows_ = other.rows_;
+    cols_ = other.cols_;
+    stride_ = other.stride_;
+  }
+  if (stride_ == other.stride_)
+    std::copy(other.matrix_,
+              other.matrix_ + static_cast<std::ptrdiff_t>(rows_) * stride_,
+              matrix_);
+  else
+    for (auto i = 0; i < rows_; ++i)
+      std::copy(other.RowPtr(i), other.RowPtr(i) + cols_, RowPtr(i));
+  return *this;
+}
+
+// the storage of the moved matrix is taken over when the memory resources
+// are equal; like the standard containers the matrix keeps its resource
+// otherwise and copies the elements. The moved matrix is left empty
+template <class T, class Matrix>
+S21MatrixBase<T, Matrix> &S21MatrixBase<T, Matrix>::operator=(
+    S21MatrixBase &&other) {
+  if (this == &other) return *this;
+  if (*resource_ == *other.resource_) {
+    ClearMatrix();
+    SwapStorage(other);
+  } else if (other.matrix_) {
+    *this = static_cast<const S21MatrixBase &>(other);
+    other.ClearMatrix();
+  } else {
+    ClearMatrix();
+    rows_ = 0;
+    cols_ = 0;
+    stride_ = 0;
+  }
+  other.rows_ = 0;
+  other.cols_ = 0;
+  other.stride_ = 0;
+  return *this;
+}
+
+// OPERATIONS
+
+template <class T, class Matrix>
+bool S21MatrixBase<T, Matrix>::EqMatrix(const Matrix &other) const noexcept {
+  S21_STATS_SCOPE(kEqMatrix, Elements());
+  const S21MatrixBase &base = other;
+  if (rows_ != base.rows_ || cols_ != base.cols_) return false;
+  return s21::AllRows(rows_, cols_, [&](int i) {
+    return s21::ElementKernels<T>::Equal(RowPtr(i), base.RowPtr(i), cols_);
+  });
+}
+
+template <class T, class Matrix>
+void S21MatrixBase<T, Matrix>::SumMatrix(const Matrix &other) {
+  S21_STATS_SCOPE(kSumMatrix, Elements());
+  const S21MatrixBase &base = other;
+  CheckSameSize(base);
+  s21::ForEachRun(rows_, cols_, Rows(), base.Rows(),
+                  s21::ElementKernels<T>::Add);
+}
+
+template <class T, class Matrix>
+void S21MatrixBase<T, Matrix>::SubMatrix(const Matrix &other) {
+  S21_STATS_SCOPE(kSubMatrix, Elements());
+  const S21MatrixBase &base = other;
+  CheckSameSize(base);
+  s21::ForEachRun(rows_, cols_, Rows(), base.Rows(),
+                  s21::ElementKernels<T>::Sub);
+}
+
+template <class T, class Matrix>
+void S21MatrixBase<T, Matrix>::MulNumber(const T num) noexcept {
+  S21_STATS_SCOPE(kMulNumber, Elements());
+  s21::ForEachRun(rows_, cols_, Rows(), Rows(),
+                  [&](T *y, const T *, std::size_t n) {
+                    s21::ElementKernels<T>::Scale(y, num, n);
+                  });
+}
+
+template <class T, class Matrix>
+void S21MatrixBase<T, Matrix>::AxpyMatrix(const T num, const Matrix &other) {
+  S21_STATS_SCOPE(kAxpyMatrix, Elements());
+  const S21MatrixBase &base = other;
+  CheckSameSize(base);
+  s21::ForEachRun(rows_, cols_, Rows(), base.Rows(),
+                  [&](T *y, const T *x, std::size_t n) {
+                    s21::ElementKernels<T>::Axpy(y, num, x, n);
+                  });
+}
+
+// the matrix without the row <rm_row> and the column <rm_col>
+template <class T, class Matrix>
+Matrix S21MatrixBase<T, Matrix>::MinorMatrix(int rm_row, int rm_col) const {
+  S21_STATS_SCOPE(kMinorMatrix, Elements());
+  CheckSquare();
+  Matrix minor_mx(rows_ - 1, cols_ - 1, ResultResource());
+  S21MatrixBase &minor = minor_mx;
+  for (auto i = 0, minor_i = 0; i < rows_; ++i) {
+    if (i == rm_row) continue;
+    for (auto j = 0, minor_j = 0; j < cols_; ++j)
+      if (j != rm_col) minor.RowPtr(minor_i)[minor_j++] = RowPtr(i)[j];
+    ++minor_i;
+  }
+  return minor_mx;
+}
+
+// the rows are mapped as the execution allows, the loop over a row is left
+// to the compiler to vectorize
+template <class T, class Matrix>
+template <class F>
+void S21MatrixBase<T, Matrix>::Apply(s21::Execution execution, F f) {
+  const int cols = cols_;
+  s21::ForEachRow(
+      rows_, cols,
+      [&](int i) {
+        T *row = RowPtr(i);
+        for (auto j = 0; j < cols; ++j) row[j] = f(row[j]);
+      },
+      execution);
+}
+
+template <class T, class Matrix>
+template <class F>
+void S21MatrixBase<T, Matrix>::Zip(s21::Execution execution,
+                                   const Matrix &other, F f) {
+  const S21MatrixBase &base = other;
+  CheckSameSize(base);
+  const int cols = cols_;
+  s21::ForEachRow(
+      rows_, cols,
+      [&](int i) {
+        T *row = RowPtr(i);
+        const T *other_row = base.RowPtr(i);
+        for (auto j = 0; j < cols; ++j) row[j] = f(row[j], other_row[j]);
+      },
+      execution);
+}
+
+// ACCESSORS AND MUTATORS
+
+template <class T, class Matrix>
+T S21MatrixBase<T, Matrix>::GetValue(int row, int col) const {
+  if (row < 0 || rows_ <= row)
+    throw std::out_of_range("The row index is incorrect");
+  if (col < 0 || cols_ <= col)
+    throw std::out_of_range("The column index is incorrect");
+  return RowPtr(row)[col];
+}
+
+// recording the value at the address of the matrix cell
+template <class T, class Matrix>
+void S21MatrixBase<T, Matrix>::SetValue(int row, int col, T value) {
+  if (row < 0 || col < 0)
+    throw std::out_of_range("Index values must be greater than 0");
+  if (rows_ <= row || cols_ <= col)
+    throw std::out_of_range("The index exceeds the dimension of the matrix");
+  RowPtr(row)[col] = value;
+}
+
+template <class T, class Matrix>
+void S21MatrixBase<T, Matrix>::SetRows(int rows) {
+  if (rows <= 0)
+    throw std::out_of_range(
+        "Incorrect input, rows value must be greater than 0");
+  if (rows_ != rows) {
+    ChangeSize(rows, cols_);
+    rows_ = rows;
+  }
+}
+
+template <class T, class Matrix>
+void S21MatrixBase<T, Matrix>::SetCols(int cols) {
+  if (cols <= 0)
+    throw std::out_of_range(
+        "Incorrect input, cols value must be greater than 0");
+  if (cols_ != cols) {
+    ChangeSize(rows_, cols);
+    cols_ = cols;
+  }
+}
+
+#endif  // SRC_S21_MATRIX_BASE_H_
@@ -0,0 +1,149 @@
+#ifndef SRC_S21_MATRIX_ITERATOR_H_
+#define SRC_S21_MATRIX_ITERATOR_H_
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+// A random access iterator over the elements of a matrix or a view in
+// row-major order: the element (i, j) is at data[i * row_stride +
+// j * col_stride], so the padding at the ends of the rows is skipped. T is
+// the element type, const for read-only iteration. Random access lets the
+// standard algorithms, including the parallel ones of <execution>, split
+// the range; the loops of hot kernels should rather walk the rows through
+// pointers, as every step here checks for the end of a row.
+template <class T>
+class S21MatrixIterator {
+  template <class U>
+  friend class S21MatrixIterator;
+
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::remove_const_t<T>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = T *;
+  using reference = T &;
+
+  S21MatrixIterator() noexcept = default;
+  // the element with the row-major index of the matrix of cols columns
+  S21MatrixIterator(T *data, int cols, std::ptrdiff_t row_stride,
+                    std::ptrdiff_t col_stride, std::ptrdiff_t index) noexcept
+      : data_(data),
+        cols_(cols),
+        row_stride_(row_stride),
+        col_stride_(col_stride) {
+    Seek(index);
+  }
+  // a read-only iterator from a mutable one
+  template <class U, class = std::enable_if_t<std::is_same_v<const U, T>>>
+  S21MatrixIterator(const S21MatrixIterator<U> &other) noexcept  // NOLINT
+      : data_(other.data_),
+        cols_(other.cols_),
+        row_stride_(other.row_stride_),
+        col_stride_(other.col_stride_),
+        row_(other.row_),
+        col_(other.col_),
+        offset_(other.offset_) {}
+
+  reference operator*() const noexcept { return data_[offset_]; }
+  pointer operator->() const noexcept { return &**this; }
+  reference operator[](difference_type n) const noexcept {
+    return *(*this + n);
+  }
+
+  S21MatrixIterator &operator++() noexcept {
+    if (++col_ == cols_) {
+      col_ = 0;
+      offset_ = ++row_ * row_stride_;
+    } else {
+      offset_ += col_stride_;
+    }
+    return *this;
+  }
+  S21MatrixIterator operator++(int) noexcept {
+    S21MatrixIterator copy = *this;
+    ++*this;
+    return copy;
+  }
+  S21MatrixIterator &operator--() noexcept {
+    if (col_-- == 0) {
+      col_ = cols_ - 1;
+      offset_ = --row_ * row_stride_ + col_ * col_stride_;
+    } else {
+      offset_ -= col_stride_;
+    }
+    return *this;
+  }
+  S21MatrixIterator operator--(int) noexcept {
+    S21MatrixIterator copy = *this;
+    --*this;
+    return copy;
+  }
+  S21MatrixIterator &operator+=(difference_type n) noexcept {
+    Seek(Index() + n);
+    return *this;
+  }
+  S21MatrixIterator &operator-=(difference_type n) noexcept {
+    Seek(Index() - n);
+    return *this;
+  }
+  friend S21MatrixIterator operator+(S21MatrixIterator it,
+                                     difference_type n) noexcept {
+    return it += n;
+  }
+  friend S21MatrixIterator operator+(difference_type n,
+                                     S21MatrixIterator it) noexcept {
+    return it += n;
+  }
+  friend S21MatrixIterator operator-(S21MatrixIterator it,
+                                     difference_type n) noexcept {
+    return it -= n;
+  }
+  friend difference_type operator-(const S21MatrixIterator &lhs,
+                                   const S21MatrixIterator &rhs) noexcept {
+    return lhs.Index() - rhs.Index();
+  }
+
+  // iterators of the same matrix are compared by their positions
+  friend bool operator==(const S21MatrixIterator &lhs,
+                         const S21MatrixIterator &rhs) noexcept {
+    return lhs.row_ == rhs.row_ && lhs.col_ == rhs.col_;
+  }
+  friend bool operator!=(const S21MatrixIterator &lhs,
+                         const S21MatrixIterator &rhs) noexcept {
+    return !(lhs == rhs);
+  }
+  friend bool operator<(const S21MatrixIterator &lhs,
+                        const S21MatrixIterator &rhs) noexcept {
+    return lhs.Index() < rhs.Index();
+  }
+  friend bool operator>(const S21MatrixIterator &lhs,
+                        const S21MatrixIterator &rhs) noexcept {
+    return rhs < lhs;
+  }
+  friend bool operator<=(const S21MatrixIterator &lhs,
+                         const S21MatrixIterator &rhs) noexcept {
+    return !(rhs < lhs);
+  }
+  friend bool operator>=(const S21MatrixIterator &lhs,
+                         const S21MatrixIterator &rhs) noexcept {
+    return !(lhs < rhs);
+  }
+
+ private:
+  std::ptrdiff_t Index() const noexcept { return row_ * cols_ + col_; }
+  void Seek(std::ptrdiff_t index) noexcept {
+    row_ = cols_ ? index / cols_ : 0;
+    col_ = cols_ ? index % cols_ : 0;
+    offset_ = row_ * row_stride_ + col_ * col_stride_;
+  }
+
+  T *data_ = nullptr;
+  int cols_ = 0;
+  std::ptrdiff_t row_stride_ = 0, col_stride_ = 0;
+  // the position is kept as indices and the offset of the element, so that
+  // the end of the range never forms a pointer past the storage
+  std::ptrdiff_t row_ = 0, col_ = 0, offset_ = 0;
+};
+
+#endif  // SRC_S21_MATRIX_ITERATOR_H_
@@ -2,70 +2,198 @@
 #define SRC_S21MATRIX_H_
 
 #include <cmath>
+#include <cstddef>
 #include <cstring>
 #include <memory>
+#include <memory_resource>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
-class S21Matrix {
+#include "s21_compare.h"
+#include "s21_matrix_base.h"
+#include "s21_reduce.h"
+
+// the base of every matrix expression, see s21_expression.h
+template <class E>
+class S21MatrixExpr {
+ public:
+  const E &Self() const noexcept { return static_cast<const E &>(*this); }
+};
+
+template <class L, class R, class Op>
+class S21BinaryExpr;
+template <class E>
+class S21ScaledExpr;
+template <class L, class R>
+class S21ProductExpr;
+template <int R, int C>
+class S21FixedMatrix;
+class S21MatrixView;
+class S21MutableMatrixView;
+template <class T>
+class S21BasicMatrix;  // the matrices of other element types, see below
+namespace s21 {
+class MatrixFile;  // the binary files of s21_io.h
+}  // namespace s21
+
+// the matrix of doubles, an explicit specialization of S21BasicMatrix: the
+// storage, the element-wise operations and the maps come from S21MatrixBase
+// as for every element type, this class adds the GEMM, transpose and
+// factorization kernels of the library, the views, the reductions and the
+// expression templates
+using S21Matrix = S21BasicMatrix<double>;
+
+template <>
+class S21BasicMatrix<double> : public S21MatrixExpr<S21Matrix>,
+                               public S21MatrixBase<double, S21Matrix> {
+  using Base = S21MatrixBase<double, S21Matrix>;
+  friend class S21LUDecomposition;
+  friend class S21CholeskyDecomposition;
+  friend class S21QRDecomposition;
+  friend class S21UpdatableInverse;
+  friend class S21SparseMatrix;
+  friend class s21::MatrixFile;
+  friend class S21MatrixView;
+  // the expressions read the rows of their operands directly
+  template <class L, class R, class Op>
+  friend class S21BinaryExpr;
+  template <class E>
+  friend class S21ScaledExpr;
+  template <class L, class R>
+  friend class S21ProductExpr;
+  // the fixed-size matrices convert row by row
+  template <int R, int C>
+  friend class S21FixedMatrix;
+  // the conversions between element types copy the rows directly
+  template <class U>
+  friend class S21BasicMatrix;
+
  private:
-  // attributes
-  int rows_, cols_;  // rows and columns attributes
-  double **matrix_;  // pointer to the memory where the matrix will be allocated
+  // the largest order for which cofactor formulas are used
+  static constexpr int kCofactorMaxOrder = 3;
+
+  // empty matrix without storage
+  explicit S21BasicMatrix(std::nullptr_t) noexcept : Base(nullptr) {}
+  // a matrix over storage that it does not own and never frees
+  S21BasicMatrix(double *storage, int rows, int cols, int stride) noexcept
+      : Base(storage, rows, cols, stride) {}
 
-  double **MatrixMemoryAllocation(int rows, int cols);
-  void ChangeSize(int n_rows, int n_cols);
-  void ClearMatrix();
+  // the sums of the columns, or of their absolute values, as a 1 x cols row
+  S21Matrix ColumnSums(bool absolute) const;
 
  public:
-  S21Matrix();                       // default constructor
-  S21Matrix(int rows, int cols);     // parameterized constructor
-  S21Matrix(const S21Matrix &copy);  // copy constructor
-  S21Matrix(S21Matrix &&moved);      // move constructor
-  ~S21Matrix();                      // destructor
+  S21BasicMatrix();                       // default constructor
+  S21BasicMatrix(int rows, int cols);     // parameterized constructor
+  S21BasicMatrix(const S21Matrix &copy);  // copy constructor
+  // the same with the buffer taken from the memory resource
+  S21BasicMatrix(int rows, int cols, std::pmr::memory_resource *resource);
+  S21BasicMatrix(const S21Matrix &copy, std::pmr::memory_resource *resource);
+  S21BasicMatrix(S21Matrix &&moved) noexcept;  // move constructor
+  // copying the elements of a view
+  explicit S21BasicMatrix(S21MatrixView view);
+  S21BasicMatrix(S21MatrixView view, std::pmr::memory_resource *resource);
+  // converting the elements of a matrix of another real type
+  template <class U>
+  explicit S21BasicMatrix(const S21BasicMatrix<U> &other);
+  template <class E>
+  S21BasicMatrix(const S21MatrixExpr<E> &expr);  // evaluating an expression
+  template <class L, class R>
+  S21BasicMatrix(S21ProductExpr<L, R> &&product) noexcept;  // taking a product
+  ~S21BasicMatrix() = default;  // destructor
 
-  // operators overloads
-  S21Matrix &operator=(const S21Matrix &other);  // assigning values of another
-                                                 // matrix to a matrix
-  bool operator==(const S21Matrix &other);  // checking for equality of matrices
+  // operators overloads: assigning the values of another matrix, taking the
+  // storage of another matrix with an equal memory resource (the elements
+  // are copied otherwise) and checking for equality of matrices
+  S21Matrix &operator=(const S21Matrix &other) = default;
+  S21Matrix &operator=(S21Matrix &&other) = default;
+  bool operator==(const S21Matrix &other);
 
-  double operator()(int row, int col) const;  // index operator overload
+  // evaluating an expression into the matrix in one pass
+  template <class E>
+  S21Matrix &operator=(const S21MatrixExpr<E> &expr);
+  template <class L, class R>
+  S21Matrix &operator=(S21ProductExpr<L, R> &&product);
 
-  S21Matrix operator+(const S21Matrix &other);    // addition of two matrices
   S21Matrix &operator+=(const S21Matrix &other);  // assignment of addition
+  template <class E>
+  S21Matrix &operator+=(const S21MatrixExpr<E> &expr);
 
-  S21Matrix operator-(
-      const S21Matrix &other);  // subtracting one matrix from another
   S21Matrix &operator-=(const S21Matrix &other);  // assignment of subtracting
-
-  void operator*(const S21Matrix &other);  // matrix multiplication
-  void operator*(const double num);        // multiplying a matrix by a number
+  template <class E>
+  S21Matrix &operator-=(const S21MatrixExpr<E> &expr);
 
   S21Matrix &operator*=(
       const S21Matrix &other);  // assignment of multiplication
   S21Matrix &operator*=(const double num);
 
-  // public methods
-  bool EqMatrix(const S21Matrix &other) const noexcept;
-  void SumMatrix(const S21Matrix &other);
-  void SubMatrix(const S21Matrix &other);
-  void MulNumber(const double num) noexcept;
+  // public methods, EqMatrix, SumMatrix, SubMatrix, MulNumber, AxpyMatrix
+  // and MinorMatrix come from S21MatrixBase
+  using Base::AxpyMatrix;
+  using Base::EqMatrix;
+  using Base::SubMatrix;
+  using Base::SumMatrix;
   void MulMatrix(const S21Matrix &other);
-  S21Matrix Transpose() noexcept;
-  S21Matrix CalcComplements();
-  double Determinant();
-  S21Matrix InverseMatrix();
-  S21Matrix MinorMatrix(int rm_row, int rm_col);
-
-  // getters
-  int GetRows() const noexcept;
-  int GetCols() const noexcept;
-  double GetValue(int row, int col) const;
-
-  // setters
-  void SetValue(int row, int col, double value);
-  void SetRows(int rows);
-  void SetCols(int cols);
+  S21Matrix Transpose() const &noexcept;
+  S21Matrix Transpose() &&;
+  S21Matrix CalcComplements() const;
+  double Determinant() const;
+  S21Matrix InverseMatrix() const;
+  // X with this * X = rhs, the least squares one for more rows than columns
+  S21Matrix Solve(const S21Matrix &rhs) const;
+
+  // the comparison within a tolerance, see s21_compare.h, stops at the
+  // first mismatch; MaxDifference is the largest |this - other| at its
+  // first position in row-major order, or the first NaN difference
+  bool EqMatrix(const S21Matrix &other,
+                s21::Tolerance tolerance) const noexcept;
+  s21::Extremum MaxDifference(const S21Matrix &other) const;
+
+  // reductions, see s21_reduce.h: the sums are added pairwise, so their
+  // rounding error grows with the logarithm of the number of elements, and
+  // large matrices are split over the thread pool
+  double Sum() const;
+  S21Matrix RowSums() const;  // the rows x 1 sums of the rows
+  S21Matrix ColSums() const;  // the 1 x cols sums of the columns
+  double Trace() const;
+  double Norm(s21::Norm norm = s21::Norm::kFrobenius) const;
+  double Dot(const S21Matrix &other) const;  // the sum of the products
+  s21::Extremum Min() const;
+  s21::Extremum Max() const;
+  // the sums, the extrema and their positions in one pass
+  s21::Summary Summarize() const;
+
+  // the same with blocks, rows, columns or other views as the operand
+  bool EqMatrix(S21MatrixView other) const noexcept;
+  void SumMatrix(S21MatrixView other);
+  void SubMatrix(S21MatrixView other);
+  void AxpyMatrix(const double num, S21MatrixView other);
+  void MulMatrix(S21MatrixView other);
+
+  // the same with an execution, see S21MatrixBase
+  S21Matrix Transpose(s21::Execution execution) const;
+  template <class Policy, class = s21::EnableIfPolicy<Policy>>
+  S21Matrix Transpose(Policy &&) const {
+    return Transpose(s21::kExecutionOf<Policy>);
+  }
+
+  // views of the elements that copy nothing, see s21_matrix_view.h
+  S21MatrixView View() const;
+  S21MutableMatrixView View();
+  S21MatrixView Block(int row, int col, int rows, int cols) const;
+  S21MutableMatrixView Block(int row, int col, int rows, int cols);
+  S21MatrixView Row(int row) const;
+  S21MutableMatrixView Row(int row);
+  S21MatrixView Col(int col) const;
+  S21MutableMatrixView Col(int col);
 };
 
+// the lazy operators +, - and * are defined with the expression templates
+#include "s21_expression.h"
+// the views of blocks, rows and columns
+#include "s21_matrix_view.h"
+// the matrices of float, complex and other element types
+#include "s21_basic_matrix.h"
+
 #endif  // SRC_S21MATRIX_H_
@@ -0,0 +1,298 @@
+#include "s21_matrix_view.h"
+
+#include <atomic>
+#include <climits>
+#include <functional>
+
+#include "s21_runs.h"
+#include "s21_simd.h"
+#include "s21_strassen.h"
+
+namespace {
+
+s21::RunOperand<const double> Operand(const S21MatrixView &view) noexcept {
+  return {view.Data(), view.GetRowStride(), view.GetColStride()};
+}
+
+s21::RunOperand<double> Operand(const S21MutableMatrixView &view) noexcept {
+  return {view.Data(), view.GetRowStride(), view.GetColStride()};
+}
+
+}  // namespace
+
+// CONSTRUCTORS
+
+S21MatrixView::S21MatrixView(const double *data, int rows, int cols,
+                             std::ptrdiff_t row_stride,
+                             std::ptrdiff_t col_stride)
+    : data_(data),
+      rows_(rows),
+      cols_(cols),
+      row_stride_(row_stride),
+      col_stride_(cols == 1 ? 1 : col_stride) {
+  if (rows < 0 || cols < 0)
+    throw std::invalid_argument(
+        "The number of rows and columns must not be negative");
+  if (row_stride < 0 || col_stride < 0)
+    throw std::invalid_argument("The strides must not be negative");
+}
+
+S21MatrixView::S21MatrixView(const S21Matrix &matrix)
+    : S21MatrixView(matrix.View()) {}
+
+S21MutableMatrixView::S21MutableMatrixView(double *data, int rows, int cols,
+                                           std::ptrdiff_t row_stride,
+                                           std::ptrdiff_t col_stride)
+    : S21MatrixView(data, rows, cols, row_stride, col_stride) {}
+
+S21MutableMatrixView::S21MutableMatrixView(S21Matrix &matrix)
+    : S21MutableMatrixView(matrix.View()) {}
+
+// the elements of the view were writable when it was created
+S21MutableMatrixView::S21MutableMatrixView(S21MatrixView view) noexcept
+    : S21MatrixView(view) {}
+
+// ACCESSORS
+
+int S21MatrixView::GetRows() const noexcept { return rows_; }
+
+int S21MatrixView::GetCols() const noexcept { return cols_; }
+
+std::ptrdiff_t S21MatrixView::GetRowStride() const noexcept {
+  return row_stride_;
+}
+
+std::ptrdiff_t S21MatrixView::GetColStride() const noexcept {
+  return col_stride_;
+}
+
+const double *S21MatrixView::Data() const noexcept { return data_; }
+
+double *S21MutableMatrixView::Data() const noexcept {
+  return const_cast<double *>(data_);
+}
+
+double S21MatrixView::GetValue(int row, int col) const {
+  if (row < 0 || rows_ <= row)
+    throw std::out_of_range("The row index is incorrect");
+  if (col < 0 || cols_ <= col)
+    throw std::out_of_range("The column index is incorrect");
+  return data_[row * row_stride_ + col * col_stride_];
+}
+
+double S21MatrixView::operator()(int row, int col) const {
+  return GetValue(row, col);
+}
+
+void S21MutableMatrixView::SetValue(int row, int col, double value) const {
+  if (row < 0 || rows_ <= row)
+    throw std::out_of_range("The row index is incorrect");
+  if (col < 0 || cols_ <= col)
+    throw std::out_of_range("The column index is incorrect");
+  Data()[row * row_stride_ + col * col_stride_] = value;
+}
+
+S21MatrixView::const_iterator S21MatrixView::begin() const noexcept {
+  return {data_, cols_, row_stride_, col_stride_, 0};
+}
+
+S21MatrixView::const_iterator S21MatrixView::end() const noexcept {
+  return {data_, cols_, row_stride_, col_stride_,
+          static_cast<std::ptrdiff_t>(rows_) * cols_};
+}
+
+S21MutableMatrixView::iterator S21MutableMatrixView::begin() const noexcept {
+  return {Data(), cols_, row_stride_, col_stride_, 0};
+}
+
+S21MutableMatrixView::iterator S21MutableMatrixView::end() const noexcept {
+  return {Data(), cols_, row_stride_, col_stride_,
+          static_cast<std::ptrdiff_t>(rows_) * cols_};
+}
+
+// SLICING
+
+S21MatrixView S21MatrixView::Block(int row, int col, int rows,
+                                   int cols) const {
+  if (row < 0 || col < 0 || rows < 1 || cols < 1 || rows_ - row < rows ||
+      cols_ - col < cols)
+    throw std::out_of_range("The block exceeds the dimension of the matrix");
+  return S21MatrixView(data_ + row * row_stride_ + col * col_stride_, rows,
+                       cols, row_stride_, col_stride_);
+}
+
+S21MatrixView S21MatrixView::Row(int row) const {
+  return Block(row, 0, 1, cols_);
+}
+
+S21MatrixView S21MatrixView::Col(int col) const {
+  return Block(0, col, rows_, 1);
+}
+
+S21MatrixView S21MatrixView::Strided(int row_step, int col_step) const {
+  if (row_step < 1 || col_step < 1)
+    throw std::invalid_argument("The steps must be greater than 0");
+  return S21MatrixView(data_, (rows_ + row_step - 1) / row_step,
+                       (cols_ + col_step - 1) / col_step,
+                       row_stride_ * row_step, col_stride_ * col_step);
+}
+
+S21MatrixView S21MatrixView::Transposed() const noexcept {
+  S21MatrixView result = *this;
+  std::swap(result.rows_, result.cols_);
+  std::swap(result.row_stride_, result.col_stride_);
+  return result;
+}
+
+S21MutableMatrixView S21MutableMatrixView::Block(int row, int col, int rows,
+                                                 int cols) const {
+  return S21MutableMatrixView(S21MatrixView::Block(row, col, rows, cols));
+}
+
+S21MutableMatrixView S21MutableMatrixView::Row(int row) const {
+  return S21MutableMatrixView(S21MatrixView::Row(row));
+}
+
+S21MutableMatrixView S21MutableMatrixView::Col(int col) const {
+  return S21MutableMatrixView(S21MatrixView::Col(col));
+}
+
+S21MutableMatrixView S21MutableMatrixView::Strided(int row_step,
+                                                   int col_step) const {
+  return S21MutableMatrixView(S21MatrixView::Strided(row_step, col_step));
+}
+
+S21MutableMatrixView S21MutableMatrixView::Transposed() const noexcept {
+  return S21MutableMatrixView(S21MatrixView::Transposed());
+}
+
+// AUXILIARY METHODS
+
+S21MatrixView S21MatrixView::Packed(S21MatrixView view,
+                                    std::optional<S21Matrix> &storage) {
+  if (view.col_stride_ == 1 && view.row_stride_ <= INT_MAX) return view;
+  return storage.emplace(view);
+}
+
+// the address ranges from the first to the last element intersect
+bool S21MatrixView::Overlaps(S21MatrixView other) const noexcept {
+  if (!rows_ || !cols_ || !other.rows_ || !other.cols_) return false;
+  const std::less<const double *> less;
+  const double *last = data_ + (rows_ - 1) * row_stride_ +
+                       (cols_ - 1) * col_stride_;
+  const double *other_last = other.data_ +
+                             (other.rows_ - 1) * other.row_stride_ +
+                             (other.cols_ - 1) * other.col_stride_;
+  return !less(last, other.data_) && !less(other_last, data_);
+}
+
+// the operand shares elements with the view in another layout, an
+// operation has to copy it first, so that it never reads an element after
+// writing it
+bool S21MatrixView::Aliases(S21MatrixView other) const noexcept {
+  return Overlaps(other) &&
+         (data_ != other.data_ || row_stride_ != other.row_stride_ ||
+          col_stride_ != other.col_stride_);
+}
+
+void S21MutableMatrixView::CheckSize(S21MatrixView other) const {
+  if (rows_ != other.GetRows() || cols_ != other.GetCols())
+    throw std::invalid_argument("Matrices should have the same size");
+}
+
+// OPERATIONS
+
+bool S21MatrixView::EqMatrix(S21MatrixView other) const noexcept {
+  if (rows_ != other.rows_ || cols_ != other.cols_) return false;
+  const auto &simd = s21::Simd();
+  // the runs left after the first mismatch are skipped
+  std::atomic<bool> equality{true};
+  s21::ForEachRun(rows_, cols_, Operand(*this), Operand(other),
+                  [&](const double *y, const double *x, std::size_t n) {
+                    if (equality.load(std::memory_order_relaxed) &&
+                        !simd.equal(y, x, n))
+                      equality.store(false, std::memory_order_relaxed);
+                  });
+  return equality;
+}
+
+// the product reads the rows of the operands with adjacent columns in place
+S21Matrix S21MatrixView::MulMatrix(S21MatrixView other,
+                                   std::pmr::memory_resource *resource) const {
+  if (cols_ != other.rows_)
+    throw std::invalid_argument(
+        "The number of columns of the matrix1 must be "
+        "equal to the number of rows of the matrix2");
+  std::optional<S21Matrix> a_storage, b_storage;
+  const S21MatrixView a = Packed(*this, a_storage),
+                      b = Packed(other, b_storage);
+  S21Matrix result(rows_, other.cols_, resource);
+  s21::Multiply(rows_, other.cols_, cols_, a.data_,
+                static_cast<int>(a.row_stride_), b.data_,
+                static_cast<int>(b.row_stride_), result.matrix_,
+                result.stride_);
+  return result;
+}
+
+S21Matrix S21MatrixView::Transpose() const { return S21Matrix(Transposed()); }
+
+// the operations that factorize the matrix work on a copy anyway
+
+S21Matrix S21MatrixView::CalcComplements() const {
+  return S21Matrix(*this).CalcComplements();
+}
+
+double S21MatrixView::Determinant() const {
+  return S21Matrix(*this).Determinant();
+}
+
+S21Matrix S21MatrixView::InverseMatrix() const {
+  return S21Matrix(*this).InverseMatrix();
+}
+
+// the minor is copied from the view directly
+S21Matrix S21MatrixView::MinorMatrix(int rm_row, int rm_col) const {
+  if (rows_ != cols_) throw std::invalid_argument("The matrix is not square");
+  if (rm_row < 0 || rows_ <= rm_row || rm_col < 0 || cols_ <= rm_col)
+    throw std::out_of_range("The index exceeds the dimension of the matrix");
+  S21Matrix minor_mx(rows_ - 1, cols_ - 1);
+  for (auto i = 0; i < rows_ - 1; ++i) {
+    const double *row = data_ + (i < rm_row ? i : i + 1) * row_stride_;
+    for (auto j = 0; j < cols_ - 1; ++j)
+      minor_mx.RowPtr(i)[j] = row[(j < rm_col ? j : j + 1) * col_stride_];
+  }
+  return minor_mx;
+}
+
+void S21MutableMatrixView::SumMatrix(S21MatrixView other) const {
+  CheckSize(other);
+  if (Aliases(other)) return SumMatrix(S21Matrix(other));
+  s21::ForEachRun(rows_, cols_, Operand(*this), Operand(other),
+                  s21::Simd().add);
+}
+
+void S21MutableMatrixView::SubMatrix(S21MatrixView other) const {
+  CheckSize(other);
+  if (Aliases(other)) return SubMatrix(S21Matrix(other));
+  s21::ForEachRun(rows_, cols_, Operand(*this), Operand(other),
+                  s21::Simd().sub);
+}
+
+void S21MutableMatrixView::AxpyMatrix(const double num,
+                                      S21MatrixView other) const {
+  CheckSize(other);
+  if (Aliases(other)) return AxpyMatrix(num, S21Matrix(other));
+  const auto &simd = s21::Simd();
+  s21::ForEachRun(rows_, cols_, Operand(*this), Operand(other),
+                  [&](double *y, const double *x, std::size_t n) {
+                    simd.axpy(y, num, x, n);
+                  });
+}
+
+void S21MutableMatrixView::MulNumber(const double num) const noexcept {
+  const auto &simd = s21::Simd();
+  s21::ForEachRun(rows_, cols_, Operand(*this), Operand(*this),
+                  [&](double *y, const double *, std::size_t n) {
+                    simd.scale(y, num, n);
+                  });
+}
@@ -0,0 +1,106 @@
+#ifndef SRC_S21_MATRIX_VIEW_H_
+#define SRC_S21_MATRIX_VIEW_H_
+
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+
+#include "s21_matrix_oop.h"
+
+// A read-only window on elements that the view does not own: the element
+// (i, j) is at data[i * row_stride + j * col_stride]. Blocks, rows,
+// columns, every k-th row or column and the transposition are views of the
+// same elements with other shapes and strides, so slicing copies nothing.
+// A view of a matrix must not outlive it and is invalidated when the
+// matrix is resized or assigned a matrix of another size.
+class S21MatrixView {
+ public:
+  using const_iterator = S21MatrixIterator<const double>;
+
+  S21MatrixView(const double *data, int rows, int cols,
+                std::ptrdiff_t row_stride, std::ptrdiff_t col_stride = 1);
+  S21MatrixView(const S21Matrix &matrix);  // NOLINT, the whole matrix
+
+  // getters
+  int GetRows() const noexcept;
+  int GetCols() const noexcept;
+  std::ptrdiff_t GetRowStride() const noexcept;
+  std::ptrdiff_t GetColStride() const noexcept;
+  const double *Data() const noexcept;
+  double GetValue(int row, int col) const;
+  double operator()(int row, int col) const;
+  // the elements in row-major order, see s21_matrix_iterator.h
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+
+  // slicing
+  S21MatrixView Block(int row, int col, int rows, int cols) const;
+  S21MatrixView Row(int row) const;
+  S21MatrixView Col(int col) const;
+  // every row_step-th row and col_step-th column from the first ones
+  S21MatrixView Strided(int row_step, int col_step) const;
+  S21MatrixView Transposed() const noexcept;
+
+  // read-only operations, the results are new matrices
+  bool EqMatrix(S21MatrixView other) const noexcept;
+  S21Matrix MulMatrix(S21MatrixView other,
+                      std::pmr::memory_resource *resource =
+                          std::pmr::get_default_resource()) const;
+  S21Matrix Transpose() const;
+  S21Matrix CalcComplements() const;
+  double Determinant() const;
+  S21Matrix InverseMatrix() const;
+  S21Matrix MinorMatrix(int rm_row, int rm_col) const;
+
+ protected:
+  // the view itself, or its copy in the storage when its columns are not
+  // adjacent or its leading dimension exceeds int, for Gemm
+  static S21MatrixView Packed(S21MatrixView view,
+                              std::optional<S21Matrix> &storage);
+  // the views reach some of the same addresses
+  bool Overlaps(S21MatrixView other) const noexcept;
+  bool Aliases(S21MatrixView other) const noexcept;
+
+  const double *data_;
+  int rows_, cols_;
+  std::ptrdiff_t row_stride_;  // distance between the starts of two rows
+  std::ptrdiff_t col_stride_;  // distance between two elements of a row
+};
+
+// A view whose elements can be changed through it. Like a pointer, a const
+// view still writes the elements, it only cannot be pointed elsewhere. The
+// operations read the whole operand before writing an element that it
+// shares with the view, the rows of the view must not overlap each other.
+class S21MutableMatrixView : public S21MatrixView {
+ public:
+  using iterator = S21MatrixIterator<double>;
+
+  S21MutableMatrixView(double *data, int rows, int cols,
+                       std::ptrdiff_t row_stride,
+                       std::ptrdiff_t col_stride = 1);
+  S21MutableMatrixView(S21Matrix &matrix);  // NOLINT, the whole matrix
+
+  double *Data() const noexcept;
+  void SetValue(int row, int col, double value) const;
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+
+  // slicing keeps the elements writable
+  S21MutableMatrixView Block(int row, int col, int rows, int cols) const;
+  S21MutableMatrixView Row(int row) const;
+  S21MutableMatrixView Col(int col) const;
+  S21MutableMatrixView Strided(int row_step, int col_step) const;
+  S21MutableMatrixView Transposed() const noexcept;
+
+  // the operations on the viewed elements
+  void SumMatrix(S21MatrixView other) const;
+  void SubMatrix(S21MatrixView other) const;
+  void AxpyMatrix(const double num, S21MatrixView other) const;
+  void MulNumber(const double num) const noexcept;
+
+ private:
+  explicit S21MutableMatrixView(S21MatrixView view) noexcept;
+  void CheckSize(S21MatrixView other) const;
+};
+
+#endif  // SRC_S21_MATRIX_VIEW_H_
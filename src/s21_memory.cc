@@ -0,0 +1,150 @@
+#include "s21_memory.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+
+// alignment of slabs and chunks, enough for every matrix buffer
+constexpr std::size_t kChunkAlignment = 64;
+
+}  // namespace
+
+// POOL
+
+S21PoolResource::S21PoolResource(std::pmr::memory_resource *upstream)
+    : upstream_(upstream), free_lists_() {}
+
+S21PoolResource::~S21PoolResource() { Release(); }
+
+void S21PoolResource::Release() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto &slab : slabs_)
+    upstream_->deallocate(slab.memory, slab.bytes, kChunkAlignment);
+  slabs_.clear();
+  std::fill(free_lists_, free_lists_ + kClasses, nullptr);
+}
+
+std::pmr::memory_resource *S21PoolResource::GetUpstream() const noexcept {
+  return upstream_;
+}
+
+// the index of the smallest class that holds the request, -1 if none does
+int S21PoolResource::SizeClass(std::size_t bytes) noexcept {
+  if (bytes > kMaxBlock) return -1;
+  int index = 0;
+  for (std::size_t block = kMinBlock; block < bytes; block <<= 1) ++index;
+  return index;
+}
+
+// a block from the free list of its class; an empty list is refilled from a
+// new slab cut into blocks of that class
+void *S21PoolResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  int index = SizeClass(bytes);
+  // the blocks of every class are aligned to at least kChunkAlignment
+  if (index < 0 || alignment > kChunkAlignment)
+    return upstream_->allocate(bytes, alignment);
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!free_lists_[index]) {
+    const std::size_t block = kMinBlock << index;
+    const std::size_t slab_bytes = std::max(kSlabSize, block);
+    slabs_.reserve(slabs_.size() + 1);
+    char *memory =
+        static_cast<char *>(upstream_->allocate(slab_bytes, kChunkAlignment));
+    slabs_.push_back({memory, slab_bytes});
+    for (std::size_t offset = slab_bytes; offset >= block; offset -= block) {
+      auto *free_block = reinterpret_cast<FreeBlock *>(memory + offset - block);
+      free_block->next = free_lists_[index];
+      free_lists_[index] = free_block;
+    }
+  }
+  FreeBlock *result = free_lists_[index];
+  free_lists_[index] = result->next;
+  return result;
+}
+
+void S21PoolResource::do_deallocate(void *ptr, std::size_t bytes,
+                                    std::size_t alignment) {
+  int index = SizeClass(bytes);
+  if (index < 0 || alignment > kChunkAlignment) {
+    upstream_->deallocate(ptr, bytes, alignment);
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto *free_block = static_cast<FreeBlock *>(ptr);
+  free_block->next = free_lists_[index];
+  free_lists_[index] = free_block;
+}
+
+bool S21PoolResource::do_is_equal(
+    const std::pmr::memory_resource &other) const noexcept {
+  return this == &other;
+}
+
+// ARENA
+
+S21ArenaResource::S21ArenaResource(std::size_t initial_size,
+                                   std::pmr::memory_resource *upstream)
+    : upstream_(upstream),
+      next_size_(std::max(initial_size, kChunkAlignment)),
+      current_(nullptr),
+      left_(0),
+      used_(0) {}
+
+S21ArenaResource::~S21ArenaResource() {
+  for (auto &chunk : chunks_)
+    upstream_->deallocate(chunk.memory, chunk.bytes, kChunkAlignment);
+}
+
+// a single chunk is rewound and kept, several chunks are returned and the
+// next chunk is made large enough for all of them, so a scope that repeats
+// the same allocations is served from one chunk without the upstream
+void S21ArenaResource::Release() noexcept {
+  if (chunks_.size() == 1) {
+    current_ = static_cast<char *>(chunks_.front().memory);
+    left_ = chunks_.front().bytes;
+  } else {
+    std::size_t total = 0;
+    for (auto &chunk : chunks_) {
+      total += chunk.bytes;
+      upstream_->deallocate(chunk.memory, chunk.bytes, kChunkAlignment);
+    }
+    chunks_.clear();
+    next_size_ = std::max(next_size_, total);
+    current_ = nullptr;
+    left_ = 0;
+  }
+  used_ = 0;
+}
+
+std::size_t S21ArenaResource::GetUsed() const noexcept { return used_; }
+
+// the request is cut from the current chunk, a chunk that is too small is
+// left as it is and a new one, twice as large as the previous, is taken
+void *S21ArenaResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  std::size_t padding =
+      (alignment - reinterpret_cast<std::uintptr_t>(current_) % alignment) %
+      alignment;
+  if (!current_ || padding + bytes > left_) {
+    std::size_t chunk_bytes = std::max(next_size_, bytes + alignment);
+    chunks_.reserve(chunks_.size() + 1);
+    current_ = static_cast<char *>(upstream_->allocate(
+        chunk_bytes, std::max(alignment, kChunkAlignment)));
+    chunks_.push_back({current_, chunk_bytes});
+    left_ = chunk_bytes;
+    next_size_ = chunk_bytes * 2;
+    padding = 0;
+  }
+  void *result = current_ + padding;
+  current_ += padding + bytes;
+  left_ -= padding + bytes;
+  used_ += bytes;
+  return result;
+}
+
+void S21ArenaResource::do_deallocate(void *, std::size_t, std::size_t) {}
+
+bool S21ArenaResource::do_is_equal(
+    const std::pmr::memory_resource &other) const noexcept {
+  return this == &other;
+}
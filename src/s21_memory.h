@@ -0,0 +1,99 @@
+#ifndef SRC_S21_MEMORY_H_
+#define SRC_S21_MEMORY_H_
+
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+// Memory resources for the storage of S21Matrix. A matrix allocates and
+// frees its buffer through the std::pmr::memory_resource it was created
+// with; matrices that do not choose one use std::pmr::get_default_resource().
+
+// a pool of blocks of fixed size classes (powers of two from kMinBlock to
+// kMaxBlock bytes): freed blocks are kept in per-class free lists and
+// handed out again without going to the upstream resource; larger requests
+// are passed to the upstream directly. The pool is thread-safe and returns
+// all its memory to the upstream when destroyed.
+class S21PoolResource : public std::pmr::memory_resource {
+ public:
+  static constexpr std::size_t kMinBlock = 64;
+  static constexpr std::size_t kMaxBlock = std::size_t(1) << 16;
+  // blocks are carved from slabs of at least this size
+  static constexpr std::size_t kSlabSize = std::size_t(1) << 18;
+
+  explicit S21PoolResource(
+      std::pmr::memory_resource *upstream = std::pmr::get_default_resource());
+  S21PoolResource(const S21PoolResource &) = delete;
+  S21PoolResource &operator=(const S21PoolResource &) = delete;
+  ~S21PoolResource() override;
+
+  // returns every slab to the upstream, blocks handed out become invalid
+  void Release();
+  std::pmr::memory_resource *GetUpstream() const noexcept;
+
+ private:
+  static constexpr int kClasses = 11;  // 64 B, 128 B, ..., 64 KiB
+
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+  struct Slab {
+    void *memory;
+    std::size_t bytes;
+  };
+
+  static int SizeClass(std::size_t bytes) noexcept;
+
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void *ptr, std::size_t bytes,
+                     std::size_t alignment) override;
+  bool do_is_equal(
+      const std::pmr::memory_resource &other) const noexcept override;
+
+  std::pmr::memory_resource *upstream_;
+  std::mutex mutex_;
+  FreeBlock *free_lists_[kClasses];
+  std::vector<Slab> slabs_;
+};
+
+// a bump allocator for a scope: allocation moves a pointer through chunks
+// taken from the upstream, deallocation does nothing, and all the memory is
+// reclaimed at once by Release() or the destructor. Matrices allocated from
+// an arena must not outlive it. The arena is not thread-safe.
+class S21ArenaResource : public std::pmr::memory_resource {
+ public:
+  explicit S21ArenaResource(
+      std::size_t initial_size = std::size_t(1) << 16,
+      std::pmr::memory_resource *upstream = std::pmr::get_default_resource());
+  S21ArenaResource(const S21ArenaResource &) = delete;
+  S21ArenaResource &operator=(const S21ArenaResource &) = delete;
+  ~S21ArenaResource() override;
+
+  // reclaims everything allocated from the arena, the memory is kept in one
+  // chunk for the next allocations
+  void Release() noexcept;
+  // bytes handed out since the last release
+  std::size_t GetUsed() const noexcept;
+
+ private:
+  struct Chunk {
+    void *memory;
+    std::size_t bytes;
+  };
+
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void *ptr, std::size_t bytes,
+                     std::size_t alignment) override;
+  bool do_is_equal(
+      const std::pmr::memory_resource &other) const noexcept override;
+
+  std::pmr::memory_resource *upstream_;
+  std::size_t next_size_;  // the size of the next chunk
+  std::vector<Chunk> chunks_;
+  char *current_;
+  std::size_t left_;
+  std::size_t used_;
+};
+
+#endif  // SRC_S21_MEMORY_H_
@@ -1,88 +1,145 @@
 #include "s21_matrix_oop.h"
 
-// OPERATIONS
-
-// comparison of two matrices by dimension and cell values
-bool S21Matrix::EqMatrix(const S21Matrix &other) const noexcept {
-  bool equality = (rows_ == other.rows_ && cols_ == other.cols_);
-  for (auto i = 0; i < rows_; ++i)
-    for (auto j = 0; j < cols_ && equality; ++j)
-      equality = (matrix_[i][j] == other.matrix_[i][j]);
-  return equality;
-}
-
-// matrix addition
-void S21Matrix::SumMatrix(const S21Matrix &other) {
-  if (rows_ != other.rows_ || cols_ != other.cols_)
-    throw std::invalid_argument("Matrices should have the same size");
-  for (auto i = 0; i < rows_; ++i)
-    for (auto j = 0; j < cols_; ++j) matrix_[i][j] += other.matrix_[i][j];
-}
+#include "s21_lu.h"
+#include "s21_qr.h"
+#include "s21_stats.h"
+#include "s21_strassen.h"
+#include "s21_transpose.h"
 
-// matrix subtraction
-void S21Matrix::SubMatrix(const S21Matrix &other) {
-  if (rows_ != other.rows_ || cols_ != other.cols_)
-    throw std::invalid_argument("Matrices should have the same size");
-  for (auto i = 0; i < rows_; ++i)
-    for (auto j = 0; j < cols_; ++j) matrix_[i][j] -= other.matrix_[i][j];
-}
+// OPERATIONS
 
-// multiplying matrix values by a number
-void S21Matrix::MulNumber(const double num) noexcept {
-  for (auto i = 0; i < rows_; ++i)
-    for (auto j = 0; j < cols_; ++j) matrix_[i][j] *= num;
-}
+// the element-wise operations, the maps and MinorMatrix are shared with the
+// other element types in s21_matrix_base.h
 
 // multiplying the matrix by the transmitted matrix
 void S21Matrix::MulMatrix(const S21Matrix &other) {
+  S21_STATS_SCOPE(kMulMatrix, Elements());
   if (cols_ != other.rows_)
     throw std::invalid_argument(
         "The number of columns of the matrix1 must be "
         "equal to the number of rows of the matrix2");
   // the dimension of the resulting matrix is [rows_, other.cols_]
-  double **res_matr = MatrixMemoryAllocation(rows_, other.cols_);
-  for (auto row = 0; row < rows_; ++row)
-    for (auto col = 0; col < other.cols_; ++col)
-      for (auto k = 0; k < cols_; ++k)
-        res_matr[row][col] += matrix_[row][k] * other.matrix_[k][col];
+  int res_stride = CalcStride(other.cols_);
+  double *res_matr = MatrixMemoryAllocation(rows_, res_stride);
+  s21::Multiply(rows_, other.cols_, cols_, matrix_, stride_, other.matrix_,
+                other.stride_, res_matr, res_stride);
   ClearMatrix();
   matrix_ = res_matr;
   cols_ = other.cols_;
+  stride_ = res_stride;
+}
+
+// the operations with views as the operand run on s21_matrix_view.cc
+
+bool S21Matrix::EqMatrix(S21MatrixView other) const noexcept {
+  S21_STATS_SCOPE(kEqMatrix, Elements());
+  return View().EqMatrix(other);
+}
+
+void S21Matrix::SumMatrix(S21MatrixView other) {
+  S21_STATS_SCOPE(kSumMatrix, Elements());
+  View().SumMatrix(other);
+}
+
+void S21Matrix::SubMatrix(S21MatrixView other) {
+  S21_STATS_SCOPE(kSubMatrix, Elements());
+  View().SubMatrix(other);
+}
+
+void S21Matrix::AxpyMatrix(const double num, S21MatrixView other) {
+  S21_STATS_SCOPE(kAxpyMatrix, Elements());
+  View().AxpyMatrix(num, other);
+}
+
+// the product is computed into a new buffer of the same memory resource
+void S21Matrix::MulMatrix(S21MatrixView other) {
+  S21_STATS_SCOPE(kMulMatrix, Elements());
+  S21Matrix product = View().MulMatrix(other, resource_);
+  SwapStorage(product);
+}
+
+// the transpose with an execution, a sequenced one keeps the parallel
+// loops of the transpose on the calling thread
+S21Matrix S21Matrix::Transpose(s21::Execution execution) const {
+  s21::ExecutionScope scope(execution);
+  return Transpose();
 }
 
 // creates a new transposed matrix from the current one and returns it
-S21Matrix S21Matrix::Transpose() noexcept {
-  S21Matrix result = S21Matrix(cols_, rows_);
-  for (auto i = 0; i < rows_; ++i)
-    for (auto j = 0; j < cols_; ++j) result.matrix_[j][i] = matrix_[i][j];
+// with the tiled transposition of s21_transpose.h
+S21Matrix S21Matrix::Transpose() const &noexcept {
+  S21_STATS_SCOPE(kTranspose, Elements());
+  S21Matrix result = S21Matrix(cols_, rows_, ResultResource());
+  s21::Transpose(rows_, cols_, matrix_, stride_, result.matrix_,
+                 result.stride_);
   return result;
 }
 
-S21Matrix S21Matrix::CalcComplements() {
-  S21Matrix calc_mx = S21Matrix(rows_, cols_);
+// a temporary matrix is transposed in its own storage when the storage fits
+// the result: square matrices exchange blocks across the diagonal, dense
+// rectangular ones whose result is dense too permute the buffer by cycles
+S21Matrix S21Matrix::Transpose() && {
+  S21_STATS_SCOPE(kTranspose, Elements());
+  if (rows_ == cols_) {
+    s21::TransposeSquare(rows_, matrix_, stride_);
+  } else if (IsContiguous() && CalcStride(rows_) == rows_) {
+    s21::TransposeCycles(rows_, cols_, matrix_);
+    std::swap(rows_, cols_);
+    stride_ = cols_;
+  } else {
+    return static_cast<const S21Matrix &>(*this).Transpose();
+  }
+  return std::move(*this);
+}
+
+// matrix of algebraic complements (cofactors)
+// orders up to 4 and singular matrices use the cofactor formulas, the others
+// are derived from one LU factorization as det(A) * (A^-1)^T
+S21Matrix S21Matrix::CalcComplements() const {
+  S21_STATS_SCOPE(kCalcComplements, Elements());
+  if (rows_ != cols_) throw std::invalid_argument("The matrix is not square");
+  S21Matrix calc_mx = S21Matrix(rows_, cols_, ResultResource());
+  if (rows_ == 1) {
+    calc_mx.RowPtr(0)[0] = 1;
+    return calc_mx;
+  }
+  if (rows_ > kCofactorMaxOrder + 1) {
+    S21LUDecomposition lu(*this);
+    if (!lu.IsSingular()) {
+      S21Matrix inverse_mx = lu.InverseMatrix();
+      s21::Transpose(rows_, cols_, inverse_mx.matrix_, inverse_mx.stride_,
+                     calc_mx.matrix_, calc_mx.stride_);
+      calc_mx.MulNumber(lu.Determinant());
+      return calc_mx;
+    }
+  }
   for (auto row = 0; row < rows_; ++row)
     for (auto col = 0; col < cols_; ++col)
-      calc_mx.matrix_[row][col] =
-          std::pow(-1, row + col) * MinorMatrix(row, col).Determinant();
+      calc_mx.RowPtr(row)[col] =
+          ((row + col) % 2 ? -1 : 1) * MinorMatrix(row, col).Determinant();
   return calc_mx;
 }
 
-double S21Matrix::Determinant() {
+// orders up to 3 are expanded directly, larger ones go through LU in O(n^3)
+double S21Matrix::Determinant() const {
+  S21_STATS_SCOPE(kDeterminant, Elements());
   if (rows_ != cols_) throw std::invalid_argument("The matrix is not square");
-  if (rows_ == 1) return matrix_[0][0];
-  if (rows_ == 2)
-    return matrix_[0][0] * matrix_[1][1] - matrix_[0][1] * matrix_[1][0];
-  // calculation of the determinant of the order >=(3, 3)
-  double det = 0;
-  for (auto col = 0; col < cols_; ++col) {
-    double mnog = std::pow(-1, col) * matrix_[0][col];
-    S21Matrix new_mx = MinorMatrix(0, col);
-    det += mnog * new_mx.Determinant();
-  }
-  return det;
+  if (rows_ > kCofactorMaxOrder)
+    return S21LUDecomposition(*this).Determinant();
+  const double *r0 = RowPtr(0);
+  if (rows_ == 1) return r0[0];
+  const double *r1 = RowPtr(1);
+  if (rows_ == 2) return r0[0] * r1[1] - r0[1] * r1[0];
+  const double *r2 = RowPtr(2);
+  return r0[0] * (r1[1] * r2[2] - r1[2] * r2[1]) -
+         r0[1] * (r1[0] * r2[2] - r1[2] * r2[0]) +
+         r0[2] * (r1[0] * r2[1] - r1[1] * r2[0]);
 }
 
-S21Matrix S21Matrix::InverseMatrix() {
+S21Matrix S21Matrix::InverseMatrix() const {
+  S21_STATS_SCOPE(kInverseMatrix, Elements());
+  if (rows_ > kCofactorMaxOrder)
+    return S21LUDecomposition(*this).InverseMatrix();
   double det = Determinant();
   if (!det) throw std::invalid_argument("The determinant of the matrix is 0");
   S21Matrix inverse_mx = CalcComplements().Transpose();
@@ -90,21 +147,19 @@ S21Matrix S21Matrix::InverseMatrix() {
   return inverse_mx;
 }
 
-S21Matrix S21Matrix::MinorMatrix(int rm_row, int rm_col) {
-  if (rows_ != cols_) throw std::invalid_argument("The matrix is not square");
-
-  // an N-1 order matrix for computing a minor
-  S21Matrix minor_mx = S21Matrix(rows_ - 1, cols_ - 1);
-  // deleting a row
-  for (auto minor_i = 0, orig_i = 0; orig_i < rows_; ++minor_i, ++orig_i) {
-    (minor_i == rm_row) ? ++orig_i : orig_i;
-    // deleting a column
-    for (auto minor_j = 0, orig_j = 0; orig_j < cols_; ++minor_j, ++orig_j) {
-      (minor_j == rm_col) ? ++orig_j : orig_j;
-      // writing a value from the original matrix to the minor matrix
-      if (orig_i < rows_ && orig_j < cols_)
-        minor_mx.matrix_[minor_i][minor_j] = matrix_[orig_i][orig_j];
-    }
-  }
-  return minor_mx;
+// factor and solve instead of multiplying by the inverse: LU with partial
+// pivoting for a square matrix, Householder QR for a taller one; repeated
+// solves with the same matrix should keep S21LUDecomposition,
+// S21CholeskyDecomposition or S21QRDecomposition and call its Solve
+S21Matrix S21Matrix::Solve(const S21Matrix &rhs) const {
+  S21_STATS_SCOPE(kSolve, Elements());
+  if (rows_ < cols_)
+    throw std::invalid_argument(
+        "The number of rows must not be less than the number of columns");
+  if (rhs.rows_ != rows_)
+    throw std::invalid_argument(
+        "The number of rows of the right-hand side must be "
+        "equal to the number of rows of the matrix");
+  if (rows_ == cols_) return S21LUDecomposition(*this).Solve(rhs);
+  return S21QRDecomposition(*this).Solve(rhs);
 }
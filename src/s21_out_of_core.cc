@@ -0,0 +1,381 @@
+#include "s21_out_of_core.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <condition_variable>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "s21_gemm.h"
+#include "s21_io.h"
+
+namespace s21 {
+
+namespace {
+
+// the tiles are multiples of this size, unless the whole dimension is less
+constexpr long long kTileQuantum = 8;
+
+// a file for positioned reads and writes, closed by the destructor
+class File {
+ public:
+  File(const std::string &path, int flags)
+      : path_(path), fd_(::open(path.c_str(), flags | O_CLOEXEC, 0644)) {
+    if (fd_ < 0)
+      throw std::runtime_error("The file " + path_ + " could not be opened");
+  }
+  File(const File &) = delete;
+  File &operator=(const File &) = delete;
+  ~File() { ::close(fd_); }
+
+  void Read(void *data, std::size_t bytes, std::uint64_t offset) const {
+    auto *p = static_cast<char *>(data);
+    while (bytes) {
+      const ssize_t done = ::pread(fd_, p, bytes, static_cast<off_t>(offset));
+      if (done < 0 && errno == EINTR) continue;
+      if (done <= 0)
+        throw std::runtime_error("The file " + path_ + " could not be read");
+      p += done;
+      bytes -= done;
+      offset += done;
+    }
+  }
+
+  void Write(const void *data, std::size_t bytes, std::uint64_t offset) const {
+    const auto *p = static_cast<const char *>(data);
+    while (bytes) {
+      const ssize_t done = ::pwrite(fd_, p, bytes, static_cast<off_t>(offset));
+      if (done < 0 && errno == EINTR) continue;
+      if (done <= 0)
+        throw std::runtime_error("The file " + path_ +
+                                 " could not be written");
+      p += done;
+      bytes -= done;
+      offset += done;
+    }
+  }
+
+  // the new bytes of a longer file read as zeros
+  void Resize(std::uint64_t length) const {
+    if (::ftruncate(fd_, static_cast<off_t>(length)))
+      throw std::runtime_error("The file " + path_ + " could not be resized");
+  }
+
+ private:
+  std::string path_;
+  int fd_;
+};
+
+// a matrix file and the positions of its elements
+struct Operand {
+  Operand(const std::string &path, int flags, const MatrixFileHeader &header)
+      : file(path, flags), header(header) {}
+
+  std::uint64_t Offset(std::int64_t row, std::int64_t col) const noexcept {
+    return header.data_offset +
+           static_cast<std::uint64_t>(row * header.stride + col) *
+               sizeof(double);
+  }
+
+  // the rows of a block follow each other in the file
+  bool Contiguous(int cols, int ld) const noexcept {
+    return cols == header.stride && ld == cols;
+  }
+
+  File file;
+  MatrixFileHeader header;
+};
+
+// copies a rows x cols block at (row, col) of the file into the tile with
+// the leading dimension ld
+void ReadTile(const Operand &operand, int row, int col, int rows, int cols,
+              double *tile, int ld) {
+  if (operand.Contiguous(cols, ld)) {
+    operand.file.Read(tile, static_cast<std::size_t>(rows) * cols *
+                                sizeof(double),
+                      operand.Offset(row, col));
+    return;
+  }
+  for (auto i = 0; i < rows; ++i)
+    operand.file.Read(tile + static_cast<std::ptrdiff_t>(i) * ld,
+                      cols * sizeof(double), operand.Offset(row + i, col));
+}
+
+void WriteTile(const Operand &operand, int row, int col, int rows, int cols,
+               const double *tile, int ld) {
+  if (operand.Contiguous(cols, ld)) {
+    operand.file.Write(tile, static_cast<std::size_t>(rows) * cols *
+                                 sizeof(double),
+                       operand.Offset(row, col));
+    return;
+  }
+  for (auto i = 0; i < rows; ++i)
+    operand.file.Write(tile + static_cast<std::ptrdiff_t>(i) * ld,
+                       cols * sizeof(double), operand.Offset(row + i, col));
+}
+
+// the tiles of the product: the steps go over the depth for each tile of C
+// and over the tiles of C row by row
+struct Plan {
+  int m, n, k;
+  int mb, nb, kb;
+  int row_tiles, col_tiles, depth_tiles;
+
+  std::ptrdiff_t Steps() const noexcept {
+    return static_cast<std::ptrdiff_t>(row_tiles) * col_tiles * depth_tiles;
+  }
+  std::size_t SlotSize() const noexcept {
+    return static_cast<std::size_t>(kb) * (mb + nb);
+  }
+  // the buffer of two slots and the tile of C
+  std::size_t BufferSize() const noexcept {
+    return 2 * SlotSize() + static_cast<std::size_t>(mb) * nb;
+  }
+  int RowTile(std::ptrdiff_t step) const noexcept {
+    return static_cast<int>(step / (depth_tiles * col_tiles));
+  }
+  int ColTile(std::ptrdiff_t step) const noexcept {
+    return static_cast<int>(step / depth_tiles % col_tiles);
+  }
+  int DepthTile(std::ptrdiff_t step) const noexcept {
+    return static_cast<int>(step % depth_tiles);
+  }
+  // the size of the tile at the index, the last tiles can be shorter
+  static int Extent(int index, int tile, int size) noexcept {
+    return std::min(tile, size - index * tile);
+  }
+};
+
+long long RoundTile(long long size) noexcept {
+  return size >= kTileQuantum ? size / kTileQuantum * kTileQuantum : size;
+}
+
+// square tiles of C as large as the budget allows next to two tiles of A
+// and B each, the depth of the tiles takes the rest of the budget
+Plan MakePlan(int m, int n, int k, std::size_t memory_budget) {
+  const auto doubles = static_cast<long long>(memory_budget / sizeof(double));
+  const auto square = static_cast<long long>(std::sqrt(doubles / 5.0));
+  const long long side = RoundTile(std::max(1LL, square));
+  Plan plan = Plan();
+  plan.m = m;
+  plan.n = n;
+  plan.k = k;
+  plan.mb = static_cast<int>(std::min<long long>(m, side));
+  plan.nb = static_cast<int>(std::min<long long>(n, side));
+  const long long depth =
+      (doubles - static_cast<long long>(plan.mb) * plan.nb) /
+      (2LL * (plan.mb + plan.nb));
+  if (depth < 1)
+    throw std::invalid_argument("The memory budget is too small for the tiles");
+  plan.kb = static_cast<int>(depth >= k ? k : RoundTile(depth));
+  plan.row_tiles = (m + plan.mb - 1) / plan.mb;
+  plan.col_tiles = (n + plan.nb - 1) / plan.nb;
+  plan.depth_tiles = (k + plan.kb - 1) / plan.kb;
+  return plan;
+}
+
+// the tiles of A and B of one step
+struct Slot {
+  double *a;
+  double *b;
+};
+
+// reads the tiles of the steps in order on its own thread, one step ahead
+// of the multiplication: the two slots alternate between the reader and
+// Gemm, so the reading of a step overlaps the product of the previous one
+class TilePrefetcher {
+ public:
+  TilePrefetcher(const Operand &a, const Operand &b, const Plan &plan,
+                 double *buffer)
+      : a_(a),
+        b_(b),
+        plan_(plan),
+        loaded_(0),
+        released_(0),
+        bytes_read_(0),
+        stop_(false) {
+    for (auto slot = 0; slot < 2; ++slot) {
+      slots_[slot].a = buffer + slot * plan.SlotSize();
+      slots_[slot].b =
+          slots_[slot].a + static_cast<std::ptrdiff_t>(plan.mb) * plan.kb;
+    }
+    thread_ = std::thread(&TilePrefetcher::Run, this);
+  }
+  TilePrefetcher(const TilePrefetcher &) = delete;
+  TilePrefetcher &operator=(const TilePrefetcher &) = delete;
+
+  ~TilePrefetcher() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    changed_.notify_all();
+    thread_.join();
+  }
+
+  // waits for the tiles of the step, rethrows the error of the reader
+  const Slot &Acquire(std::ptrdiff_t step) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    changed_.wait(lock, [&] { return loaded_ > step || error_; });
+    if (error_) std::rethrow_exception(error_);
+    return slots_[step % 2];
+  }
+
+  // the slot of the step is free for the step after the next one
+  void Release(std::ptrdiff_t step) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      released_ = step + 1;
+    }
+    changed_.notify_all();
+  }
+
+  std::uint64_t BytesRead() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_read_;
+  }
+
+ private:
+  void Run() noexcept {
+    try {
+      for (std::ptrdiff_t step = 0; step < plan_.Steps(); ++step) {
+        {
+          std::unique_lock<std::mutex> lock(mutex_);
+          changed_.wait(lock, [&] { return step - released_ < 2 || stop_; });
+          if (stop_) return;
+        }
+        const std::uint64_t bytes = Load(step, slots_[step % 2]);
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          bytes_read_ += bytes;
+          loaded_ = step + 1;
+        }
+        changed_.notify_all();
+      }
+    } catch (...) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        error_ = std::current_exception();
+      }
+      changed_.notify_all();
+    }
+  }
+
+  // returns the number of bytes read
+  std::uint64_t Load(std::ptrdiff_t step, const Slot &slot) {
+    const int i = plan_.RowTile(step), j = plan_.ColTile(step),
+              p = plan_.DepthTile(step);
+    const int rows = Plan::Extent(i, plan_.mb, plan_.m),
+              cols = Plan::Extent(j, plan_.nb, plan_.n),
+              depth = Plan::Extent(p, plan_.kb, plan_.k);
+    ReadTile(a_, i * plan_.mb, p * plan_.kb, rows, depth, slot.a, plan_.kb);
+    ReadTile(b_, p * plan_.kb, j * plan_.nb, depth, cols, slot.b, plan_.nb);
+    return static_cast<std::uint64_t>(depth) * (rows + cols) * sizeof(double);
+  }
+
+  const Operand &a_;
+  const Operand &b_;
+  const Plan &plan_;
+  Slot slots_[2];
+  std::thread thread_;
+  std::mutex mutex_;  // guards the members below
+  std::condition_variable changed_;
+  std::ptrdiff_t loaded_;    // the steps whose tiles are in the slots
+  std::ptrdiff_t released_;  // the steps that Gemm is done with
+  std::uint64_t bytes_read_;
+  std::exception_ptr error_;
+  bool stop_;
+};
+
+// the checksum of the rows of a finished panel of C, read back through the
+// scratch buffer; the hash of a row is the seed of the next one
+std::uint64_t HashRows(const Operand &c, int row, int rows, double *scratch,
+                       std::size_t scratch_size, std::uint64_t seed) {
+  const auto cols = static_cast<int>(c.header.cols);
+  const int chunk = static_cast<int>(
+      std::min<std::size_t>(scratch_size, static_cast<std::size_t>(cols)));
+  for (auto i = row; i < row + rows; ++i) {
+    Hasher64 hasher(seed);
+    for (auto j = 0; j < cols; j += chunk) {
+      const std::size_t bytes = std::min(chunk, cols - j) * sizeof(double);
+      c.file.Read(scratch, bytes, c.Offset(i, j));
+      hasher.Update(scratch, bytes);
+    }
+    seed = hasher.Digest();
+  }
+  return seed;
+}
+
+}  // namespace
+
+OutOfCoreReport MulMatrixFiles(const std::string &a_path,
+                               const std::string &b_path,
+                               const std::string &c_path,
+                               std::size_t memory_budget) {
+  const MatrixFileHeader a_header = ReadMatrixHeader(a_path);
+  const MatrixFileHeader b_header = ReadMatrixHeader(b_path);
+  if (a_header.cols != b_header.rows)
+    throw std::invalid_argument(
+        "The number of columns of the matrix1 must be "
+        "equal to the number of rows of the matrix2");
+  std::error_code error;
+  if (std::filesystem::equivalent(c_path, a_path, error) ||
+      std::filesystem::equivalent(c_path, b_path, error))
+    throw std::invalid_argument("The result cannot overwrite an operand");
+  const Plan plan = MakePlan(static_cast<int>(a_header.rows),
+                             static_cast<int>(b_header.cols),
+                             static_cast<int>(a_header.cols), memory_budget);
+
+  const Operand a(a_path, O_RDONLY, a_header);
+  const Operand b(b_path, O_RDONLY, b_header);
+  // the header is written last, an unfinished file is not a matrix file
+  MatrixFileHeader c_header = MakeMatrixHeader(plan.m, plan.n, 0);
+  const Operand c(c_path, O_RDWR | O_CREAT | O_TRUNC, c_header);
+  c.file.Resize(c.Offset(plan.m, 0));
+
+  std::vector<double> buffer(plan.BufferSize());
+  double *c_tile = buffer.data() + 2 * plan.SlotSize();
+  const std::size_t c_tile_size = static_cast<std::size_t>(plan.mb) * plan.nb;
+  OutOfCoreReport report = {plan.mb, plan.nb, plan.kb,
+                            buffer.size() * sizeof(double), 0, 0};
+  std::uint64_t checksum = 0, bytes_read_back = 0;
+  {
+    TilePrefetcher prefetcher(a, b, plan, buffer.data());
+    std::ptrdiff_t step = 0;
+    for (auto i = 0; i < plan.row_tiles; ++i) {
+      const int rows = Plan::Extent(i, plan.mb, plan.m);
+      for (auto j = 0; j < plan.col_tiles; ++j) {
+        const int cols = Plan::Extent(j, plan.nb, plan.n);
+        std::fill(c_tile, c_tile + c_tile_size, 0.0);
+        for (auto p = 0; p < plan.depth_tiles; ++p, ++step) {
+          const Slot &slot = prefetcher.Acquire(step);
+          Gemm(rows, cols, Plan::Extent(p, plan.kb, plan.k), 1.0, slot.a,
+               plan.kb, slot.b, plan.nb, c_tile, plan.nb);
+          prefetcher.Release(step);
+        }
+        WriteTile(c, i * plan.mb, j * plan.nb, rows, cols, c_tile, plan.nb);
+        report.bytes_written +=
+            static_cast<std::uint64_t>(rows) * cols * sizeof(double);
+      }
+      checksum = HashRows(c, i * plan.mb, rows, c_tile, c_tile_size, checksum);
+      bytes_read_back +=
+          static_cast<std::uint64_t>(rows) * plan.n * sizeof(double);
+    }
+    report.bytes_read = prefetcher.BytesRead() + bytes_read_back;
+  }
+  c_header.checksum = checksum;
+  c.file.Write(&c_header, sizeof(c_header), 0);
+  report.bytes_written += sizeof(c_header);
+  return report;
+}
+
+}  // namespace s21
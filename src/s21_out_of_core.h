@@ -0,0 +1,40 @@
+#ifndef SRC_S21_OUT_OF_CORE_H_
+#define SRC_S21_OUT_OF_CORE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace s21 {
+
+// the tiles chosen for an out-of-core product and the traffic it caused
+struct OutOfCoreReport {
+  int tile_rows;             // rows of the tiles of A and C
+  int tile_cols;             // columns of the tiles of B and C
+  int tile_depth;            // columns of A and rows of B in one tile
+  std::size_t buffer_bytes;  // the tile buffers, never above the budget
+  std::uint64_t bytes_read;
+  std::uint64_t bytes_written;
+};
+
+// C = A * B for operands that do not fit in memory. A, B and the result are
+// matrix files of s21_io.h. The product is computed one tile of C at a time
+// with Gemm over tiles of A and B that are read from the files, a background
+// thread reads the tiles of the next step while the current one is
+// multiplied. The finished tiles of C are written to their place in the
+// result file and the rows are hashed once a whole panel of them is done.
+//
+// memory_budget caps the bytes of the tile buffers: two tiles of A and B
+// for the prefetching and one tile of C. The page cache of the files and
+// the packing buffers of Gemm, a few megabytes, are not counted. Throws
+// std::invalid_argument when the shapes do not match or the budget cannot
+// hold the smallest tiles, std::runtime_error when a file is not valid or
+// cannot be read or written.
+OutOfCoreReport MulMatrixFiles(const std::string &a_path,
+                               const std::string &b_path,
+                               const std::string &c_path,
+                               std::size_t memory_budget);
+
+}  // namespace s21
+
+#endif  // SRC_S21_OUT_OF_CORE_H_
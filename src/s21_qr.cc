@@ -0,0 +1,212 @@
+#include "s21_qr.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "s21_gemm.h"
+#include "s21_thread_pool.h"
+#include "s21_transpose.h"
+#include "s21_triangular.h"
+
+// CONSTRUCTORS
+
+// factorizes a copy of the matrix allocated from its memory resource, the
+// copy of a matrix over external rows uses the default resource
+S21QRDecomposition::S21QRDecomposition(const S21Matrix &matrix)
+    : qr_(matrix, matrix.ResultResource()),
+      tau_(matrix.GetCols()),
+      full_rank_(true) {
+  if (matrix.GetRows() < matrix.GetCols())
+    throw std::invalid_argument(
+        "The number of rows must not be less than the number of columns");
+  Factorize();
+}
+
+// blocked factorization in place: the reflectors of a panel of kBlock
+// columns are computed and applied to the panel one by one, then they are
+// applied to the columns to the right of the panel at once with two matrix
+// products
+void S21QRDecomposition::Factorize() {
+  const int m = qr_.rows_, n = qr_.cols_;
+  // |R_kk| is compared with the norm of the column k of A, so columns of
+  // different scales, like the features of a least squares fit, are judged
+  // each on its own; the norms are scaled against overflow
+  std::vector<double> column_max(n), column_norms(n);
+  for (auto i = 0; i < m; ++i)
+    for (auto j = 0; j < n; ++j)
+      column_max[j] = std::max(column_max[j], std::fabs(qr_.RowPtr(i)[j]));
+  for (auto i = 0; i < m; ++i)
+    for (auto j = 0; j < n; ++j)
+      if (column_max[j] > 0) {
+        const double scaled = qr_.RowPtr(i)[j] / column_max[j];
+        column_norms[j] += scaled * scaled;
+      }
+  for (auto j = 0; j < n; ++j)
+    column_norms[j] = column_max[j] * std::sqrt(column_norms[j]);
+
+  for (auto k0 = 0; k0 < n; k0 += kBlock) {
+    const int k1 = std::min(n, k0 + kBlock);
+    FactorizePanel(k0, k1);
+    UpdateTrailing(k0, k1);
+  }
+  // diagonal elements below this threshold are rounding noise
+  const double epsilon =
+      std::max(m, n) * std::numeric_limits<double>::epsilon();
+  for (auto k = 0; k < n; ++k)
+    if (std::fabs(qr_.RowPtr(k)[k]) <= column_norms[k] * epsilon)
+      full_rank_ = false;
+}
+
+// the reflector H = I - tau * v * v^T of column k with v[k] = 1 maps the
+// column to beta * e_k; v below the diagonal replaces the column, beta is
+// the diagonal element of R
+void S21QRDecomposition::FactorizePanel(int k0, int k1) {
+  const int m = qr_.rows_;
+  double w[kBlock];
+  for (auto k = k0; k < k1; ++k) {
+    double *pivot_row = qr_.RowPtr(k);
+    // the norm below the diagonal, scaled against overflow
+    double norm_scale = 0, norm = 0;
+    for (auto i = k + 1; i < m; ++i)
+      norm_scale = std::max(norm_scale, std::fabs(qr_.RowPtr(i)[k]));
+    if (norm_scale == 0) {
+      tau_[k] = 0;
+      continue;
+    }
+    for (auto i = k + 1; i < m; ++i) {
+      const double scaled = qr_.RowPtr(i)[k] / norm_scale;
+      norm += scaled * scaled;
+    }
+    norm = norm_scale * std::sqrt(norm);
+    const double alpha = pivot_row[k];
+    const double beta = -std::copysign(std::hypot(alpha, norm), alpha);
+    tau_[k] = (beta - alpha) / beta;
+    const double factor = 1 / (alpha - beta);
+    for (auto i = k + 1; i < m; ++i) qr_.RowPtr(i)[k] *= factor;
+    pivot_row[k] = beta;
+    // H * A for the remaining columns of the panel: w = A^T * v
+    const int first = k + 1, width = k1 - first;
+    if (!width) continue;
+    std::copy(pivot_row + first, pivot_row + k1, w);
+    for (auto i = k + 1; i < m; ++i) {
+      const double *row = qr_.RowPtr(i);
+      for (auto j = 0; j < width; ++j) w[j] += row[k] * row[first + j];
+    }
+    for (auto j = 0; j < width; ++j) pivot_row[first + j] -= tau_[k] * w[j];
+    for (auto i = k + 1; i < m; ++i) {
+      double *row = qr_.RowPtr(i);
+      const double scaled = tau_[k] * row[k];
+      for (auto j = 0; j < width; ++j) row[first + j] -= scaled * w[j];
+    }
+  }
+}
+
+// the reflectors of the panel form Q = I - V * T * V^T with an upper
+// triangular T; the columns right of the panel are replaced with
+// Q^T * A = A - V * (T^T * (V^T * A))
+void S21QRDecomposition::UpdateTrailing(int k0, int k1) {
+  const int m = qr_.rows_, n = qr_.cols_, stride = qr_.stride_;
+  const int rows = m - k0, nb = k1 - k0, rest = n - k1;
+  if (!rest) return;
+  // V with its unit diagonal and zeros above, and its transposition
+  std::vector<double> v(static_cast<std::size_t>(rows) * nb),
+      v_t(static_cast<std::size_t>(nb) * rows), t(nb * nb),
+      w(static_cast<std::size_t>(nb) * rest);
+  for (auto i = 0; i < rows; ++i) {
+    const double *row = qr_.RowPtr(k0 + i) + k0;
+    for (auto c = 0; c < nb; ++c)
+      v[i * nb + c] = i > c ? row[c] : i == c ? 1 : 0;
+  }
+  s21::Transpose(rows, nb, v.data(), nb, v_t.data(), rows);
+  // T(0:c, c) = -tau_c * T(0:c, 0:c) * V(:, 0:c)^T * V(:, c)
+  double z[kBlock];
+  for (auto c = 0; c < nb; ++c) {
+    const double *v_c = v_t.data() + c * rows;
+    for (auto r = 0; r < c; ++r) {
+      const double *v_r = v_t.data() + r * rows;
+      z[r] = 0;
+      for (auto i = c; i < rows; ++i) z[r] += v_r[i] * v_c[i];
+    }
+    for (auto r = 0; r < c; ++r) {
+      double sum = 0;
+      for (auto s = r; s < c; ++s) sum += t[r * nb + s] * z[s];
+      t[r * nb + c] = -tau_[k0 + c] * sum;
+    }
+    t[c * nb + c] = tau_[k0 + c];
+  }
+  double *trailing = qr_.RowPtr(k0) + k1;
+  s21::Gemm(nb, rest, rows, 1, v_t.data(), rows, trailing, stride, w.data(),
+            rest);
+  // W = T^T * W from the last row up, the rows above are still unchanged
+  for (auto r = nb - 1; r >= 0; --r) {
+    double *w_r = w.data() + static_cast<std::size_t>(r) * rest;
+    for (auto j = 0; j < rest; ++j) w_r[j] *= t[r * nb + r];
+    for (auto s = 0; s < r; ++s) {
+      const double *w_s = w.data() + static_cast<std::size_t>(s) * rest;
+      const double factor = t[s * nb + r];
+      for (auto j = 0; j < rest; ++j) w_r[j] += factor * w_s[j];
+    }
+  }
+  s21::Gemm(rows, rest, nb, -1, v.data(), nb, w.data(), rest, trailing,
+            stride);
+}
+
+// ACCESSORS
+
+int S21QRDecomposition::GetRows() const noexcept { return qr_.rows_; }
+
+int S21QRDecomposition::GetCols() const noexcept { return qr_.cols_; }
+
+bool S21QRDecomposition::IsFullRank() const noexcept { return full_rank_; }
+
+// returns the packed factors: R and the reflectors without their unit
+// diagonal
+const S21Matrix &S21QRDecomposition::GetFactors() const noexcept {
+  return qr_;
+}
+
+// OPERATIONS
+
+// minimizing ||A * X - B|| for every column of B: Q^T * B reflector by
+// reflector, blocks of columns of B are distributed over the thread pool,
+// then backward substitution with R on the first rows
+S21Matrix S21QRDecomposition::Solve(const S21Matrix &rhs) const {
+  const int m = qr_.rows_, n = qr_.cols_;
+  if (rhs.rows_ != m)
+    throw std::invalid_argument(
+        "The number of rows of the right-hand side must be "
+        "equal to the number of rows of the matrix");
+  if (!full_rank_)
+    throw std::invalid_argument("The matrix does not have full column rank");
+  S21Matrix work(rhs);
+  auto apply_columns = [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+    const int c0 = static_cast<int>(first), c1 = static_cast<int>(last);
+    std::vector<double> w(c1 - c0);
+    for (auto k = 0; k < n; ++k) {
+      const double tau = tau_[k];
+      if (tau == 0) continue;
+      double *pivot_row = work.RowPtr(k);
+      std::copy(pivot_row + c0, pivot_row + c1, w.begin());
+      for (auto i = k + 1; i < m; ++i) {
+        const double *row = work.RowPtr(i), v = qr_.RowPtr(i)[k];
+        for (auto j = c0; j < c1; ++j) w[j - c0] += v * row[j];
+      }
+      for (auto j = c0; j < c1; ++j) pivot_row[j] -= tau * w[j - c0];
+      for (auto i = k + 1; i < m; ++i) {
+        double *row = work.RowPtr(i);
+        const double scaled = tau * qr_.RowPtr(i)[k];
+        for (auto j = c0; j < c1; ++j) row[j] -= scaled * w[j - c0];
+      }
+    }
+  };
+  s21::ParallelFor(rhs.cols_, kApplyColumns, apply_columns);
+  s21::SolveTriangular(s21::Triangle::kUpper, n, work.cols_, qr_.matrix_,
+                       qr_.stride_, work.matrix_, work.stride_);
+  if (m == n) return work;
+  S21Matrix result(n, rhs.cols_);
+  for (auto i = 0; i < n; ++i)
+    std::copy(work.RowPtr(i), work.RowPtr(i) + work.cols_, result.RowPtr(i));
+  return result;
+}
@@ -0,0 +1,40 @@
+#ifndef SRC_S21_QR_H_
+#define SRC_S21_QR_H_
+
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// Householder QR factorization of a matrix with at least as many rows as
+// columns: A = Q * R, where Q is orthogonal and R is upper triangular. Q is
+// kept as its Householder reflectors below the diagonal of R, never formed
+// explicitly. Solve returns the least squares solution of an overdetermined
+// system, and the exact one of a square system, without the normal
+// equations, whose condition number is the squared one of A.
+class S21QRDecomposition {
+ private:
+  // columns in a panel of the blocked factorization
+  static constexpr int kBlock = 32;
+  // columns of the right-hand side multiplied by Q^T in one task
+  static constexpr int kApplyColumns = 16;
+
+  S21Matrix qr_;             // R on and above the diagonal, reflectors below
+  std::vector<double> tau_;  // tau_[k] scales the reflector of column k
+  bool full_rank_;           // no diagonal element of R vanished
+
+  void Factorize();
+  void FactorizePanel(int k0, int k1);
+  void UpdateTrailing(int k0, int k1);
+
+ public:
+  explicit S21QRDecomposition(const S21Matrix &matrix);
+
+  int GetRows() const noexcept;
+  int GetCols() const noexcept;
+  bool IsFullRank() const noexcept;
+  const S21Matrix &GetFactors() const noexcept;
+
+  S21Matrix Solve(const S21Matrix &rhs) const;
+};
+
+#endif  // SRC_S21_QR_H_
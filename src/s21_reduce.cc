@@ -0,0 +1,266 @@
+#include "s21_reduce.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+#include "s21_runs.h"
+#include "s21_simd.h"
+#include "s21_stats.h"
+#include "s21_thread_pool.h"
+
+namespace {
+
+constexpr double kInf = std::numeric_limits<double>::infinity();
+
+// elements per call of a reduction kernel, the results of the blocks are
+// added pairwise
+constexpr int kReduceBlock = 256;
+
+// rows added directly into the column sums before the blocks of rows are
+// added pairwise
+constexpr int kColumnBlock = 16;
+
+// the sums of squares stay exact in range for the absolute values between
+// these bounds, the others are scaled by a power of two first
+constexpr double kSquareLow = 0x1p-500, kSquareHigh = 0x1p+500;
+
+// pairwise summation of a stream of partial sums: a new one is merged with
+// the ones of the same level like the carries of a binary counter, so the
+// rounding error grows with the logarithm of their number
+class PairwiseSum {
+ public:
+  void Add(double value) noexcept {
+    int level = 0;
+    for (auto carries = count_++; carries & 1; carries >>= 1)
+      value += levels_[level++];
+    levels_[level] = value;
+  }
+  double Result() const noexcept {
+    double result = 0;
+    int level = 0;
+    for (auto bits = count_; bits; bits >>= 1, ++level)
+      if (bits & 1) result += levels_[level];
+    return result;
+  }
+
+ private:
+  std::uint64_t count_ = 0;
+  double levels_[64];  // the sum of 2^level partial sums
+};
+
+// the sum of the n elements or of their absolute values from x, block by
+// block
+double RunSum(const double *x, int n, bool absolute = false) {
+  const auto &simd = s21::Simd();
+  const auto kernel = absolute ? simd.abs_sum : simd.sum;
+  PairwiseSum sum;
+  for (auto b = 0; b < n; b += kReduceBlock)
+    sum.Add(kernel(x + b, std::min(kReduceBlock, n - b)));
+  return sum.Result();
+}
+
+// the running reductions of Summarize over a part of the matrix, the
+// extrema at row-major indices
+struct Moments {
+  PairwiseSum sum, abs_sum, square_sum;
+  double min = kInf, max = -kInf;
+  std::ptrdiff_t argmin = -1, argmax = -1;
+
+  // the n elements from x, the first one at the index first; the position
+  // of an extremum is searched only in the blocks that improve it
+  void AddRun(const double *x, int n, std::ptrdiff_t first) {
+    const auto &simd = s21::Simd();
+    for (auto b = 0; b < n; b += kReduceBlock) {
+      const int count = std::min(kReduceBlock, n - b);
+      const double *block = x + b;
+      double out[5];
+      simd.moments(block, count, out);
+      sum.Add(out[0]);
+      abs_sum.Add(out[1]);
+      square_sum.Add(out[2]);
+      if (out[3] < min) {
+        min = out[3];
+        argmin = first + b + (std::find(block, block + count, min) - block);
+      }
+      if (max < out[4]) {
+        max = out[4];
+        argmax = first + b + (std::find(block, block + count, max) - block);
+      }
+    }
+  }
+
+  // the moments of the following elements
+  void Merge(const Moments &other) noexcept {
+    sum.Add(other.sum.Result());
+    abs_sum.Add(other.abs_sum.Result());
+    square_sum.Add(other.square_sum.Result());
+    if (other.min < min) min = other.min, argmin = other.argmin;
+    if (max < other.max) max = other.max, argmax = other.argmax;
+  }
+};
+
+// the extremum at a row-major index
+s21::Extremum At(double value, std::ptrdiff_t index, int cols) noexcept {
+  if (index < 0) return {value, -1, -1};
+  return {value, static_cast<int>(index / cols),
+          static_cast<int>(index % cols)};
+}
+
+}  // namespace
+
+// REDUCTIONS
+
+double S21Matrix::Sum() const {
+  S21_STATS_SCOPE(kReduce, Elements());
+  const auto partial = s21::ReduceRowTasks<PairwiseSum>(
+      rows_, cols_, [&](PairwiseSum &sum, int begin, int end) {
+        for (auto i = begin; i < end; ++i) sum.Add(RunSum(RowPtr(i), cols_));
+      });
+  PairwiseSum sum;
+  for (const auto &task : partial) sum.Add(task.Result());
+  return sum.Result();
+}
+
+S21Matrix S21Matrix::RowSums() const {
+  S21_STATS_SCOPE(kReduce, Elements());
+  S21Matrix result(rows_, 1, ResultResource());
+  s21::ForEachRow(rows_, cols_, [&](int i) {
+    result.RowPtr(i)[0] = RunSum(RowPtr(i), cols_);
+  });
+  return result;
+}
+
+S21Matrix S21Matrix::ColSums() const {
+  S21_STATS_SCOPE(kReduce, Elements());
+  return ColumnSums(false);
+}
+
+// each task adds its rows into a row of sums: blocks of kColumnBlock rows
+// directly, the blocks pairwise through rows of partial sums of 2^level
+// blocks; the rows of the tasks are then added pairwise as well
+S21Matrix S21Matrix::ColumnSums(bool absolute) const {
+  const auto &simd = s21::Simd();
+  const int cols = cols_;
+  auto add_row = [&](double *sums, const double *row) {
+    if (!absolute) return simd.add(sums, row, cols);
+    for (auto j = 0; j < cols; ++j) sums[j] += std::fabs(row[j]);
+  };
+  auto partial = s21::ReduceRowTasks<std::vector<double>>(
+      rows_, cols, [&](std::vector<double> &sums, int begin, int end) {
+        std::vector<std::vector<double>> levels;
+        std::vector<double> block(cols);
+        std::uint64_t count = 0;
+        for (auto i = begin; i < end; ++count) {
+          std::fill(block.begin(), block.end(), 0.0);
+          for (const int last = std::min(end, i + kColumnBlock); i < last; ++i)
+            add_row(block.data(), RowPtr(i));
+          std::size_t level = 0;
+          for (auto carries = count; carries & 1; carries >>= 1)
+            simd.add(block.data(), levels[level++].data(), cols);
+          if (levels.size() == level) levels.emplace_back(cols);
+          levels[level].swap(block);
+        }
+        sums.assign(cols, 0.0);
+        std::size_t level = 0;
+        for (auto bits = count; bits; bits >>= 1, ++level)
+          if (bits & 1) simd.add(sums.data(), levels[level].data(), cols);
+      });
+  for (std::size_t step = 1; step < partial.size(); step *= 2)
+    for (std::size_t task = 0; task + step < partial.size(); task += 2 * step)
+      simd.add(partial[task].data(), partial[task + step].data(), cols);
+  S21Matrix result(1, cols, ResultResource());
+  if (!partial.empty())
+    std::copy(partial[0].begin(), partial[0].end(), result.RowPtr(0));
+  return result;
+}
+
+double S21Matrix::Trace() const {
+  S21_STATS_SCOPE(kReduce, Elements());
+  if (rows_ != cols_) throw std::invalid_argument("The matrix is not square");
+  PairwiseSum sum;
+  for (auto i = 0; i < rows_; ++i) sum.Add(RowPtr(i)[i]);
+  return sum.Result();
+}
+
+// the norms of the columns and the rows take the sums of the absolute
+// values; the Frobenius norm falls back to a second pass over the elements
+// scaled by a power of two when their squares would overflow or underflow
+double S21Matrix::Norm(s21::Norm norm) const {
+  S21_STATS_SCOPE(kReduce, Elements());
+  if (!Elements()) return 0;
+  if (norm == s21::Norm::kOne) {
+    const S21Matrix sums = ColumnSums(true);
+    return *std::max_element(sums.RowPtr(0), sums.RowPtr(0) + cols_);
+  }
+  if (norm == s21::Norm::kInf) {
+    std::vector<double> sums(rows_);
+    s21::ForEachRow(rows_, cols_,
+                    [&](int i) { sums[i] = RunSum(RowPtr(i), cols_, true); });
+    return *std::max_element(sums.begin(), sums.end());
+  }
+  const s21::Summary summary = Summarize();
+  const double max_abs =
+      std::max(std::fabs(summary.min.value), std::fabs(summary.max.value));
+  if (norm == s21::Norm::kMaxAbs) return max_abs;
+  if (!std::isfinite(max_abs) || max_abs == 0 ||
+      (kSquareLow <= max_abs && max_abs <= kSquareHigh))
+    return std::sqrt(summary.square_sum);
+  const double scale = std::ldexp(1.0, -std::ilogb(max_abs));
+  const auto partial = s21::ReduceRowTasks<PairwiseSum>(
+      rows_, cols_, [&](PairwiseSum &sum, int begin, int end) {
+        std::vector<double> scaled(cols_);
+        for (auto i = begin; i < end; ++i) {
+          const double *row = RowPtr(i);
+          for (auto j = 0; j < cols_; ++j) scaled[j] = row[j] * scale;
+          sum.Add(s21::Simd().dot(scaled.data(), scaled.data(), cols_));
+        }
+      });
+  PairwiseSum sum;
+  for (const auto &task : partial) sum.Add(task.Result());
+  return std::sqrt(sum.Result()) / scale;
+}
+
+double S21Matrix::Dot(const S21Matrix &other) const {
+  S21_STATS_SCOPE(kReduce, Elements());
+  if (rows_ != other.rows_ || cols_ != other.cols_)
+    throw std::invalid_argument("Matrices should have the same size");
+  const auto &simd = s21::Simd();
+  const auto partial = s21::ReduceRowTasks<PairwiseSum>(
+      rows_, cols_, [&](PairwiseSum &sum, int begin, int end) {
+        for (auto i = begin; i < end; ++i) {
+          const double *x = RowPtr(i), *y = other.RowPtr(i);
+          for (auto b = 0; b < cols_; b += kReduceBlock)
+            sum.Add(simd.dot(x + b, y + b, std::min(kReduceBlock, cols_ - b)));
+        }
+      });
+  PairwiseSum sum;
+  for (const auto &task : partial) sum.Add(task.Result());
+  return sum.Result();
+}
+
+s21::Extremum S21Matrix::Min() const { return Summarize().min; }
+
+s21::Extremum S21Matrix::Max() const { return Summarize().max; }
+
+// the tasks are merged in the order of their rows, so the first extremum
+// in row-major order wins the ties
+s21::Summary S21Matrix::Summarize() const {
+  S21_STATS_SCOPE(kReduce, Elements());
+  const auto partial = s21::ReduceRowTasks<Moments>(
+      rows_, cols_, [&](Moments &moments, int begin, int end) {
+        for (auto i = begin; i < end; ++i)
+          moments.AddRun(RowPtr(i), cols_,
+                         static_cast<std::ptrdiff_t>(i) * cols_);
+      });
+  Moments moments;
+  for (const auto &task : partial) moments.Merge(task);
+  return {moments.sum.Result(),
+          moments.abs_sum.Result(),
+          moments.square_sum.Result(),
+          At(moments.min, moments.argmin, cols_),
+          At(moments.max, moments.argmax, cols_)};
+}
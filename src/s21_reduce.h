@@ -0,0 +1,32 @@
+#ifndef SRC_S21_REDUCE_H_
+#define SRC_S21_REDUCE_H_
+
+namespace s21 {
+
+// the norms of S21Matrix::Norm
+enum class Norm {
+  kOne,        // the largest sum of the absolute values of a column
+  kInf,        // the largest sum of the absolute values of a row
+  kFrobenius,  // the square root of the sum of the squares
+  kMaxAbs,     // the largest absolute value
+};
+
+// an element found by S21Matrix::Min or Max, the first one in row-major
+// order among equal ones; the NaN elements are skipped, an empty matrix
+// gives an infinite value at row and col -1
+struct Extremum {
+  double value;
+  int row, col;
+};
+
+// the reductions of S21Matrix::Summarize, computed in one pass over the
+// elements; square_sum overflows for elements beyond 1e154, Norm scales
+// them instead
+struct Summary {
+  double sum, abs_sum, square_sum;
+  Extremum min, max;
+};
+
+}  // namespace s21
+
+#endif  // SRC_S21_REDUCE_H_
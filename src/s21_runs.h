@@ -0,0 +1,140 @@
+#ifndef SRC_S21_RUNS_H_
+#define SRC_S21_RUNS_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include "s21_thread_pool.h"
+
+namespace s21 {
+
+// elements per task of the parallel element-wise operations, shorter inputs
+// are processed on the calling thread
+constexpr std::ptrdiff_t kParallelGrain = 1 << 15;
+
+// elements of the rows with gaps copied into a buffer at once
+constexpr int kGatherChunk = 256;
+
+// an operand of ForEachRun: the first element and the distances between
+// the starts of two rows and between two elements of a row
+template <class T>
+struct RunOperand {
+  T *data;
+  std::ptrdiff_t row_stride, col_stride;
+};
+
+// the n elements from first with the stride, adjacent ones are used in
+// place and the others are copied into the buffer
+template <class T>
+T *Gather(T *first, std::ptrdiff_t stride, int n,
+          std::remove_const_t<T> *buffer) noexcept {
+  if (stride == 1) return first;
+  for (auto j = 0; j < n; ++j) buffer[j] = first[j * stride];
+  return buffer;
+}
+
+// calls kernel(y, x, n) for the runs of n elements of two operands of the
+// same shape: contiguous operands form one run, operands with adjacent
+// columns a run per row, the rows of the others are gathered into buffers
+// chunk by chunk and the chunks of a writable y are scattered back; long
+// inputs are split over the thread pool
+template <class T, class U, class Kernel>
+void ForEachRun(int rows, int cols, RunOperand<T> y, RunOperand<U> x,
+                Kernel kernel) {
+  const std::ptrdiff_t total = static_cast<std::ptrdiff_t>(rows) * cols;
+  const bool adjacent = y.col_stride == 1 && x.col_stride == 1;
+  if (adjacent && y.row_stride == cols && x.row_stride == cols) {
+    if (total < 2 * kParallelGrain) return kernel(y.data, x.data, total);
+    ParallelFor(total, kParallelGrain,
+                [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+                  kernel(y.data + begin, x.data + begin, end - begin);
+                });
+    return;
+  }
+  auto row_range = [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    std::remove_const_t<T> y_chunk[kGatherChunk];
+    std::remove_const_t<U> x_chunk[kGatherChunk];
+    for (auto i = begin; i < end; ++i) {
+      T *y_row = y.data + i * y.row_stride;
+      U *x_row = x.data + i * x.row_stride;
+      if (adjacent) {
+        kernel(y_row, x_row, cols);
+        continue;
+      }
+      for (auto j = 0; j < cols; j += kGatherChunk) {
+        const int n = std::min(kGatherChunk, cols - j);
+        T *y_run = Gather(y_row + j * y.col_stride, y.col_stride, n, y_chunk);
+        U *x_run = Gather(x_row + j * x.col_stride, x.col_stride, n, x_chunk);
+        kernel(y_run, x_run, n);
+        if constexpr (!std::is_const_v<T>)
+          if (y.col_stride != 1)
+            for (auto jj = 0; jj < n; ++jj)
+              y_row[(j + jj) * y.col_stride] = y_chunk[jj];
+      }
+    }
+  };
+  if (total < 2 * kParallelGrain) return row_range(0, rows);
+  ParallelFor(rows, std::max<std::ptrdiff_t>(1, kParallelGrain / cols),
+              row_range);
+}
+
+// calls f(i) for every row, large matrices are split over the thread pool
+// unless the execution is sequenced
+template <class F>
+void ForEachRow(int rows, int cols, const F &f,
+                Execution execution = Execution::kParallel) {
+  auto row_range = [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    for (auto i = static_cast<int>(begin); i < end; ++i) f(i);
+  };
+  if (static_cast<std::ptrdiff_t>(rows) * cols < 2 * kParallelGrain)
+    row_range(0, rows);
+  else
+    ParallelFor(execution, rows,
+                std::max<std::ptrdiff_t>(1, kParallelGrain / cols), row_range);
+}
+
+// the rows split into tasks of about kParallelGrain elements, fixed by the
+// shape alone, so the results do not depend on the number of threads;
+// reduce(result, begin, end) reduces the rows [begin, end) of a task into
+// its own result and the results are returned in the order of the rows
+template <class Result, class Reduce>
+std::vector<Result> ReduceRowTasks(int rows, int cols, const Reduce &reduce) {
+  const int task_rows = static_cast<int>(std::max<std::ptrdiff_t>(
+      1, kParallelGrain / std::max(cols, 1)));
+  const int tasks = rows ? (rows - 1) / task_rows + 1 : 0;
+  std::vector<Result> results(tasks);
+  ParallelFor(tasks, 1, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    for (auto task = begin; task < end; ++task) {
+      const int first = static_cast<int>(task) * task_rows;
+      reduce(results[task], first, std::min(rows, first + task_rows));
+    }
+  });
+  return results;
+}
+
+// true when match(i) holds for every row i; large matrices are split over
+// the thread pool and every task stops at the first row that fails
+template <class Match>
+bool AllRows(int rows, int cols, const Match &match) {
+  std::atomic<bool> all{true};
+  auto row_range = [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    for (auto i = static_cast<int>(begin); i < end; ++i)
+      if (!all.load(std::memory_order_relaxed) || !match(i)) {
+        all.store(false, std::memory_order_relaxed);
+        return;
+      }
+  };
+  if (static_cast<std::ptrdiff_t>(rows) * cols < 2 * kParallelGrain)
+    row_range(0, rows);
+  else
+    ParallelFor(rows, std::max<std::ptrdiff_t>(1, kParallelGrain / cols),
+                row_range);
+  return all;
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_RUNS_H_
@@ -0,0 +1,653 @@
+#include "s21_simd.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define S21_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+namespace s21 {
+
+namespace {
+
+// SCALAR KERNELS
+
+void AddScalar(double *y, const double *x, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) y[i] += x[i];
+}
+
+void SubScalar(double *y, const double *x, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) y[i] -= x[i];
+}
+
+void ScaleScalar(double *y, double a, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) y[i] *= a;
+}
+
+void AxpyScalar(double *y, double a, const double *x, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) y[i] += a * x[i];
+}
+
+bool EqualScalar(const double *x, const double *y, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i)
+    if (!(x[i] == y[i])) return false;
+  return true;
+}
+
+// the generic tile loop, it is inlined into the callers below and the
+// compiler vectorizes it for the instruction set of each caller
+__attribute__((always_inline)) inline void GemmTile(int kc, const double *a,
+                                                    const double *b,
+                                                    double *acc) {
+  double tile[kGemmMR][kGemmNR] = {};
+  for (auto p = 0; p < kc; ++p, a += kGemmMR, b += kGemmNR)
+    for (auto i = 0; i < kGemmMR; ++i)
+      for (auto j = 0; j < kGemmNR; ++j) tile[i][j] += a[i] * b[j];
+  std::memcpy(acc, tile, sizeof(tile));
+}
+
+void GemmTileScalar(int kc, const double *a, const double *b, double *acc) {
+  GemmTile(kc, a, b, acc);
+}
+
+// the generic reduction loops, inlined and vectorized like GemmTile; the
+// lanes are independent chains of additions that the compiler keeps in
+// vector registers without reordering any sum
+template <int kLanes>
+__attribute__((always_inline)) inline double AddLanes(double *lanes) {
+  for (auto width = kLanes / 2; width > 0; width /= 2)
+    for (auto k = 0; k < width; ++k) lanes[k] += lanes[k + width];
+  return lanes[0];
+}
+
+__attribute__((always_inline)) inline double ReduceSum(const double *x,
+                                                       std::size_t n) {
+  double acc[kReduceLanes] = {};
+  std::size_t i = 0;
+  for (; i + kReduceLanes <= n; i += kReduceLanes)
+    for (auto k = 0; k < kReduceLanes; ++k) acc[k] += x[i + k];
+  for (auto k = 0; i < n; ++i, ++k) acc[k] += x[i];
+  return AddLanes<kReduceLanes>(acc);
+}
+
+__attribute__((always_inline)) inline double ReduceAbsSum(const double *x,
+                                                          std::size_t n) {
+  double acc[kReduceLanes] = {};
+  std::size_t i = 0;
+  for (; i + kReduceLanes <= n; i += kReduceLanes)
+    for (auto k = 0; k < kReduceLanes; ++k) acc[k] += std::fabs(x[i + k]);
+  for (auto k = 0; i < n; ++i, ++k) acc[k] += std::fabs(x[i]);
+  return AddLanes<kReduceLanes>(acc);
+}
+
+__attribute__((always_inline)) inline double ReduceDot(const double *x,
+                                                       const double *y,
+                                                       std::size_t n) {
+  double acc[kReduceLanes] = {};
+  std::size_t i = 0;
+  for (; i + kReduceLanes <= n; i += kReduceLanes)
+    for (auto k = 0; k < kReduceLanes; ++k) acc[k] += x[i + k] * y[i + k];
+  for (auto k = 0; i < n; ++i, ++k) acc[k] += x[i] * y[i];
+  return AddLanes<kReduceLanes>(acc);
+}
+
+// half the lanes, so that the five sets of partial results fit into the
+// registers; the compiler keeps this loop scalar, see MomentsAvx2
+__attribute__((always_inline)) inline void ReduceMoments(const double *x,
+                                                         std::size_t n,
+                                                         double *out) {
+  constexpr int kLanes = kReduceLanes / 2;
+  constexpr double kInf = std::numeric_limits<double>::infinity();
+  double sum[kLanes] = {}, abs_sum[kLanes] = {}, square_sum[kLanes] = {};
+  double low[kLanes], high[kLanes];
+  for (auto k = 0; k < kLanes; ++k) low[k] = kInf, high[k] = -kInf;
+  std::size_t i = 0;
+  for (; i + kLanes <= n; i += kLanes)
+    for (auto k = 0; k < kLanes; ++k) {
+      const double value = x[i + k];
+      sum[k] += value;
+      abs_sum[k] += std::fabs(value);
+      square_sum[k] += value * value;
+      low[k] = value < low[k] ? value : low[k];
+      high[k] = high[k] < value ? value : high[k];
+    }
+  for (auto k = 0; i < n; ++i, ++k) {
+    sum[k] += x[i];
+    abs_sum[k] += std::fabs(x[i]);
+    square_sum[k] += x[i] * x[i];
+    low[k] = x[i] < low[k] ? x[i] : low[k];
+    high[k] = high[k] < x[i] ? x[i] : high[k];
+  }
+  out[0] = AddLanes<kLanes>(sum);
+  out[1] = AddLanes<kLanes>(abs_sum);
+  out[2] = AddLanes<kLanes>(square_sum);
+  out[3] = low[0], out[4] = high[0];
+  for (auto k = 1; k < kLanes; ++k) {
+    out[3] = low[k] < out[3] ? low[k] : out[3];
+    out[4] = out[4] < high[k] ? high[k] : out[4];
+  }
+}
+
+// the doubles as integers in the order of their values, -0 and +0 both 0;
+// the difference of two keys counts the doubles between them
+inline std::int64_t OrderedKey(double value) noexcept {
+  std::int64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits < 0 ? std::numeric_limits<std::int64_t>::min() - bits : bits;
+}
+
+// the rule of the near kernels: equal values, or a finite difference within
+// the absolute or the relative bound, or at most ulps doubles apart; the
+// unsigned difference of the keys is in [-ulps, ulps] without overflowing
+// for the ulps up to 2^52
+inline bool Near(double x, double y, double absolute, double relative,
+                 std::int64_t ulps) noexcept {
+  if (x == y) return true;
+  const double diff = std::fabs(x - y);
+  const double bound =
+      std::max(absolute, relative * std::max(std::fabs(x), std::fabs(y)));
+  if (diff <= bound && diff < std::numeric_limits<double>::infinity())
+    return true;
+  if (!ulps || x != x || y != y) return false;
+  const auto distance = static_cast<std::uint64_t>(OrderedKey(x)) -
+                        static_cast<std::uint64_t>(OrderedKey(y));
+  return distance + ulps <= 2 * static_cast<std::uint64_t>(ulps);
+}
+
+// the NaN differences stick, the comparison with them is always false
+inline double MaxDifference(double max, double x, double y) noexcept {
+  const double diff = std::fabs(x - y);
+  return diff > max || diff != diff ? diff : max;
+}
+
+double SumScalar(const double *x, std::size_t n) { return ReduceSum(x, n); }
+
+double AbsSumScalar(const double *x, std::size_t n) {
+  return ReduceAbsSum(x, n);
+}
+
+double DotScalar(const double *x, const double *y, std::size_t n) {
+  return ReduceDot(x, y, n);
+}
+
+void MomentsScalar(const double *x, std::size_t n, double *out) {
+  ReduceMoments(x, n, out);
+}
+
+bool NearScalar(const double *x, const double *y, std::size_t n,
+                double absolute, double relative, std::int64_t ulps) {
+  for (std::size_t i = 0; i < n; ++i)
+    if (!Near(x[i], y[i], absolute, relative, ulps)) return false;
+  return true;
+}
+
+double MaxDifferenceScalar(const double *x, const double *y, std::size_t n) {
+  double max = 0;
+  for (std::size_t i = 0; i < n; ++i) max = MaxDifference(max, x[i], y[i]);
+  return max;
+}
+
+void TransposeBlockScalar(const double *a, std::ptrdiff_t lda, double *b,
+                          std::ptrdiff_t ldb) {
+  for (auto i = 0; i < kTransposeBlock; ++i)
+    for (auto j = 0; j < kTransposeBlock; ++j) b[j * ldb + i] = a[i * lda + j];
+}
+
+#ifdef S21_SIMD_X86
+
+// SSE2 KERNELS
+
+void AddSse2(double *y, const double *x, std::size_t n) {
+  std::size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+    _mm_storeu_pd(y + i, _mm_add_pd(_mm_loadu_pd(y + i), _mm_loadu_pd(x + i)));
+  AddScalar(y + i, x + i, n - i);
+}
+
+void SubSse2(double *y, const double *x, std::size_t n) {
+  std::size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+    _mm_storeu_pd(y + i, _mm_sub_pd(_mm_loadu_pd(y + i), _mm_loadu_pd(x + i)));
+  SubScalar(y + i, x + i, n - i);
+}
+
+void ScaleSse2(double *y, double a, std::size_t n) {
+  const __m128d va = _mm_set1_pd(a);
+  std::size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+    _mm_storeu_pd(y + i, _mm_mul_pd(_mm_loadu_pd(y + i), va));
+  ScaleScalar(y + i, a, n - i);
+}
+
+void AxpySse2(double *y, double a, const double *x, std::size_t n) {
+  const __m128d va = _mm_set1_pd(a);
+  std::size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+    _mm_storeu_pd(y + i, _mm_add_pd(_mm_loadu_pd(y + i),
+                                    _mm_mul_pd(va, _mm_loadu_pd(x + i))));
+  AxpyScalar(y + i, a, x + i, n - i);
+}
+
+bool EqualSse2(const double *x, const double *y, std::size_t n) {
+  std::size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+    if (_mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(x + i),
+                                     _mm_loadu_pd(y + i))) != 0x3)
+      return false;
+  return EqualScalar(x + i, y + i, n - i);
+}
+
+// 2 x 2 tiles: the low and the high halves of two rows are the columns
+template <bool kStream>
+void TransposeBlockSse2(const double *a, std::ptrdiff_t lda, double *b,
+                        std::ptrdiff_t ldb) {
+  auto store = [](double *dst, __m128d value) {
+    if constexpr (kStream)
+      _mm_stream_pd(dst, value);
+    else
+      _mm_storeu_pd(dst, value);
+  };
+  for (auto i = 0; i < kTransposeBlock; i += 2)
+    for (auto j = 0; j < kTransposeBlock; j += 2) {
+      const __m128d r0 = _mm_loadu_pd(a + i * lda + j);
+      const __m128d r1 = _mm_loadu_pd(a + (i + 1) * lda + j);
+      store(b + j * ldb + i, _mm_unpacklo_pd(r0, r1));
+      store(b + (j + 1) * ldb + i, _mm_unpackhi_pd(r0, r1));
+    }
+}
+
+// AVX2 KERNELS
+
+__attribute__((target("avx2,fma"))) void AddAvx2(double *y, const double *x,
+                                                 std::size_t n) {
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+    _mm256_storeu_pd(
+        y + i, _mm256_add_pd(_mm256_loadu_pd(y + i), _mm256_loadu_pd(x + i)));
+  AddSse2(y + i, x + i, n - i);
+}
+
+__attribute__((target("avx2,fma"))) void SubAvx2(double *y, const double *x,
+                                                 std::size_t n) {
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+    _mm256_storeu_pd(
+        y + i, _mm256_sub_pd(_mm256_loadu_pd(y + i), _mm256_loadu_pd(x + i)));
+  SubSse2(y + i, x + i, n - i);
+}
+
+__attribute__((target("avx2,fma"))) void ScaleAvx2(double *y, double a,
+                                                   std::size_t n) {
+  const __m256d va = _mm256_set1_pd(a);
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+    _mm256_storeu_pd(y + i, _mm256_mul_pd(_mm256_loadu_pd(y + i), va));
+  ScaleSse2(y + i, a, n - i);
+}
+
+__attribute__((target("avx2,fma"))) void AxpyAvx2(double *y, double a,
+                                                  const double *x,
+                                                  std::size_t n) {
+  const __m256d va = _mm256_set1_pd(a);
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+    _mm256_storeu_pd(y + i, _mm256_fmadd_pd(va, _mm256_loadu_pd(x + i),
+                                            _mm256_loadu_pd(y + i)));
+  AxpySse2(y + i, a, x + i, n - i);
+}
+
+__attribute__((target("avx2,fma"))) bool EqualAvx2(const double *x,
+                                                   const double *y,
+                                                   std::size_t n) {
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+    if (_mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(x + i),
+                                         _mm256_loadu_pd(y + i),
+                                         _CMP_EQ_OQ)) != 0xF)
+      return false;
+  return EqualSse2(x + i, y + i, n - i);
+}
+
+__attribute__((target("avx2,fma"))) void GemmTileAvx2(int kc, const double *a,
+                                                      const double *b,
+                                                      double *acc) {
+  GemmTile(kc, a, b, acc);
+}
+
+__attribute__((target("avx2,fma"))) double SumAvx2(const double *x,
+                                                   std::size_t n) {
+  return ReduceSum(x, n);
+}
+
+__attribute__((target("avx2,fma"))) double AbsSumAvx2(const double *x,
+                                                      std::size_t n) {
+  return ReduceAbsSum(x, n);
+}
+
+__attribute__((target("avx2,fma"))) double DotAvx2(const double *x,
+                                                   const double *y,
+                                                   std::size_t n) {
+  return ReduceDot(x, y, n);
+}
+
+// the lanes of ReduceMoments in two registers per result
+__attribute__((target("avx2,fma"))) void MomentsAvx2(const double *x,
+                                                     std::size_t n,
+                                                     double *out) {
+  constexpr double kInf = std::numeric_limits<double>::infinity();
+  const __m256d sign = _mm256_set1_pd(-0.0);
+  __m256d sum[2], abs_sum[2], square_sum[2], low[2], high[2];
+  for (auto h = 0; h < 2; ++h) {
+    sum[h] = abs_sum[h] = square_sum[h] = _mm256_setzero_pd();
+    low[h] = _mm256_set1_pd(kInf);
+    high[h] = _mm256_set1_pd(-kInf);
+  }
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8)
+    for (auto h = 0; h < 2; ++h) {
+      const __m256d value = _mm256_loadu_pd(x + i + 4 * h);
+      sum[h] = _mm256_add_pd(sum[h], value);
+      abs_sum[h] = _mm256_add_pd(abs_sum[h], _mm256_andnot_pd(sign, value));
+      square_sum[h] = _mm256_fmadd_pd(value, value, square_sum[h]);
+      // the second operand is kept when the first one is NaN
+      low[h] = _mm256_min_pd(value, low[h]);
+      high[h] = _mm256_max_pd(value, high[h]);
+    }
+  double lanes[5][8];
+  for (auto h = 0; h < 2; ++h) {
+    _mm256_storeu_pd(lanes[0] + 4 * h, sum[h]);
+    _mm256_storeu_pd(lanes[1] + 4 * h, abs_sum[h]);
+    _mm256_storeu_pd(lanes[2] + 4 * h, square_sum[h]);
+    _mm256_storeu_pd(lanes[3] + 4 * h, low[h]);
+    _mm256_storeu_pd(lanes[4] + 4 * h, high[h]);
+  }
+  for (auto k = 0; i < n; ++i, ++k) {
+    lanes[0][k] += x[i];
+    lanes[1][k] += std::fabs(x[i]);
+    lanes[2][k] += x[i] * x[i];
+    lanes[3][k] = x[i] < lanes[3][k] ? x[i] : lanes[3][k];
+    lanes[4][k] = lanes[4][k] < x[i] ? x[i] : lanes[4][k];
+  }
+  for (auto m = 0; m < 3; ++m) out[m] = AddLanes<8>(lanes[m]);
+  out[3] = *std::min_element(lanes[3], lanes[3] + 8);
+  out[4] = *std::max_element(lanes[4], lanes[4] + 8);
+}
+
+// the rule of Near four elements at a time, the doubles apart are counted
+// only for the vectors that fail the bounds
+__attribute__((target("avx2,fma"))) bool NearAvx2(const double *x,
+                                                  const double *y,
+                                                  std::size_t n,
+                                                  double absolute,
+                                                  double relative,
+                                                  std::int64_t ulps) {
+  const __m256d sign = _mm256_set1_pd(-0.0);
+  const __m256d va = _mm256_set1_pd(absolute), vr = _mm256_set1_pd(relative);
+  const __m256d inf = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+  const __m256i min =
+      _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::min());
+  const __m256i vulps = _mm256_set1_epi64x(ulps);
+  // the unsigned comparison with 2 * ulps as a signed one
+  const __m256i span = _mm256_xor_si256(_mm256_set1_epi64x(2 * ulps), min);
+  auto key = [&](__m256d value) __attribute__((target("avx2,fma"))) {
+    const __m256i bits = _mm256_castpd_si256(value);
+    const __m256i negative = _mm256_cmpgt_epi64(_mm256_setzero_si256(), bits);
+    return _mm256_blendv_epi8(bits, _mm256_sub_epi64(min, bits), negative);
+  };
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    const __m256d vx = _mm256_loadu_pd(x + i), vy = _mm256_loadu_pd(y + i);
+    const __m256d diff = _mm256_andnot_pd(sign, _mm256_sub_pd(vx, vy));
+    const __m256d bound = _mm256_max_pd(
+        va, _mm256_mul_pd(vr, _mm256_max_pd(_mm256_andnot_pd(sign, vx),
+                                            _mm256_andnot_pd(sign, vy))));
+    __m256d near = _mm256_or_pd(
+        _mm256_cmp_pd(vx, vy, _CMP_EQ_OQ),
+        _mm256_and_pd(_mm256_cmp_pd(diff, bound, _CMP_LE_OQ),
+                      _mm256_cmp_pd(diff, inf, _CMP_LT_OQ)));
+    if (_mm256_movemask_pd(near) == 0xF) continue;
+    if (!ulps) return false;
+    const __m256i distance = _mm256_add_epi64(
+        _mm256_sub_epi64(key(vx), key(vy)), vulps);
+    const __m256i apart =
+        _mm256_cmpgt_epi64(_mm256_xor_si256(distance, min), span);
+    near = _mm256_or_pd(
+        near, _mm256_andnot_pd(_mm256_castsi256_pd(apart),
+                               _mm256_cmp_pd(vx, vy, _CMP_ORD_Q)));
+    if (_mm256_movemask_pd(near) != 0xF) return false;
+  }
+  return NearScalar(x + i, y + i, n - i, absolute, relative, ulps);
+}
+
+__attribute__((target("avx2,fma"))) double MaxDifferenceAvx2(
+    const double *x, const double *y, std::size_t n) {
+  const __m256d sign = _mm256_set1_pd(-0.0);
+  __m256d max = _mm256_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    const __m256d diff = _mm256_andnot_pd(
+        sign, _mm256_sub_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i)));
+    const __m256d larger =
+        _mm256_or_pd(_mm256_cmp_pd(diff, max, _CMP_GT_OQ),
+                     _mm256_cmp_pd(diff, diff, _CMP_UNORD_Q));
+    max = _mm256_blendv_pd(max, diff, larger);
+  }
+  double lanes[4];
+  _mm256_storeu_pd(lanes, max);
+  double result = MaxDifferenceScalar(x + i, y + i, n - i);
+  for (const double lane : lanes)
+    result = lane > result || lane != lane ? lane : result;
+  return result;
+}
+
+// 4 x 4 tiles: pairs of rows are interleaved, then the 128-bit halves of
+// the pairs are combined into the columns
+template <bool kStream>
+__attribute__((target("avx2,fma"))) void TransposeBlockAvx2(
+    const double *a, std::ptrdiff_t lda, double *b, std::ptrdiff_t ldb) {
+  auto store = [](double *dst, __m256d value)
+                   __attribute__((target("avx2,fma"))) {
+                     if constexpr (kStream)
+                       _mm256_stream_pd(dst, value);
+                     else
+                       _mm256_storeu_pd(dst, value);
+                   };
+  for (auto i = 0; i < kTransposeBlock; i += 4)
+    for (auto j = 0; j < kTransposeBlock; j += 4) {
+      const double *src = a + i * lda + j;
+      const __m256d r0 = _mm256_loadu_pd(src);
+      const __m256d r1 = _mm256_loadu_pd(src + lda);
+      const __m256d r2 = _mm256_loadu_pd(src + 2 * lda);
+      const __m256d r3 = _mm256_loadu_pd(src + 3 * lda);
+      const __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+      const __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+      const __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+      const __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+      double *dst = b + j * ldb + i;
+      store(dst, _mm256_permute2f128_pd(t0, t2, 0x20));
+      store(dst + ldb, _mm256_permute2f128_pd(t1, t3, 0x20));
+      store(dst + 2 * ldb, _mm256_permute2f128_pd(t0, t2, 0x31));
+      store(dst + 3 * ldb, _mm256_permute2f128_pd(t1, t3, 0x31));
+    }
+}
+
+// AVX-512 KERNELS
+
+__attribute__((target("avx512f"))) void AddAvx512(double *y, const double *x,
+                                                  std::size_t n) {
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8)
+    _mm512_storeu_pd(
+        y + i, _mm512_add_pd(_mm512_loadu_pd(y + i), _mm512_loadu_pd(x + i)));
+  AddAvx2(y + i, x + i, n - i);
+}
+
+__attribute__((target("avx512f"))) void SubAvx512(double *y, const double *x,
+                                                  std::size_t n) {
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8)
+    _mm512_storeu_pd(
+        y + i, _mm512_sub_pd(_mm512_loadu_pd(y + i), _mm512_loadu_pd(x + i)));
+  SubAvx2(y + i, x + i, n - i);
+}
+
+__attribute__((target("avx512f"))) void ScaleAvx512(double *y, double a,
+                                                    std::size_t n) {
+  const __m512d va = _mm512_set1_pd(a);
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8)
+    _mm512_storeu_pd(y + i, _mm512_mul_pd(_mm512_loadu_pd(y + i), va));
+  ScaleAvx2(y + i, a, n - i);
+}
+
+__attribute__((target("avx512f"))) void AxpyAvx512(double *y, double a,
+                                                   const double *x,
+                                                   std::size_t n) {
+  const __m512d va = _mm512_set1_pd(a);
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8)
+    _mm512_storeu_pd(y + i, _mm512_fmadd_pd(va, _mm512_loadu_pd(x + i),
+                                            _mm512_loadu_pd(y + i)));
+  AxpyAvx2(y + i, a, x + i, n - i);
+}
+
+__attribute__((target("avx512f"))) bool EqualAvx512(const double *x,
+                                                    const double *y,
+                                                    std::size_t n) {
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8)
+    if (_mm512_cmp_pd_mask(_mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i),
+                           _CMP_EQ_OQ) != 0xFF)
+      return false;
+  return EqualAvx2(x + i, y + i, n - i);
+}
+
+// the whole 8 x 8 block in registers: pairs of rows are interleaved, then
+// two rounds of 128-bit lane shuffles gather the columns; the zero-masked
+// forms with a full mask avoid a false uninitialized warning of GCC 12 about
+// the undefined source of the unmasked ones
+template <bool kStream>
+__attribute__((target("avx512f"))) void TransposeBlockAvx512(
+    const double *a, std::ptrdiff_t lda, double *b, std::ptrdiff_t ldb) {
+  auto store = [](double *dst, __m512d value)
+                   __attribute__((target("avx512f"))) {
+                     if constexpr (kStream)
+                       _mm512_stream_pd(dst, value);
+                     else
+                       _mm512_storeu_pd(dst, value);
+                   };
+  const __mmask8 kAll = 0xFF;
+  __m512d r[kTransposeBlock], t[kTransposeBlock], u[kTransposeBlock];
+  for (auto i = 0; i < kTransposeBlock; ++i)
+    r[i] = _mm512_loadu_pd(a + i * lda);
+  for (auto i = 0; i < kTransposeBlock; i += 2) {
+    t[i] = _mm512_maskz_unpacklo_pd(kAll, r[i], r[i + 1]);
+    t[i + 1] = _mm512_maskz_unpackhi_pd(kAll, r[i], r[i + 1]);
+  }
+  // u[0], u[1]: columns 0, 4 and 2, 6 of the rows 0-3; u[2], u[3]: columns
+  // 1, 5 and 3, 7 of the rows 0-3; u[4] - u[7]: the same for the rows 4-7
+  for (auto h = 0; h < kTransposeBlock; h += 4) {
+    u[h] = _mm512_maskz_shuffle_f64x2(kAll, t[h], t[h + 2], 0x88);
+    u[h + 1] = _mm512_maskz_shuffle_f64x2(kAll, t[h], t[h + 2], 0xDD);
+    u[h + 2] = _mm512_maskz_shuffle_f64x2(kAll, t[h + 1], t[h + 3], 0x88);
+    u[h + 3] = _mm512_maskz_shuffle_f64x2(kAll, t[h + 1], t[h + 3], 0xDD);
+  }
+  // the column j and j + 4 are in u[k] and u[k + 4] for k = 0, 2, 1, 3
+  const int kSource[] = {0, 2, 1, 3};
+  for (auto j = 0; j < 4; ++j) {
+    const __m512d low = u[kSource[j]], high = u[kSource[j] + 4];
+    store(b + j * ldb, _mm512_maskz_shuffle_f64x2(kAll, low, high, 0x88));
+    store(b + (j + 4) * ldb,
+          _mm512_maskz_shuffle_f64x2(kAll, low, high, 0xDD));
+  }
+}
+
+#endif  // S21_SIMD_X86
+
+// the kernel tables of every level, weaker levels stand in for the ones
+// that are not compiled for the target architecture; the scalar stores have
+// no non-temporal form
+const SimdKernels kScalarKernels = {
+    SimdLevel::kScalar,   AddScalar,    SubScalar,
+    ScaleScalar,          AxpyScalar,   EqualScalar,
+    GemmTileScalar,       TransposeBlockScalar,
+    TransposeBlockScalar, SumScalar,    AbsSumScalar,
+    DotScalar,            MomentsScalar, NearScalar,
+    MaxDifferenceScalar};
+#ifdef S21_SIMD_X86
+const SimdKernels kSse2Kernels = {
+    SimdLevel::kSse2, AddSse2,  SubSse2,
+    ScaleSse2,        AxpySse2, EqualSse2,
+    GemmTileScalar,   TransposeBlockSse2<false>, TransposeBlockSse2<true>,
+    SumScalar,        AbsSumScalar,              DotScalar,
+    MomentsScalar,    NearScalar,                MaxDifferenceScalar};
+const SimdKernels kAvx2Kernels = {
+    SimdLevel::kAvx2, AddAvx2,  SubAvx2,
+    ScaleAvx2,        AxpyAvx2, EqualAvx2,
+    GemmTileAvx2,     TransposeBlockAvx2<false>, TransposeBlockAvx2<true>,
+    SumAvx2,          AbsSumAvx2,                DotAvx2,
+    MomentsAvx2,      NearAvx2,                  MaxDifferenceAvx2};
+// the 4 x 8 tile is already saturated by the FMA units with AVX2 registers,
+// the reductions by the loads
+const SimdKernels kAvx512Kernels = {
+    SimdLevel::kAvx512,         AddAvx512,  SubAvx512,
+    ScaleAvx512,                AxpyAvx512, EqualAvx512,
+    GemmTileAvx2,               TransposeBlockAvx512<false>,
+    TransposeBlockAvx512<true>, SumAvx2,    AbsSumAvx2,
+    DotAvx2,                    MomentsAvx2, NearAvx2,
+    MaxDifferenceAvx2};
+#endif  // S21_SIMD_X86
+
+// the level requested by the S21_SIMD environment variable
+SimdLevel RequestedSimdLevel() noexcept {
+  const char *value = std::getenv("S21_SIMD");
+  if (!value) return SimdLevel::kAvx512;
+  if (!std::strcmp(value, "scalar")) return SimdLevel::kScalar;
+  if (!std::strcmp(value, "sse2")) return SimdLevel::kSse2;
+  if (!std::strcmp(value, "avx2")) return SimdLevel::kAvx2;
+  return SimdLevel::kAvx512;
+}
+
+}  // namespace
+
+SimdLevel SupportedSimdLevel() noexcept {
+#ifdef S21_SIMD_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) return SimdLevel::kAvx512;
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    return SimdLevel::kAvx2;
+  if (__builtin_cpu_supports("sse2")) return SimdLevel::kSse2;
+#endif  // S21_SIMD_X86
+  return SimdLevel::kScalar;
+}
+
+const SimdKernels &SimdFor(SimdLevel level) noexcept {
+  static const SimdLevel supported = SupportedSimdLevel();
+  if (supported < level) level = supported;
+#ifdef S21_SIMD_X86
+  switch (level) {
+    case SimdLevel::kAvx512:
+      return kAvx512Kernels;
+    case SimdLevel::kAvx2:
+      return kAvx2Kernels;
+    case SimdLevel::kSse2:
+      return kSse2Kernels;
+    case SimdLevel::kScalar:
+      break;
+  }
+#endif  // S21_SIMD_X86
+  return kScalarKernels;
+}
+
+const SimdKernels &Simd() noexcept {
+  static const SimdKernels &kernels = SimdFor(RequestedSimdLevel());
+  return kernels;
+}
+
+}  // namespace s21
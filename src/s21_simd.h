@@ -0,0 +1,70 @@
+#ifndef SRC_S21_SIMD_H_
+#define SRC_S21_SIMD_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace s21 {
+
+// instruction set extensions, ordered from the weakest one
+enum class SimdLevel { kScalar, kSse2, kAvx2, kAvx512 };
+
+// the register tile of the GEMM micro-kernel
+constexpr int kGemmMR = 4;
+constexpr int kGemmNR = 8;
+
+// the order of the square block of the transpose kernel
+constexpr int kTransposeBlock = 8;
+
+// the independent partial sums of the reduction kernels
+constexpr int kReduceLanes = 16;
+
+// element-wise kernels over n contiguous doubles
+struct SimdKernels {
+  SimdLevel level;
+  void (*add)(double *y, const double *x, std::size_t n);   // y += x
+  void (*sub)(double *y, const double *x, std::size_t n);   // y -= x
+  void (*scale)(double *y, double a, std::size_t n);        // y *= a
+  void (*axpy)(double *y, double a, const double *x,        // y += a * x
+               std::size_t n);
+  bool (*equal)(const double *x, const double *y, std::size_t n);  // x == y
+  // acc = (kGemmMR x kc sliver of A) * (kc x kGemmNR sliver of B), both
+  // packed as in s21::Gemm, acc is a row-major kGemmMR x kGemmNR tile
+  void (*gemm_tile)(int kc, const double *a, const double *b, double *acc);
+  // b = a^T for kTransposeBlock x kTransposeBlock blocks with row strides
+  // lda and ldb, the rows are exchanged in registers
+  void (*transpose_block)(const double *a, std::ptrdiff_t lda, double *b,
+                          std::ptrdiff_t ldb);
+  // the same with non-temporal stores that bypass the cache, the rows of b
+  // must be 64-byte aligned and the stores must be fenced before b is read
+  void (*transpose_block_stream)(const double *a, std::ptrdiff_t lda,
+                                 double *b, std::ptrdiff_t ldb);
+  // the reductions keep up to kReduceLanes partial sums that are added
+  // pairwise at the end
+  double (*sum)(const double *x, std::size_t n);                    // sum x
+  double (*abs_sum)(const double *x, std::size_t n);              // sum |x|
+  double (*dot)(const double *x, const double *y, std::size_t n);  // x . y
+  // out = {sum x, sum |x|, sum x^2, min x, max x} in one pass, the NaN
+  // elements are skipped by min and max
+  void (*moments)(const double *x, std::size_t n, double *out);
+  // every x[i] equal to y[i] within the tolerances of s21::Tolerance,
+  // false at the first vector with a mismatch
+  bool (*near)(const double *x, const double *y, std::size_t n,
+               double absolute, double relative, std::int64_t ulps);
+  // max |x - y|, NaN once a difference is NaN
+  double (*max_difference)(const double *x, const double *y, std::size_t n);
+};
+
+// the best kernels supported by the processor, selected on the first call
+// with CPUID; the S21_SIMD environment variable ("scalar", "sse2", "avx2",
+// "avx512") caps the level
+const SimdKernels &Simd() noexcept;
+
+// the kernels of the given level, or of the best supported level below it
+const SimdKernels &SimdFor(SimdLevel level) noexcept;
+
+SimdLevel SupportedSimdLevel() noexcept;
+
+}  // namespace s21
+
+#endif  // SRC_S21_SIMD_H_
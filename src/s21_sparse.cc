@@ -0,0 +1,375 @@
+#include "s21_sparse.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <utility>
+
+#include "s21_simd.h"
+#include "s21_thread_pool.h"
+
+namespace {
+
+// columns of the dense operand handled by one task of the CSC product
+constexpr int kParallelColumns = 64;
+
+S21SparseMatrix::Format Other(S21SparseMatrix::Format format) noexcept {
+  return format == S21SparseMatrix::Format::kCsr
+             ? S21SparseMatrix::Format::kCsc
+             : S21SparseMatrix::Format::kCsr;
+}
+
+}  // namespace
+
+// AUXILIARY METHODS
+
+// the number of compressed lines: rows for CSR, columns for CSC
+int S21SparseMatrix::Major() const noexcept {
+  return format_ == Format::kCsr ? rows_ : cols_;
+}
+
+// this += factor * other, the sorted lines are merged one by one
+void S21SparseMatrix::Combine(const S21SparseMatrix &other, double factor) {
+  if (rows_ != other.rows_ || cols_ != other.cols_)
+    throw std::invalid_argument("Matrices should have the same size");
+  const S21SparseMatrix &b =
+      other.format_ == format_ ? other : other.ToFormat(format_);
+  std::vector<std::ptrdiff_t> offsets(offsets_.size());
+  std::vector<int> indices;
+  std::vector<double> values;
+  indices.reserve(indices_.size() + b.indices_.size());
+  values.reserve(indices.capacity());
+  for (auto k = 0; k < Major(); ++k) {
+    auto p = offsets_[k], q = b.offsets_[k];
+    const auto p_end = offsets_[k + 1], q_end = b.offsets_[k + 1];
+    while (p < p_end || q < q_end) {
+      int index;
+      double value;
+      if (q == q_end || (p < p_end && indices_[p] < b.indices_[q])) {
+        index = indices_[p];
+        value = values_[p++];
+      } else if (p == p_end || b.indices_[q] < indices_[p]) {
+        index = b.indices_[q];
+        value = factor * b.values_[q++];
+      } else {
+        index = indices_[p];
+        value = values_[p++] + factor * b.values_[q++];
+      }
+      // the elements that cancel out are not stored
+      if (value == 0) continue;
+      indices.push_back(index);
+      values.push_back(value);
+    }
+    offsets[k + 1] = static_cast<std::ptrdiff_t>(indices.size());
+  }
+  offsets_ = std::move(offsets);
+  indices_ = std::move(indices);
+  values_ = std::move(values);
+}
+
+// removing the stored zeros in place
+void S21SparseMatrix::Prune() noexcept {
+  std::ptrdiff_t last = 0, begin = 0;
+  for (auto k = 0; k < Major(); ++k) {
+    const auto end = offsets_[k + 1];
+    for (auto p = begin; p < end; ++p) {
+      if (values_[p] == 0) continue;
+      indices_[last] = indices_[p];
+      values_[last++] = values_[p];
+    }
+    begin = end;
+    offsets_[k + 1] = last;
+  }
+  indices_.resize(last);
+  values_.resize(last);
+}
+
+// CONSTRUCTORS
+
+S21SparseMatrix::S21SparseMatrix(int rows, int cols, Format format)
+    : rows_(rows), cols_(cols), format_(format) {
+  if (rows < 1 || cols < 1)
+    throw std::invalid_argument(
+        "The number of rows and columns must be greater than 1");
+  offsets_.assign(Major() + 1, 0);
+}
+
+// the rows are scanned into CSR, CSC is converted from it
+S21SparseMatrix::S21SparseMatrix(const S21Matrix &dense, double threshold,
+                                 Format format)
+    : S21SparseMatrix(dense.rows_, dense.cols_) {
+  for (auto i = 0; i < rows_; ++i) {
+    const double *row = dense.RowPtr(i);
+    for (auto j = 0; j < cols_; ++j)
+      if (std::fabs(row[j]) > threshold) {
+        indices_.push_back(j);
+        values_.push_back(row[j]);
+      }
+    offsets_[i + 1] = static_cast<std::ptrdiff_t>(indices_.size());
+  }
+  if (format == Format::kCsc) *this = ToFormat(format);
+}
+
+// the triplets are bucketed by their major line, then every line is sorted
+// by the minor index and its repeated indices are added up
+S21SparseMatrix::S21SparseMatrix(int rows, int cols,
+                                 const std::vector<Triplet> &triplets,
+                                 Format format)
+    : S21SparseMatrix(rows, cols, format) {
+  const bool csr = format == Format::kCsr;
+  for (const auto &triplet : triplets) {
+    if (triplet.row < 0 || rows_ <= triplet.row)
+      throw std::out_of_range("The row index is incorrect");
+    if (triplet.col < 0 || cols_ <= triplet.col)
+      throw std::out_of_range("The column index is incorrect");
+    ++offsets_[(csr ? triplet.row : triplet.col) + 1];
+  }
+  std::partial_sum(offsets_.begin(), offsets_.end(), offsets_.begin());
+  std::vector<std::pair<int, double>> entries(triplets.size());
+  std::vector<std::ptrdiff_t> next(offsets_.begin(), offsets_.end() - 1);
+  for (const auto &triplet : triplets)
+    entries[next[csr ? triplet.row : triplet.col]++] = {
+        csr ? triplet.col : triplet.row, triplet.value};
+
+  indices_.reserve(entries.size());
+  values_.reserve(entries.size());
+  std::ptrdiff_t begin = 0;
+  for (auto k = 0; k < Major(); ++k) {
+    const auto end = offsets_[k + 1];
+    std::sort(entries.begin() + begin, entries.begin() + end,
+              [](const auto &a, const auto &b) { return a.first < b.first; });
+    for (auto p = begin; p < end; ++p) {
+      // offsets_[k] is already the start of the compacted line
+      const bool repeated =
+          static_cast<std::ptrdiff_t>(indices_.size()) > offsets_[k] &&
+          indices_.back() == entries[p].first;
+      if (repeated) {
+        values_.back() += entries[p].second;
+      } else {
+        indices_.push_back(entries[p].first);
+        values_.push_back(entries[p].second);
+      }
+    }
+    begin = end;
+    offsets_[k + 1] = static_cast<std::ptrdiff_t>(indices_.size());
+  }
+  Prune();
+}
+
+// ACCESSORS
+
+int S21SparseMatrix::GetRows() const noexcept { return rows_; }
+
+int S21SparseMatrix::GetCols() const noexcept { return cols_; }
+
+S21SparseMatrix::Format S21SparseMatrix::GetFormat() const noexcept {
+  return format_;
+}
+
+std::ptrdiff_t S21SparseMatrix::GetNonZeros() const noexcept {
+  return static_cast<std::ptrdiff_t>(values_.size());
+}
+
+// binary search in the sorted line of the element
+double S21SparseMatrix::GetValue(int row, int col) const {
+  if (row < 0 || rows_ <= row)
+    throw std::out_of_range("The row index is incorrect");
+  if (col < 0 || cols_ <= col)
+    throw std::out_of_range("The column index is incorrect");
+  const int line = format_ == Format::kCsr ? row : col;
+  const int index = format_ == Format::kCsr ? col : row;
+  auto first = indices_.begin() + offsets_[line];
+  auto last = indices_.begin() + offsets_[line + 1];
+  auto found = std::lower_bound(first, last, index);
+  if (found == last || *found != index) return 0;
+  return values_[found - indices_.begin()];
+}
+
+const std::vector<std::ptrdiff_t> &S21SparseMatrix::GetOffsets()
+    const noexcept {
+  return offsets_;
+}
+
+const std::vector<int> &S21SparseMatrix::GetIndices() const noexcept {
+  return indices_;
+}
+
+const std::vector<double> &S21SparseMatrix::GetValues() const noexcept {
+  return values_;
+}
+
+// CONVERSIONS
+
+S21Matrix S21SparseMatrix::ToDense() const {
+  S21Matrix result(rows_, cols_);
+  for (auto k = 0; k < Major(); ++k)
+    for (auto p = offsets_[k]; p < offsets_[k + 1]; ++p) {
+      if (format_ == Format::kCsr)
+        result.RowPtr(k)[indices_[p]] = values_[p];
+      else
+        result.RowPtr(indices_[p])[k] = values_[p];
+    }
+  return result;
+}
+
+// a counting sort of the nonzeros by their minor index; the lines are
+// visited in order, so the new lines come out sorted
+S21SparseMatrix S21SparseMatrix::ToFormat(Format format) const {
+  if (format == format_) return *this;
+  S21SparseMatrix result(rows_, cols_, format);
+  for (auto index : indices_) ++result.offsets_[index + 1];
+  std::partial_sum(result.offsets_.begin(), result.offsets_.end(),
+                   result.offsets_.begin());
+  result.indices_.resize(indices_.size());
+  result.values_.resize(values_.size());
+  std::vector<std::ptrdiff_t> next(result.offsets_.begin(),
+                                   result.offsets_.end() - 1);
+  for (auto k = 0; k < Major(); ++k)
+    for (auto p = offsets_[k]; p < offsets_[k + 1]; ++p) {
+      const auto q = next[indices_[p]]++;
+      result.indices_[q] = k;
+      result.values_[q] = values_[p];
+    }
+  return result;
+}
+
+// OPERATIONS
+
+// the stored zeros are always pruned, so equal matrices have equal arrays
+bool S21SparseMatrix::EqMatrix(const S21SparseMatrix &other) const noexcept {
+  if (rows_ != other.rows_ || cols_ != other.cols_) return false;
+  if (other.format_ != format_) {
+    if (GetNonZeros() != other.GetNonZeros()) return false;
+    try {
+      return EqMatrix(other.ToFormat(format_));
+    } catch (const std::bad_alloc &) {
+      return false;
+    }
+  }
+  return offsets_ == other.offsets_ && indices_ == other.indices_ &&
+         values_ == other.values_;
+}
+
+void S21SparseMatrix::SumMatrix(const S21SparseMatrix &other) {
+  Combine(other, 1);
+}
+
+void S21SparseMatrix::SubMatrix(const S21SparseMatrix &other) {
+  Combine(other, -1);
+}
+
+void S21SparseMatrix::MulNumber(const double num) noexcept {
+  for (auto &value : values_) value *= num;
+  Prune();
+}
+
+S21SparseMatrix S21SparseMatrix::Transpose() const {
+  S21SparseMatrix result(*this);
+  std::swap(result.rows_, result.cols_);
+  result.format_ = Other(format_);
+  return result;
+}
+
+// CSR computes the rows of y independently over the thread pool, CSC
+// scatters the columns into y on the calling thread; convert a CSC matrix
+// that is multiplied repeatedly
+std::vector<double> S21SparseMatrix::MulVector(
+    const std::vector<double> &x) const {
+  if (x.size() != static_cast<std::size_t>(cols_))
+    throw std::invalid_argument(
+        "The size of the vector must be equal to the number of columns");
+  std::vector<double> y(rows_);
+  if (format_ == Format::kCsr) {
+    const std::ptrdiff_t grain = std::max<std::ptrdiff_t>(
+        kParallelRows, (1 << 15) * static_cast<std::ptrdiff_t>(rows_) /
+                           std::max<std::ptrdiff_t>(1, GetNonZeros()));
+    s21::ParallelFor(rows_, grain,
+                     [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+                       for (auto i = begin; i < end; ++i) {
+                         double sum = 0;
+                         for (auto p = offsets_[i]; p < offsets_[i + 1]; ++p)
+                           sum += values_[p] * x[indices_[p]];
+                         y[i] = sum;
+                       }
+                     });
+  } else {
+    for (auto j = 0; j < cols_; ++j) {
+      if (x[j] == 0) continue;
+      for (auto p = offsets_[j]; p < offsets_[j + 1]; ++p)
+        y[indices_[p]] += values_[p] * x[j];
+    }
+  }
+  return y;
+}
+
+// CSR adds the scaled rows of B into every row of the result, the rows of
+// the result are independent; CSC adds the scaled row k of B for every
+// nonzero of column k, the tasks split the columns of B instead
+S21Matrix S21SparseMatrix::MulMatrix(const S21Matrix &dense) const {
+  if (cols_ != dense.rows_)
+    throw std::invalid_argument(
+        "The number of columns of the matrix1 must be "
+        "equal to the number of rows of the matrix2");
+  S21Matrix result(rows_, dense.cols_);
+  const auto axpy = s21::Simd().axpy;
+  if (format_ == Format::kCsr) {
+    s21::ParallelFor(rows_, kParallelRows,
+                     [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+                       for (auto i = begin; i < end; ++i)
+                         for (auto p = offsets_[i]; p < offsets_[i + 1]; ++p)
+                           axpy(result.RowPtr(i), values_[p],
+                                dense.RowPtr(indices_[p]), dense.cols_);
+                     });
+  } else {
+    s21::ParallelFor(
+        dense.cols_, kParallelColumns,
+        [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+          for (auto k = 0; k < cols_; ++k)
+            for (auto p = offsets_[k]; p < offsets_[k + 1]; ++p)
+              axpy(result.RowPtr(indices_[p]) + begin, values_[p],
+                   dense.RowPtr(k) + begin, end - begin);
+        });
+  }
+  return result;
+}
+
+// every row of the result is computed by one task: CSR adds the rows of A
+// scaled by the nonzeros of the row of B, CSC takes the dot products of the
+// row of B with the columns of A
+S21Matrix S21SparseMatrix::LeftMulMatrix(const S21Matrix &dense) const {
+  if (dense.cols_ != rows_)
+    throw std::invalid_argument(
+        "The number of columns of the matrix1 must be "
+        "equal to the number of rows of the matrix2");
+  S21Matrix result(dense.rows_, cols_);
+  s21::ParallelFor(
+      dense.rows_, kParallelRows,
+      [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+        for (auto i = begin; i < end; ++i) {
+          const double *b_row = dense.RowPtr(i);
+          double *c_row = result.RowPtr(i);
+          for (auto k = 0; k < Major(); ++k) {
+            if (format_ == Format::kCsr) {
+              const double factor = b_row[k];
+              if (factor == 0) continue;
+              for (auto p = offsets_[k]; p < offsets_[k + 1]; ++p)
+                c_row[indices_[p]] += factor * values_[p];
+            } else {
+              double sum = 0;
+              for (auto p = offsets_[k]; p < offsets_[k + 1]; ++p)
+                sum += b_row[indices_[p]] * values_[p];
+              c_row[k] = sum;
+            }
+          }
+        }
+      });
+  return result;
+}
+
+S21Matrix operator*(const S21SparseMatrix &sparse, const S21Matrix &dense) {
+  return sparse.MulMatrix(dense);
+}
+
+S21Matrix operator*(const S21Matrix &dense, const S21SparseMatrix &sparse) {
+  return sparse.LeftMulMatrix(dense);
+}
@@ -0,0 +1,85 @@
+#ifndef SRC_S21_SPARSE_H_
+#define SRC_S21_SPARSE_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "s21_matrix_oop.h"
+
+// A sparse matrix in compressed row (CSR) or compressed column (CSC)
+// storage. The nonzeros of every row (CSR) or column (CSC), the major
+// lines, are kept together sorted by their minor index: offsets_[k] is the
+// position of the first nonzero of line k in indices_ and values_, and
+// offsets_[major] is the number of nonzeros. The memory and the time of
+// the operations are proportional to the number of nonzeros instead of
+// rows * cols.
+class S21SparseMatrix {
+ public:
+  enum class Format { kCsr, kCsc };
+
+  // one nonzero of the coordinate form
+  struct Triplet {
+    int row, col;
+    double value;
+  };
+
+ private:
+  // rows of the result computed by one task of the parallel products
+  static constexpr int kParallelRows = 64;
+
+  int rows_, cols_;
+  Format format_;
+  std::vector<std::ptrdiff_t> offsets_;  // the start of every major line
+  std::vector<int> indices_;             // the minor index of every nonzero
+  std::vector<double> values_;
+
+  int Major() const noexcept;
+  void Combine(const S21SparseMatrix &other, double factor);
+  void Prune() noexcept;
+
+ public:
+  // a rows x cols matrix without nonzeros
+  S21SparseMatrix(int rows, int cols, Format format = Format::kCsr);
+  // the elements of the dense matrix whose magnitude exceeds threshold
+  explicit S21SparseMatrix(const S21Matrix &dense, double threshold = 0,
+                           Format format = Format::kCsr);
+  // the matrix with the given nonzeros in any order, the values of
+  // repeated coordinates are added up
+  S21SparseMatrix(int rows, int cols, const std::vector<Triplet> &triplets,
+                  Format format = Format::kCsr);
+
+  // getters
+  int GetRows() const noexcept;
+  int GetCols() const noexcept;
+  Format GetFormat() const noexcept;
+  std::ptrdiff_t GetNonZeros() const noexcept;
+  double GetValue(int row, int col) const;
+  // the compressed arrays of the current format
+  const std::vector<std::ptrdiff_t> &GetOffsets() const noexcept;
+  const std::vector<int> &GetIndices() const noexcept;
+  const std::vector<double> &GetValues() const noexcept;
+
+  // conversions
+  S21Matrix ToDense() const;
+  S21SparseMatrix ToFormat(Format format) const;
+
+  // operations
+  bool EqMatrix(const S21SparseMatrix &other) const noexcept;
+  void SumMatrix(const S21SparseMatrix &other);
+  void SubMatrix(const S21SparseMatrix &other);
+  void MulNumber(const double num) noexcept;
+  // the transposed matrix in the other format shares the arrays of this
+  // one, so the transposition is a copy of the nonzeros
+  S21SparseMatrix Transpose() const;
+  // y = A * x
+  std::vector<double> MulVector(const std::vector<double> &x) const;
+  // A * B and B * A with a dense B
+  S21Matrix MulMatrix(const S21Matrix &dense) const;
+  S21Matrix LeftMulMatrix(const S21Matrix &dense) const;
+};
+
+// the products of a sparse and a dense matrix are dense
+S21Matrix operator*(const S21SparseMatrix &sparse, const S21Matrix &dense);
+S21Matrix operator*(const S21Matrix &dense, const S21SparseMatrix &sparse);
+
+#endif  // SRC_S21_SPARSE_H_
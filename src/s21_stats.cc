@@ -0,0 +1,242 @@
+#include "s21_stats.h"
+
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace s21 {
+
+namespace {
+
+using Counter = std::atomic<std::uint64_t>;
+
+// the counters of one thread: only the thread writes them, so an increment
+// is a plain load and store; the snapshots of other threads read them, and
+// a reset stores the current values as the base to subtract instead of
+// zeroing them under the writer
+struct alignas(64) ThreadCounters {
+  Counter calls[kStatsOperations];
+  Counter nanoseconds[kStatsOperations];
+  Counter sizes[kStatsOperations][kStatsSizeBuckets];
+  Counter allocations, allocated_bytes;
+  Counter deallocations, deallocated_bytes;
+  StatsSnapshot base;  // guarded by the mutex of the registry
+};
+
+void Add(Counter &counter, std::uint64_t value) noexcept {
+  counter.store(counter.load(std::memory_order_relaxed) + value,
+                std::memory_order_relaxed);
+}
+
+// calls visit(counter, its value in the base, its value in the snapshot)
+// for every counter of the thread
+template <class Visit>
+void ForEachCounter(ThreadCounters &counters, StatsSnapshot &stats,
+                    Visit visit) {
+  StatsSnapshot &base = counters.base;
+  for (auto op = 0; op < kStatsOperations; ++op) {
+    OperationStats &from = base.operations[op], &to = stats.operations[op];
+    visit(counters.calls[op], from.calls, to.calls);
+    visit(counters.nanoseconds[op], from.nanoseconds, to.nanoseconds);
+    for (auto b = 0; b < kStatsSizeBuckets; ++b)
+      visit(counters.sizes[op][b], from.sizes[b], to.sizes[b]);
+  }
+  visit(counters.allocations, base.allocations, stats.allocations);
+  visit(counters.allocated_bytes, base.allocated_bytes,
+        stats.allocated_bytes);
+  visit(counters.deallocations, base.deallocations, stats.deallocations);
+  visit(counters.deallocated_bytes, base.deallocated_bytes,
+        stats.deallocated_bytes);
+}
+
+// adds the counts of the thread since the last reset to the snapshot
+void Collect(ThreadCounters &counters, StatsSnapshot &stats) {
+  ForEachCounter(counters, stats,
+                 [](const Counter &counter, std::uint64_t base,
+                    std::uint64_t &value) {
+                   value += counter.load(std::memory_order_relaxed) - base;
+                 });
+}
+
+// makes the current counts of the thread its base
+void Rebase(ThreadCounters &counters) {
+  StatsSnapshot unused;
+  ForEachCounter(counters, unused,
+                 [](const Counter &counter, std::uint64_t &base,
+                    std::uint64_t &) {
+                   base = counter.load(std::memory_order_relaxed);
+                 });
+}
+
+// the counters of the running threads and the totals of the finished ones
+class Registry {
+ public:
+  // never destroyed, the threads may finish after the static destructors
+  static Registry &Instance() {
+    static Registry *registry = new Registry();
+    return *registry;
+  }
+
+  void Add(ThreadCounters *counters) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    threads_.push_back(counters);
+  }
+
+  void Remove(ThreadCounters *counters) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Collect(*counters, finished_);
+    threads_.erase(std::find(threads_.begin(), threads_.end(), counters));
+  }
+
+  StatsSnapshot Snapshot() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    StatsSnapshot stats = finished_;
+    for (auto *counters : threads_) Collect(*counters, stats);
+    return stats;
+  }
+
+  StatsSnapshot ThreadSnapshot(ThreadCounters &counters) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    StatsSnapshot stats = StatsSnapshot();
+    Collect(counters, stats);
+    return stats;
+  }
+
+  void Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    finished_ = StatsSnapshot();
+    for (auto *counters : threads_) Rebase(*counters);
+  }
+
+ private:
+  Registry() : finished_() {}
+
+  std::mutex mutex_;
+  std::vector<ThreadCounters *> threads_;
+  StatsSnapshot finished_;
+};
+
+// the counters of the calling thread, registered on the first use and
+// folded into the totals when the thread finishes
+class ThreadSlot {
+ public:
+  ThreadSlot() : counters_() { Registry::Instance().Add(&counters_); }
+  ~ThreadSlot() { Registry::Instance().Remove(&counters_); }
+  ThreadCounters &Counters() noexcept { return counters_; }
+
+ private:
+  ThreadCounters counters_;
+};
+
+ThreadCounters &Local() {
+  thread_local ThreadSlot slot;
+  return slot.Counters();
+}
+
+int SizeBucket(std::int64_t elements) noexcept {
+  int bucket = 0;
+  while (bucket < kStatsSizeBuckets - 1 && (elements >> (bucket + 1)) > 0)
+    ++bucket;
+  return bucket;
+}
+
+const char *const kOperationNames[kStatsOperations] = {
+    "EqMatrix",    "SumMatrix",       "SubMatrix",     "MulNumber",
+    "AxpyMatrix",  "MulMatrix",       "Transpose",     "CalcComplements",
+    "Determinant", "InverseMatrix",   "MinorMatrix",   "Solve",
+    "Reduce"};
+
+// the columns of the text table
+constexpr int kNameWidth = 16, kCallsWidth = 10, kTimeWidth = 12;
+
+void FormatText(const StatsSnapshot &stats, std::ostream &out) {
+  out << std::left << std::setw(kNameWidth) << "operation" << std::right
+      << std::setw(kCallsWidth) << "calls" << std::setw(kTimeWidth)
+      << "total ms" << "  sizes (elements: calls)\n";
+  out << std::fixed << std::setprecision(3);
+  for (auto op = 0; op < kStatsOperations; ++op) {
+    const OperationStats &entry = stats.operations[op];
+    if (!entry.calls) continue;
+    out << std::left << std::setw(kNameWidth) << kOperationNames[op]
+        << std::right << std::setw(kCallsWidth) << entry.calls
+        << std::setw(kTimeWidth) << entry.nanoseconds / 1e6 << ' ';
+    for (auto b = 0; b < kStatsSizeBuckets; ++b)
+      if (entry.sizes[b]) out << ' ' << (1ull << b) << ": " << entry.sizes[b];
+    out << '\n';
+  }
+  out << "allocations " << stats.allocations << " (" << stats.allocated_bytes
+      << " bytes), deallocations " << stats.deallocations << " ("
+      << stats.deallocated_bytes << " bytes)\n";
+}
+
+void FormatJson(const StatsSnapshot &stats, std::ostream &out) {
+  out << "{\"operations\": {";
+  for (auto op = 0; op < kStatsOperations; ++op) {
+    const OperationStats &entry = stats.operations[op];
+    out << (op ? ", " : "") << '"' << kOperationNames[op]
+        << "\": {\"calls\": " << entry.calls
+        << ", \"nanoseconds\": " << entry.nanoseconds << ", \"sizes\": {";
+    bool first = true;
+    for (auto b = 0; b < kStatsSizeBuckets; ++b) {
+      if (!entry.sizes[b]) continue;
+      out << (first ? "" : ", ") << '"' << (1ull << b)
+          << "\": " << entry.sizes[b];
+      first = false;
+    }
+    out << "}}";
+  }
+  out << "}, \"allocations\": {\"count\": " << stats.allocations
+      << ", \"bytes\": " << stats.allocated_bytes
+      << "}, \"deallocations\": {\"count\": " << stats.deallocations
+      << ", \"bytes\": " << stats.deallocated_bytes << "}}\n";
+}
+
+}  // namespace
+
+const char *OperationName(Operation operation) noexcept {
+  return kOperationNames[static_cast<int>(operation)];
+}
+
+StatsSnapshot GetStats() { return Registry::Instance().Snapshot(); }
+
+StatsSnapshot GetThreadStats() {
+  if (!kStatsEnabled) return StatsSnapshot();
+  return Registry::Instance().ThreadSnapshot(Local());
+}
+
+void ResetStats() { Registry::Instance().Reset(); }
+
+std::string FormatStats(const StatsSnapshot &stats, StatsFormat format) {
+  std::ostringstream out;
+  if (format == StatsFormat::kJson)
+    FormatJson(stats, out);
+  else
+    FormatText(stats, out);
+  return out.str();
+}
+
+void RecordOperation(Operation operation, std::int64_t elements,
+                     std::uint64_t nanoseconds) noexcept {
+  ThreadCounters &counters = Local();
+  const int op = static_cast<int>(operation);
+  Add(counters.calls[op], 1);
+  Add(counters.nanoseconds[op], nanoseconds);
+  Add(counters.sizes[op][SizeBucket(elements)], 1);
+}
+
+void RecordAllocation(std::size_t bytes) noexcept {
+  ThreadCounters &counters = Local();
+  Add(counters.allocations, 1);
+  Add(counters.allocated_bytes, bytes);
+}
+
+void RecordDeallocation(std::size_t bytes) noexcept {
+  ThreadCounters &counters = Local();
+  Add(counters.deallocations, 1);
+  Add(counters.deallocated_bytes, bytes);
+}
+
+}  // namespace s21
@@ -0,0 +1,124 @@
+#ifndef SRC_S21_STATS_H_
+#define SRC_S21_STATS_H_
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// Optional instrumentation of the matrix operations: calls, a histogram of
+// the sizes, the inclusive time of every operation and the bytes allocated
+// for matrix storage. It is compiled in with -DS21_STATS (make STATS=1);
+// without the flag the recording macros expand to nothing and the snapshots
+// stay empty. Every thread counts into its own counters, a snapshot sums
+// the counters of all the threads.
+
+namespace s21 {
+
+#ifdef S21_STATS
+constexpr bool kStatsEnabled = true;
+#else
+constexpr bool kStatsEnabled = false;
+#endif
+
+// the instrumented operations
+enum class Operation {
+  kEqMatrix,
+  kSumMatrix,
+  kSubMatrix,
+  kMulNumber,
+  kAxpyMatrix,
+  kMulMatrix,  // MulMatrix and the products of the operator *
+  kTranspose,
+  kCalcComplements,
+  kDeterminant,
+  kInverseMatrix,
+  kMinorMatrix,
+  kSolve,
+  kReduce,  // the sums, norms and extrema of s21_reduce.h
+};
+constexpr int kStatsOperations = static_cast<int>(Operation::kReduce) + 1;
+
+// the bucket b of a size histogram counts the calls on 2^b to 2^(b+1) - 1
+// elements, the last bucket takes all the larger ones
+constexpr int kStatsSizeBuckets = 28;
+
+const char *OperationName(Operation operation) noexcept;
+
+struct OperationStats {
+  std::uint64_t calls;
+  std::uint64_t nanoseconds;  // inclusive of the nested operations
+  std::uint64_t sizes[kStatsSizeBuckets];
+};
+
+struct StatsSnapshot {
+  OperationStats operations[kStatsOperations];
+  std::uint64_t allocations, allocated_bytes;
+  std::uint64_t deallocations, deallocated_bytes;
+
+  const OperationStats &operator[](Operation operation) const noexcept {
+    return operations[static_cast<int>(operation)];
+  }
+};
+
+// the sum of the counters of all the threads, the finished ones included
+StatsSnapshot GetStats();
+// the counters of the calling thread
+StatsSnapshot GetThreadStats();
+// starts the counts of all the threads from zero
+void ResetStats();
+
+enum class StatsFormat { kText, kJson };
+
+// a table of the operations that were called, or a JSON object with every
+// operation: {"operations": {"MulMatrix": {"calls": ..., "nanoseconds": ...,
+// "sizes": {"<first size of the bucket>": calls, ...}}, ...},
+// "allocations": {"count": ..., "bytes": ...}, "deallocations": {...}}
+std::string FormatStats(const StatsSnapshot &stats, StatsFormat format);
+
+// RECORDING
+
+void RecordOperation(Operation operation, std::int64_t elements,
+                     std::uint64_t nanoseconds) noexcept;
+void RecordAllocation(std::size_t bytes) noexcept;
+void RecordDeallocation(std::size_t bytes) noexcept;
+
+// records one call of the operation on the given number of elements with
+// the time until the end of the scope
+class ScopedOperation {
+ public:
+  ScopedOperation(Operation operation, std::int64_t elements) noexcept
+      : operation_(operation),
+        elements_(elements),
+        start_(std::chrono::steady_clock::now()) {}
+  ScopedOperation(const ScopedOperation &) = delete;
+  ScopedOperation &operator=(const ScopedOperation &) = delete;
+  ~ScopedOperation() {
+    auto elapsed = std::chrono::steady_clock::now() - start_;
+    RecordOperation(
+        operation_, elements_,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+  }
+
+ private:
+  Operation operation_;
+  std::int64_t elements_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace s21
+
+#ifdef S21_STATS
+#define S21_STATS_CONCAT_(a, b) a##b
+#define S21_STATS_NAME_(line) S21_STATS_CONCAT_(s21_stats_scope_, line)
+#define S21_STATS_SCOPE(operation, elements)        \
+  ::s21::ScopedOperation S21_STATS_NAME_(__LINE__)( \
+      ::s21::Operation::operation, elements)
+#define S21_STATS_ALLOCATION(bytes) ::s21::RecordAllocation(bytes)
+#define S21_STATS_DEALLOCATION(bytes) ::s21::RecordDeallocation(bytes)
+#else
+#define S21_STATS_SCOPE(operation, elements) static_cast<void>(0)
+#define S21_STATS_ALLOCATION(bytes) static_cast<void>(0)
+#define S21_STATS_DEALLOCATION(bytes) static_cast<void>(0)
+#endif
+
+#endif  // SRC_S21_STATS_H_
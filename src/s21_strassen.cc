@@ -0,0 +1,158 @@
+#include "s21_strassen.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+
+#include "s21_gemm.h"
+#include "s21_thread_pool.h"
+
+namespace s21 {
+
+namespace {
+
+// elements added by one task of the quadrant additions
+constexpr std::ptrdiff_t kAddGrain = 1 << 15;
+
+int DefaultCrossover() {
+  if (const char *value = std::getenv("S21_STRASSEN_CROSSOVER"))
+    return std::max(0, std::atoi(value));
+  return 0;
+}
+
+std::atomic<int> &Crossover() {
+  static std::atomic<int> crossover{DefaultCrossover()};
+  return crossover;
+}
+
+// a product is split while its smallest dimension reaches the crossover,
+// which is at least 2 so that the halves are not empty
+bool Splits(int m, int n, int k, int crossover) noexcept {
+  return crossover > 0 && std::min({m, n, k}) >= std::max(crossover, 2);
+}
+
+double *At(double *p, int ld, int row, int col) noexcept {
+  return p + static_cast<std::ptrdiff_t>(row) * ld + col;
+}
+
+const double *At(const double *p, int ld, int row, int col) noexcept {
+  return p + static_cast<std::ptrdiff_t>(row) * ld + col;
+}
+
+// Z = op(X, Y) element by element for rows x cols blocks, Z may be X or Y
+template <class Op>
+void Combine(int rows, int cols, const double *x, int ldx, const double *y,
+             int ldy, double *z, int ldz, Op op) {
+  auto row_range = [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    for (auto i = static_cast<int>(begin); i < end; ++i) {
+      const double *x_row = At(x, ldx, i, 0), *y_row = At(y, ldy, i, 0);
+      double *z_row = At(z, ldz, i, 0);
+      for (auto j = 0; j < cols; ++j) z_row[j] = op(x_row[j], y_row[j]);
+    }
+  };
+  ParallelFor(rows, std::max<std::ptrdiff_t>(1, kAddGrain / cols), row_range);
+}
+
+void Fill(int rows, int cols, double *c, int ldc) {
+  for (auto i = 0; i < rows; ++i)
+    std::fill(At(c, ldc, i, 0), At(c, ldc, i, cols), 0.0);
+}
+
+}  // namespace
+
+void SetStrassenCrossover(int crossover) {
+  Crossover().store(std::max(0, crossover), std::memory_order_relaxed);
+}
+
+int GetStrassenCrossover() {
+  return Crossover().load(std::memory_order_relaxed);
+}
+
+// the temporaries X and Y of this level and the workspace of the products
+std::size_t StrassenWorkspace(int m, int n, int k, int crossover) {
+  if (!Splits(m, n, k, crossover)) return 0;
+  const std::size_t mh = m / 2, nh = n / 2, kh = k / 2;
+  return mh * std::max(kh, nh) + kh * nh +
+         StrassenWorkspace(m / 2, n / 2, k / 2, crossover);
+}
+
+// the schedule of Boyer, Dumas, Pernet and Zhou: the products are computed
+// into the quadrants of C and two temporaries, X for the sums of A and for
+// P1, Y for the sums of B
+void StrassenGemm(int m, int n, int k, const double *a, int lda,
+                  const double *b, int ldb, double *c, int ldc, int crossover,
+                  double *workspace) {
+  if (!Splits(m, n, k, crossover)) {
+    Fill(m, n, c, ldc);
+    Gemm(m, n, k, 1, a, lda, b, ldb, c, ldc);
+    return;
+  }
+  const int mh = m / 2, nh = n / 2, kh = k / 2;
+  const double *a11 = a, *a12 = At(a, lda, 0, kh), *a21 = At(a, lda, mh, 0),
+               *a22 = At(a, lda, mh, kh);
+  const double *b11 = b, *b12 = At(b, ldb, 0, nh), *b21 = At(b, ldb, kh, 0),
+               *b22 = At(b, ldb, kh, nh);
+  double *c11 = c, *c12 = At(c, ldc, 0, nh), *c21 = At(c, ldc, mh, 0),
+         *c22 = At(c, ldc, mh, nh);
+  double *x = workspace,
+         *y = workspace + static_cast<std::size_t>(mh) * std::max(kh, nh),
+         *rest = y + static_cast<std::size_t>(kh) * nh;
+  const std::plus<double> add;
+  const std::minus<double> sub;
+  auto product = [&](const double *lhs, int ld_lhs, const double *rhs,
+                     int ld_rhs, double *out, int ld_out) {
+    StrassenGemm(mh, nh, kh, lhs, ld_lhs, rhs, ld_rhs, out, ld_out, crossover,
+                 rest);
+  };
+
+  Combine(mh, kh, a11, lda, a21, lda, x, kh, sub);    // S3 = A11 - A21
+  Combine(kh, nh, b22, ldb, b12, ldb, y, nh, sub);    // T3 = B22 - B12
+  product(x, kh, y, nh, c21, ldc);                    // P7 = S3 * T3
+  Combine(mh, kh, a21, lda, a22, lda, x, kh, add);    // S1 = A21 + A22
+  Combine(kh, nh, b12, ldb, b11, ldb, y, nh, sub);    // T1 = B12 - B11
+  product(x, kh, y, nh, c22, ldc);                    // P5 = S1 * T1
+  Combine(mh, kh, x, kh, a11, lda, x, kh, sub);       // S2 = S1 - A11
+  Combine(kh, nh, b22, ldb, y, nh, y, nh, sub);       // T2 = B22 - T1
+  product(x, kh, y, nh, c12, ldc);                    // P6 = S2 * T2
+  Combine(mh, kh, a12, lda, x, kh, x, kh, sub);       // S4 = A12 - S2
+  product(x, kh, b22, ldb, c11, ldc);                 // P3 = S4 * B22
+  product(a11, lda, b11, ldb, x, nh);                 // P1 = A11 * B11
+  Combine(mh, nh, x, nh, c12, ldc, c12, ldc, add);    // U2 = P1 + P6
+  Combine(mh, nh, c12, ldc, c21, ldc, c21, ldc, add); // U3 = U2 + P7
+  Combine(mh, nh, c12, ldc, c22, ldc, c12, ldc, add); // U4 = U2 + P5
+  Combine(mh, nh, c21, ldc, c22, ldc, c22, ldc, add); // C22 = U3 + P5
+  Combine(mh, nh, c12, ldc, c11, ldc, c12, ldc, add); // C12 = U4 + P3
+  Combine(kh, nh, y, nh, b21, ldb, y, nh, sub);       // T4 = T2 - B21
+  product(a22, lda, y, nh, c11, ldc);                 // P4 = A22 * T4
+  Combine(mh, nh, c21, ldc, c11, ldc, c21, ldc, sub); // C21 = U3 - P4
+  product(a12, lda, b21, ldb, c11, ldc);              // P2 = A12 * B21
+  Combine(mh, nh, x, nh, c11, ldc, c11, ldc, add);    // C11 = P1 + P2
+
+  // the odd shared index, last column and last row
+  const int m2 = 2 * mh, n2 = 2 * nh, k2 = 2 * kh;
+  if (k2 < k) Gemm(m2, n2, 1, 1, a + k2, lda, At(b, ldb, k2, 0), ldb, c, ldc);
+  if (n2 < n) {
+    Fill(m, 1, c + n2, ldc);
+    Gemm(m, 1, k, 1, a, lda, b + n2, ldb, c + n2, ldc);
+  }
+  if (m2 < m) {
+    Fill(1, n2, At(c, ldc, m2, 0), ldc);
+    Gemm(1, n2, k, 1, At(a, lda, m2, 0), lda, b, ldb, At(c, ldc, m2, 0), ldc);
+  }
+}
+
+void Multiply(int m, int n, int k, const double *a, int lda, const double *b,
+              int ldb, double *c, int ldc) {
+  const int crossover = GetStrassenCrossover();
+  if (!Splits(m, n, k, crossover)) {
+    Gemm(m, n, k, 1, a, lda, b, ldb, c, ldc);
+    return;
+  }
+  std::unique_ptr<double[]> workspace(
+      new double[StrassenWorkspace(m, n, k, crossover)]);
+  StrassenGemm(m, n, k, a, lda, b, ldb, c, ldc, crossover, workspace.get());
+}
+
+}  // namespace s21
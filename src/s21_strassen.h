@@ -0,0 +1,39 @@
+#ifndef SRC_S21_STRASSEN_H_
+#define SRC_S21_STRASSEN_H_
+
+#include <cstddef>
+
+namespace s21 {
+
+// the smallest dimension from which MulMatrix and the products of the
+// operator * use Strassen-Winograd instead of the classical kernel, 0 turns
+// it off; the initial value comes from the S21_STRASSEN_CROSSOVER
+// environment variable, without it the mode is off, because the result is
+// rounded differently and its error bound grows with the recursion depth
+void SetStrassenCrossover(int crossover);
+int GetStrassenCrossover();
+
+// the elements of the workspace that StrassenGemm needs for these
+// dimensions and crossover: about two thirds of C for square operands
+std::size_t StrassenWorkspace(int m, int n, int k, int crossover);
+
+// C = A * B for row-major operands given by the first element and the
+// leading dimension, A is m x k, B is k x n; the previous contents of C are
+// overwritten. While the smallest dimension reaches the crossover, the even
+// part of the product is split into quadrants and computed with 7 products
+// and 15 additions of them (Winograd's variant of Strassen's scheme), the
+// odd last row, column and shared index are peeled off and added with Gemm;
+// smaller products use Gemm. The temporaries of every level are taken from
+// the workspace of StrassenWorkspace(m, n, k, crossover) elements.
+void StrassenGemm(int m, int n, int k, const double *a, int lda,
+                  const double *b, int ldb, double *c, int ldc, int crossover,
+                  double *workspace);
+
+// C = A * B for a C filled with zeros: StrassenGemm with its own workspace
+// when the crossover is on and the dimensions reach it, Gemm otherwise
+void Multiply(int m, int n, int k, const double *a, int lda, const double *b,
+              int ldb, double *c, int ldc);
+
+}  // namespace s21
+
+#endif  // SRC_S21_STRASSEN_H_
@@ -0,0 +1,222 @@
+#include "s21_thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <stdexcept>
+
+namespace s21 {
+
+namespace {
+
+// set in the pool threads and while a thread runs a parallel loop, nested
+// loops then run serially instead of waiting for the busy pool; set in a
+// sequenced ExecutionScope too
+thread_local bool inside_parallel_loop = false;
+
+// chunks per thread, extra chunks let fast threads steal from slow ones
+constexpr std::ptrdiff_t kChunksPerThread = 4;
+
+int DefaultThreadCount() {
+  if (const char *value = std::getenv("S21_NUM_THREADS")) {
+    int threads = std::atoi(value);
+    if (threads > 0) return threads;
+  }
+  return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+}
+
+}  // namespace
+
+// one parallel loop: a queue of chunk indices per participating thread
+struct ThreadPool::Job {
+  struct Queue {
+    std::mutex mutex;
+    std::deque<std::ptrdiff_t> chunks;
+  };
+
+  const Body *body;
+  std::ptrdiff_t count, chunk;
+  std::vector<Queue> queues;
+  std::atomic<std::ptrdiff_t> remaining;
+  std::mutex done_mutex;
+  std::condition_variable done;
+  std::exception_ptr error;
+
+  Job(const Body *job_body, std::ptrdiff_t job_count, std::ptrdiff_t job_chunk,
+      int threads)
+      : body(job_body),
+        count(job_count),
+        chunk(job_chunk),
+        queues(threads),
+        remaining((job_count + job_chunk - 1) / job_chunk) {
+    for (std::ptrdiff_t i = 0; i < remaining; ++i)
+      queues[i % threads].chunks.push_back(i);
+  }
+
+  // the front of the own queue, then the back of the others
+  bool Take(int index, std::ptrdiff_t &chunk_index) {
+    const int threads = static_cast<int>(queues.size());
+    for (auto shift = 0; shift < threads; ++shift) {
+      Queue &queue = queues[(index + shift) % threads];
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      if (queue.chunks.empty()) continue;
+      if (shift == 0) {
+        chunk_index = queue.chunks.front();
+        queue.chunks.pop_front();
+      } else {
+        chunk_index = queue.chunks.back();
+        queue.chunks.pop_back();
+      }
+      return true;
+    }
+    return false;
+  }
+};
+
+// CONSTRUCTORS
+
+ThreadPool::ThreadPool(int threads)
+    : thread_count_(1), generation_(0), stop_(false) {
+  StartWorkers(threads);
+}
+
+ThreadPool::~ThreadPool() { StopWorkers(); }
+
+ThreadPool &ThreadPool::Instance() {
+  static ThreadPool pool(DefaultThreadCount());
+  return pool;
+}
+
+// WORKERS
+
+void ThreadPool::StartWorkers(int threads) {
+  stop_ = false;
+  for (auto i = 1; i < threads; ++i)
+    workers_.emplace_back(&ThreadPool::WorkerLoop, this, i);
+  thread_count_ = static_cast<int>(workers_.size()) + 1;
+}
+
+void ThreadPool::StopWorkers() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+  for (auto &worker : workers_) worker.join();
+  workers_.clear();
+  thread_count_ = 1;
+}
+
+void ThreadPool::WorkerLoop(int index) {
+  inside_parallel_loop = true;
+  std::size_t seen_generation = 0;
+  for (;;) {
+    std::shared_ptr<Job> job;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      wake_.wait(lock,
+                 [&] { return stop_ || generation_ != seen_generation; });
+      if (stop_) return;
+      seen_generation = generation_;
+      job = job_;
+    }
+    if (job) RunJob(*job, index);
+  }
+}
+
+// runs chunks until all queues are empty
+void ThreadPool::RunJob(Job &job, int index) {
+  std::ptrdiff_t chunk_index = 0;
+  while (job.Take(index, chunk_index)) {
+    std::ptrdiff_t begin = chunk_index * job.chunk;
+    std::ptrdiff_t end = std::min(job.count, begin + job.chunk);
+    try {
+      (*job.body)(begin, end);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(job.done_mutex);
+      if (!job.error) job.error = std::current_exception();
+    }
+    if (job.remaining.fetch_sub(1) == 1) {
+      std::lock_guard<std::mutex> lock(job.done_mutex);
+      job.done.notify_all();
+    }
+  }
+}
+
+// ACCESSORS
+
+// workers_ changes under submit_mutex_ in Resize, the count is read without
+// it, so it is kept apart in an atomic
+int ThreadPool::GetThreadCount() const noexcept { return thread_count_; }
+
+// MUTATORS
+
+void ThreadPool::Resize(int threads) {
+  if (threads < 1)
+    throw std::invalid_argument("The number of threads must be positive");
+  std::lock_guard<std::mutex> lock(submit_mutex_);
+  if (threads == GetThreadCount()) return;
+  StopWorkers();
+  {
+    std::lock_guard<std::mutex> job_lock(mutex_);
+    job_.reset();
+  }
+  StartWorkers(threads);
+}
+
+// OPERATIONS
+
+void ThreadPool::ParallelFor(std::ptrdiff_t count, std::ptrdiff_t grain,
+                             const Body &body) {
+  if (count <= 0) return;
+  grain = std::max<std::ptrdiff_t>(grain, 1);
+  std::unique_lock<std::mutex> submit_lock(submit_mutex_, std::defer_lock);
+  if (count < 2 * grain || inside_parallel_loop || !submit_lock.try_lock()) {
+    body(0, count);
+    return;
+  }
+  // the workers cannot change while the submit lock is held
+  const int threads = GetThreadCount();
+  if (threads == 1) {
+    submit_lock.unlock();
+    body(0, count);
+    return;
+  }
+  std::ptrdiff_t chunk = std::max(
+      grain, (count + threads * kChunksPerThread - 1) /
+                 (threads * kChunksPerThread));
+  auto job = std::make_shared<Job>(&body, count, chunk, threads);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    job_ = job;
+    ++generation_;
+  }
+  wake_.notify_all();
+  inside_parallel_loop = true;
+  RunJob(*job, 0);
+  inside_parallel_loop = false;
+  {
+    std::unique_lock<std::mutex> lock(job->done_mutex);
+    job->done.wait(lock, [&] { return job->remaining == 0; });
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    job_.reset();
+  }
+  if (job->error) std::rethrow_exception(job->error);
+}
+
+ExecutionScope::ExecutionScope(Execution execution) noexcept
+    : serial_(inside_parallel_loop) {
+  if (execution == Execution::kSequenced) inside_parallel_loop = true;
+}
+
+ExecutionScope::~ExecutionScope() { inside_parallel_loop = serial_; }
+
+void SetNumThreads(int threads) { ThreadPool::Instance().Resize(threads); }
+
+int GetNumThreads() { return ThreadPool::Instance().GetThreadCount(); }
+
+}  // namespace s21
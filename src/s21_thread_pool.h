@@ -0,0 +1,99 @@
+#ifndef SRC_S21_THREAD_POOL_H_
+#define SRC_S21_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace s21 {
+
+// how an operation may run: kSequenced on the calling thread only,
+// kParallel and kParallelUnsequenced with its loops split over the thread
+// pool; the policies of <execution> map onto it, see s21_execution.h
+enum class Execution { kSequenced, kParallel, kParallelUnsequenced };
+
+// the number of threads used by the matrix operations, including the calling
+// one; the initial value comes from the S21_NUM_THREADS environment variable
+// or the number of hardware threads
+void SetNumThreads(int threads);
+int GetNumThreads();
+
+// a pool of worker threads that run parallel loops together with the thread
+// that submits them; the iterations are dealt out in chunks to per-thread
+// queues and idle threads steal chunks from the back of the other queues
+class ThreadPool {
+ public:
+  using Body = std::function<void(std::ptrdiff_t begin, std::ptrdiff_t end)>;
+
+  static ThreadPool &Instance();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+  ~ThreadPool();
+
+  int GetThreadCount() const noexcept;
+  void Resize(int threads);
+
+  // calls body on consecutive subranges of [0, count) that are at least
+  // grain long; runs serially when the range is short, the pool has one
+  // thread, or the call is nested inside another parallel loop
+  void ParallelFor(std::ptrdiff_t count, std::ptrdiff_t grain,
+                   const Body &body);
+
+ private:
+  struct Job;
+
+  explicit ThreadPool(int threads);
+  void StartWorkers(int threads);
+  void StopWorkers();
+  void WorkerLoop(int index);
+  static void RunJob(Job &job, int index);
+
+  std::vector<std::thread> workers_;
+  std::atomic<int> thread_count_;  // workers_.size() + 1
+  std::mutex submit_mutex_;  // one parallel loop at a time
+  std::mutex mutex_;         // guards job_, generation_ and stop_
+  std::condition_variable wake_;
+  std::shared_ptr<Job> job_;
+  std::size_t generation_;
+  bool stop_;
+};
+
+// ParallelFor on the shared pool, the body is passed by reference, so
+// wrapping it into ThreadPool::Body does not allocate
+template <class F>
+void ParallelFor(std::ptrdiff_t count, std::ptrdiff_t grain, const F &body) {
+  ThreadPool::Instance().ParallelFor(count, grain, std::cref(body));
+}
+
+// while it lives, the parallel loops started by the calling thread run
+// serially on it; with kParallel or kParallelUnsequenced it changes nothing
+class ExecutionScope {
+ public:
+  explicit ExecutionScope(Execution execution) noexcept;
+  ExecutionScope(const ExecutionScope &) = delete;
+  ExecutionScope &operator=(const ExecutionScope &) = delete;
+  ~ExecutionScope();
+
+ private:
+  bool serial_;  // the previous state of the thread
+};
+
+// ParallelFor as the execution allows it
+template <class F>
+void ParallelFor(Execution execution, std::ptrdiff_t count,
+                 std::ptrdiff_t grain, const F &body) {
+  if (execution != Execution::kSequenced)
+    ParallelFor(count, grain, body);
+  else if (count > 0)
+    body(0, count);
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_THREAD_POOL_H_
@@ -0,0 +1,136 @@
+#include "s21_transpose.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "s21_simd.h"
+#include "s21_thread_pool.h"
+
+namespace s21 {
+
+namespace {
+
+// the order of a tile, a tile of the source and of the result take 16 KiB
+constexpr int kTile = 32;
+constexpr int kBlock = kTransposeBlock;
+
+// elements below which the transposition runs on the calling thread
+constexpr std::ptrdiff_t kParallelGrain = 1 << 16;
+
+// results from this size in bytes do not fit the cache anyway and are
+// written with non-temporal stores, which skip reading the lines first
+constexpr std::size_t kStreamBytes = std::size_t(1) << 24;
+
+using Index = std::ptrdiff_t;
+
+using BlockKernel = void (*)(const double *a, Index lda, double *b, Index ldb);
+
+// B = A^T for the part of A in rows [r0, r1) and columns [c0, c1): whole
+// blocks go through the kernel, the remaining edges are copied one by one
+void TransposeTile(BlockKernel kernel, int r0, int r1, int c0, int c1,
+                   const double *a, Index lda, double *b, Index ldb) {
+  const int r_full = r0 + (r1 - r0) / kBlock * kBlock;
+  const int c_full = c0 + (c1 - c0) / kBlock * kBlock;
+  for (auto i = r0; i < r_full; i += kBlock)
+    for (auto j = c0; j < c_full; j += kBlock)
+      kernel(a + i * lda + j, lda, b + j * ldb + i, ldb);
+  for (auto i = r0; i < r1; ++i)
+    for (auto j = i < r_full ? c_full : c0; j < c1; ++j)
+      b[j * ldb + i] = a[i * lda + j];
+}
+
+// exchanges the block at (i, j) with the transposed block at (j, i),
+// a diagonal block is transposed in place
+void SwapBlocks(const SimdKernels &simd, int i, int j, double *a, Index lda) {
+  double upper[kBlock * kBlock];
+  double *block_ij = a + i * lda + j, *block_ji = a + j * lda + i;
+  simd.transpose_block(block_ij, lda, upper, kBlock);
+  if (i != j) simd.transpose_block(block_ji, lda, block_ij, lda);
+  for (auto row = 0; row < kBlock; ++row)
+    std::copy(upper + row * kBlock, upper + (row + 1) * kBlock,
+              block_ji + row * lda);
+}
+
+}  // namespace
+
+// tasks take tiles of columns of A, so every task writes its own rows of B;
+// the blocks of B start at multiples of kBlock, so with an aligned B and a
+// leading dimension of whole cache lines every block row is a whole line
+// and large results can be streamed
+void Transpose(int rows, int cols, const double *a, int lda, double *b,
+               int ldb) {
+  const SimdKernels &simd = Simd();
+  const bool stream =
+      static_cast<std::size_t>(rows) * cols * sizeof(double) >= kStreamBytes &&
+      reinterpret_cast<std::uintptr_t>(b) % 64 == 0 && ldb % kBlock == 0;
+  const BlockKernel kernel =
+      stream ? simd.transpose_block_stream : simd.transpose_block;
+  auto column_tiles = [&](Index begin, Index end) {
+    const int c_begin = static_cast<int>(begin) * kTile;
+    const int c_end = std::min(cols, static_cast<int>(end) * kTile);
+    for (auto c0 = c_begin; c0 < c_end; c0 += kTile)
+      for (auto r0 = 0; r0 < rows; r0 += kTile)
+        TransposeTile(kernel, r0, std::min(rows, r0 + kTile), c0,
+                      std::min(c_end, c0 + kTile), a, lda, b, ldb);
+    // the streamed stores of the task are made visible before it completes
+    if (stream) std::atomic_thread_fence(std::memory_order_seq_cst);
+  };
+  const Index tiles = (cols + kTile - 1) / kTile;
+  const Index tile_elements = static_cast<Index>(rows) * kTile;
+  if (tiles * tile_elements < 2 * kParallelGrain)
+    column_tiles(0, tiles);
+  else
+    ParallelFor(tiles,
+                std::max<Index>(1, kParallelGrain / tile_elements),
+                column_tiles);
+}
+
+// the task of a tile row i exchanges the tiles (i, j) and (j, i) for j >= i,
+// so two tasks never touch the same tile
+void TransposeSquare(int n, double *a, int lda) {
+  const SimdKernels &simd = Simd();
+  const int full = n / kBlock * kBlock;
+  auto tile_rows = [&](Index begin, Index end) {
+    for (auto ti = static_cast<int>(begin) * kTile; ti < end * kTile;
+         ti += kTile)
+      for (auto tj = ti; tj < full; tj += kTile)
+        for (auto i = ti; i < std::min(full, ti + kTile); i += kBlock)
+          for (auto j = std::max(tj, i); j < std::min(full, tj + kTile);
+               j += kBlock)
+            SwapBlocks(simd, i, j, a, lda);
+  };
+  const Index tiles = (full + kTile - 1) / kTile;
+  if (static_cast<Index>(n) * n < 2 * kParallelGrain)
+    tile_rows(0, tiles);
+  else
+    ParallelFor(tiles, 1, tile_rows);
+  // the pairs with an element in the last n % kBlock rows or columns
+  for (auto i = 0; i < n; ++i)
+    for (auto j = std::max(i + 1, full); j < n; ++j)
+      std::swap(a[static_cast<Index>(i) * lda + j],
+                a[static_cast<Index>(j) * lda + i]);
+}
+
+// the element at k = i * cols + j moves to j * rows + i, which equals
+// k * rows modulo (rows * cols - 1); the first and the last elements stay
+void TransposeCycles(int rows, int cols, double *a) {
+  if (rows == 1 || cols == 1) return;
+  const Index last = static_cast<Index>(rows) * cols - 1;
+  std::vector<bool> moved(last, false);
+  for (Index start = 1; start < last; ++start) {
+    if (moved[start]) continue;
+    double carried = a[start];
+    Index current = start;
+    do {
+      current = current * rows % last;
+      std::swap(carried, a[current]);
+      moved[current] = true;
+    } while (current != start);
+  }
+}
+
+}  // namespace s21
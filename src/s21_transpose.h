@@ -0,0 +1,27 @@
+#ifndef SRC_S21_TRANSPOSE_H_
+#define SRC_S21_TRANSPOSE_H_
+
+namespace s21 {
+
+// B = A^T for row-major operands given by the first element and the leading
+// dimension: A is rows x cols, B is cols x rows. The matrices are walked in
+// square tiles that fit the L1 cache together, every tile is transposed by
+// the SIMD block kernel, and tiles of rows of B are distributed over the
+// thread pool.
+void Transpose(int rows, int cols, const double *a, int lda, double *b,
+               int ldb);
+
+// A = A^T in place for a square n x n matrix: the blocks above the diagonal
+// are exchanged with the transposed blocks below it tile by tile.
+void TransposeSquare(int n, double *a, int lda);
+
+// in-place transposition of a dense rows x cols buffer into a dense
+// cols x rows one: the permutation of the elements is applied cycle by
+// cycle with one bit of bookkeeping per element. It saves the second buffer
+// but jumps over the whole matrix, so it is slower than Transpose for
+// matrices that do not fit the cache.
+void TransposeCycles(int rows, int cols, double *a);
+
+}  // namespace s21
+
+#endif  // SRC_S21_TRANSPOSE_H_
@@ -0,0 +1,151 @@
+#include "s21_triangular.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "s21_gemm.h"
+#include "s21_simd.h"
+#include "s21_transpose.h"
+
+namespace s21 {
+
+namespace {
+
+// rows substituted directly before the rest is updated by Gemm
+constexpr int kBlock = 64;
+
+// four independent sums keep the multiply-adds from waiting on each other
+double Dot(const double *a, const double *b, int n) noexcept {
+  double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  auto i = 0;
+  for (; i + 4 <= n; i += 4) {
+    s0 += a[i] * b[i];
+    s1 += a[i + 1] * b[i + 1];
+    s2 += a[i + 2] * b[i + 2];
+    s3 += a[i + 3] * b[i + 3];
+  }
+  for (; i < n; ++i) s0 += a[i] * b[i];
+  return (s0 + s1) + (s2 + s3);
+}
+
+const double *Row(const double *t, int ldt, int i) noexcept {
+  return t + static_cast<std::ptrdiff_t>(i) * ldt;
+}
+
+// a single contiguous column: the rows of a lower triangle are dot products
+// with the solved elements, those of an upper one with the elements below,
+// and the rows of a transposed lower triangle are subtracted from the
+// elements above once their element is solved
+void SolveVector(Triangle triangle, int n, const double *t, int ldt,
+                 double *x) {
+  switch (triangle) {
+    case Triangle::kLower:
+    case Triangle::kUnitLower:
+      for (auto i = 0; i < n; ++i) {
+        x[i] -= Dot(Row(t, ldt, i), x, i);
+        if (triangle == Triangle::kLower) x[i] /= Row(t, ldt, i)[i];
+      }
+      break;
+    case Triangle::kUpper:
+      for (auto i = n - 1; i >= 0; --i) {
+        const double *row = Row(t, ldt, i);
+        x[i] = (x[i] - Dot(row + i + 1, x + i + 1, n - i - 1)) / row[i];
+      }
+      break;
+    case Triangle::kLowerTransposed: {
+      const auto &simd = Simd();
+      for (auto i = n - 1; i >= 0; --i) {
+        const double *row = Row(t, ldt, i);
+        x[i] /= row[i];
+        simd.axpy(x, -x[i], row, i);
+      }
+      break;
+    }
+  }
+}
+
+// the rows [i0, i1) of X by substitution with the diagonal block, every
+// step subtracts a multiple of a whole row of X from another one
+void SolveBlock(Triangle triangle, int i0, int i1, int cols, const double *t,
+                int ldt, double *x, int ldx) {
+  const auto &simd = Simd();
+  auto x_row = [&](int i) { return x + static_cast<std::ptrdiff_t>(i) * ldx; };
+  auto divide = [&](int i) {
+    const double pivot = Row(t, ldt, i)[i];
+    double *row = x_row(i);
+    for (auto j = 0; j < cols; ++j) row[j] /= pivot;
+  };
+  switch (triangle) {
+    case Triangle::kLower:
+    case Triangle::kUnitLower:
+      for (auto i = i0; i < i1; ++i) {
+        const double *row = Row(t, ldt, i);
+        for (auto k = i0; k < i; ++k)
+          simd.axpy(x_row(i), -row[k], x_row(k), cols);
+        if (triangle == Triangle::kLower) divide(i);
+      }
+      break;
+    case Triangle::kUpper:
+      for (auto i = i1 - 1; i >= i0; --i) {
+        const double *row = Row(t, ldt, i);
+        for (auto k = i + 1; k < i1; ++k)
+          simd.axpy(x_row(i), -row[k], x_row(k), cols);
+        divide(i);
+      }
+      break;
+    case Triangle::kLowerTransposed:
+      for (auto i = i1 - 1; i >= i0; --i) {
+        divide(i);
+        const double *row = Row(t, ldt, i);
+        for (auto k = i0; k < i; ++k)
+          simd.axpy(x_row(k), -row[k], x_row(i), cols);
+      }
+      break;
+  }
+}
+
+}  // namespace
+
+void SolveTriangular(Triangle triangle, int n, int cols, const double *t,
+                     int ldt, double *x, int ldx) {
+  if (n <= 0 || cols <= 0) return;
+  auto x_row = [&](int i) { return x + static_cast<std::ptrdiff_t>(i) * ldx; };
+  if (cols == 1) {
+    if (ldx == 1) return SolveVector(triangle, n, t, ldt, x);
+    std::vector<double> column(n);
+    for (auto i = 0; i < n; ++i) column[i] = *x_row(i);
+    SolveVector(triangle, n, t, ldt, column.data());
+    for (auto i = 0; i < n; ++i) *x_row(i) = column[i];
+    return;
+  }
+  if (triangle == Triangle::kLower || triangle == Triangle::kUnitLower) {
+    for (auto i0 = 0; i0 < n; i0 += kBlock) {
+      const int i1 = std::min(n, i0 + kBlock);
+      SolveBlock(triangle, i0, i1, cols, t, ldt, x, ldx);
+      // X(i1:n) -= T(i1:n, i0:i1) * X(i0:i1)
+      Gemm(n - i1, cols, i1 - i0, -1, Row(t, ldt, i1) + i0, ldt, x_row(i0),
+           ldx, x_row(i1), ldx);
+    }
+    return;
+  }
+  // the block of the transposed lower triangle above the diagonal block
+  std::vector<double> panel;
+  if (triangle == Triangle::kLowerTransposed)
+    panel.resize(static_cast<std::size_t>(kBlock) * n);
+  for (auto i1 = n; i1 > 0;) {
+    const int i0 = std::max(0, i1 - kBlock);
+    SolveBlock(triangle, i0, i1, cols, t, ldt, x, ldx);
+    // X(0:i0) -= T(0:i0, i0:i1) * X(i0:i1)
+    if (triangle == Triangle::kUpper) {
+      Gemm(i0, cols, i1 - i0, -1, t + i0, ldt, x_row(i0), ldx, x, ldx);
+    } else if (i0) {
+      Transpose(i1 - i0, i0, Row(t, ldt, i0), ldt, panel.data(), i1 - i0);
+      Gemm(i0, cols, i1 - i0, -1, panel.data(), i1 - i0, x_row(i0), ldx, x,
+           ldx);
+    }
+    i1 = i0;
+  }
+}
+
+}  // namespace s21
@@ -0,0 +1,25 @@
+#ifndef SRC_S21_TRIANGULAR_H_
+#define SRC_S21_TRIANGULAR_H_
+
+namespace s21 {
+
+// the triangles of a square matrix that SolveTriangular can invert
+enum class Triangle {
+  kLower,            // the lower triangle with its diagonal
+  kUnitLower,        // the lower triangle with ones on the diagonal
+  kUpper,            // the upper triangle with its diagonal
+  kLowerTransposed,  // the transposed lower triangle, an upper one
+};
+
+// X = T^-1 * X for the triangle T of the n x n matrix t and the n x cols
+// matrix X, row-major operands given by the first element and the leading
+// dimension; the elements of t outside the triangle are not read. Blocks of
+// rows are substituted directly and the rows not solved yet are updated by
+// one Gemm per block; a single column is solved with dot products or axpy
+// along the rows of t.
+void SolveTriangular(Triangle triangle, int n, int cols, const double *t,
+                     int ldt, double *x, int ldx);
+
+}  // namespace s21
+
+#endif  // SRC_S21_TRIANGULAR_H_
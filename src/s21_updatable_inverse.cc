@@ -0,0 +1,280 @@
+#include "s21_updatable_inverse.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "s21_gemm.h"
+#include "s21_lu.h"
+#include "s21_reduce.h"
+#include "s21_runs.h"
+#include "s21_simd.h"
+#include "s21_thread_pool.h"
+
+namespace {
+
+// columns of a product x^T * A computed by one task
+constexpr int kColumnTask = 256;
+
+const double *RowOf(const S21Matrix &a, int i) noexcept {
+  return a.Data() + static_cast<std::ptrdiff_t>(i) * a.GetStride();
+}
+
+// y = A * x for a square matrix, a dot product per row
+void MatVec(const S21Matrix &a, const double *x, double *y) {
+  const int n = a.GetRows();
+  const auto &simd = s21::Simd();
+  s21::ForEachRow(n, n, [&](int i) { y[i] = simd.dot(RowOf(a, i), x, n); });
+}
+
+// y = x^T * A for a square matrix, the rows scaled by x are added into
+// blocks of y that stay in the cache
+void VecMat(const double *x, const S21Matrix &a, double *y) {
+  const int n = a.GetRows();
+  const auto &simd = s21::Simd();
+  s21::ParallelFor(
+      (n + kColumnTask - 1) / kColumnTask, 1,
+      [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+        for (auto task = begin; task < end; ++task) {
+          const int c0 = static_cast<int>(task) * kColumnTask;
+          const int count = std::min(kColumnTask, n - c0);
+          std::fill(y + c0, y + c0 + count, 0.0);
+          for (auto i = 0; i < n; ++i)
+            if (x[i] != 0) simd.axpy(y + c0, x[i], RowOf(a, i) + c0, count);
+        }
+      });
+}
+
+// the estimate ||A||_1 * ||A^-1||_1 of the condition number and the
+// residual ||A * A^-1 * p - p||_inf of the inverse on a vector p of
+// pseudo-random signs, which costs two products with a vector, where the
+// residual of all of A * A^-1 - I would cost a matrix product; a NaN
+// estimate never compares as small
+struct Estimates {
+  double condition, residual;
+};
+
+Estimates Measure(const S21Matrix &a, const S21Matrix &inverse) {
+  const int n = a.GetRows();
+  Estimates estimates{a.Norm(s21::Norm::kOne) * inverse.Norm(s21::Norm::kOne),
+                      0};
+  std::vector<double> probe(n), x(n), y(n);
+  for (auto i = 0; i < n; ++i)
+    probe[i] = (static_cast<unsigned>(i) * 0x9E3779B1u) >> 31 ? -1 : 1;
+  MatVec(inverse, probe.data(), x.data());
+  MatVec(a, x.data(), y.data());
+  for (auto i = 0; i < n; ++i) {
+    const double error = std::fabs(y[i] - probe[i]);
+    if (!(error <= estimates.residual)) estimates.residual = error;
+  }
+  return estimates;
+}
+
+}  // namespace
+
+// CONSTRUCTORS
+
+// the copy of a matrix over external rows uses the default resource
+S21UpdatableInverse::S21UpdatableInverse(const S21Matrix &matrix)
+    : determinant_(0),
+      condition_(0),
+      residual_(0),
+      factored_condition_(0),
+      factored_residual_(0),
+      updates_(0) {
+  if (matrix.GetRows() != matrix.GetCols())
+    throw std::invalid_argument("The matrix is not square");
+  Factorize(S21Matrix(matrix, matrix.ResultResource()));
+}
+
+// ACCESSORS
+
+int S21UpdatableInverse::GetSize() const noexcept { return matrix_.rows_; }
+
+int S21UpdatableInverse::GetUpdateCount() const noexcept { return updates_; }
+
+const S21Matrix &S21UpdatableInverse::GetMatrix() const noexcept {
+  return matrix_;
+}
+
+double S21UpdatableInverse::ConditionEstimate() const noexcept {
+  return condition_;
+}
+
+double S21UpdatableInverse::Determinant() const noexcept {
+  return determinant_;
+}
+
+const S21Matrix &S21UpdatableInverse::InverseMatrix() const noexcept {
+  return inverse_;
+}
+
+// OPERATIONS
+
+// X = A^-1 * B, one matrix product with the kept inverse
+S21Matrix S21UpdatableInverse::Solve(const S21Matrix &rhs) const {
+  const int n = matrix_.rows_;
+  if (rhs.rows_ != n)
+    throw std::invalid_argument(
+        "The number of rows of the right-hand side must be "
+        "equal to the order of the matrix");
+  S21Matrix result(n, rhs.cols_);
+  s21::Gemm(n, rhs.cols_, n, 1, inverse_.matrix_, inverse_.stride_,
+            rhs.matrix_, rhs.stride_, result.matrix_, result.stride_);
+  return result;
+}
+
+void S21UpdatableInverse::Update(const S21Matrix &u, const S21Matrix &v) {
+  const int n = matrix_.rows_;
+  const int k = u.cols_;
+  if (u.rows_ != n || v.rows_ != n || v.cols_ != k)
+    throw std::invalid_argument(
+        "The factors of the update should have as many rows as the matrix "
+        "and the same number of columns");
+  const S21Matrix v_t = v.Transpose();
+  S21Matrix w(n, k), z(k, n), capacitance(k, k);
+  s21::Gemm(n, k, n, 1, inverse_.matrix_, inverse_.stride_, u.matrix_,
+            u.stride_, w.matrix_, w.stride_);
+  s21::Gemm(k, n, n, 1, v_t.matrix_, v_t.stride_, inverse_.matrix_,
+            inverse_.stride_, z.matrix_, z.stride_);
+  for (auto i = 0; i < k; ++i) capacitance.RowPtr(i)[i] = 1;
+  s21::Gemm(k, k, n, 1, v_t.matrix_, v_t.stride_, w.matrix_, w.stride_,
+            capacitance.matrix_, capacitance.stride_);
+  ApplyUpdate(w, z, capacitance, [&](S21Matrix &a) {
+    s21::Gemm(n, n, k, 1, u.matrix_, u.stride_, v_t.matrix_, v_t.stride_,
+              a.matrix_, a.stride_);
+  });
+}
+
+// U = delta * e_row and V = e_col: W is a scaled column of the inverse and
+// Z is one of its rows, so only the update itself takes O(n^2)
+void S21UpdatableInverse::SetValue(int row, int col, double value) {
+  const int n = matrix_.rows_;
+  if (row < 0 || row >= n)
+    throw std::out_of_range("The row index is incorrect");
+  if (col < 0 || col >= n)
+    throw std::out_of_range("The column index is incorrect");
+  const double delta = value - matrix_.RowPtr(row)[col];
+  if (delta == 0) return;
+  S21Matrix w(n, 1), z(1, n), capacitance(1, 1);
+  for (auto i = 0; i < n; ++i)
+    w.RowPtr(i)[0] = delta * inverse_.RowPtr(i)[row];
+  std::copy(inverse_.RowPtr(col), inverse_.RowPtr(col) + n, z.RowPtr(0));
+  capacitance.RowPtr(0)[0] = 1 + w.RowPtr(col)[0];
+  ApplyUpdate(w, z, capacitance,
+              [&](S21Matrix &a) { a.RowPtr(row)[col] = value; });
+}
+
+// U = e_row and V = values^T - A^T e_row: W is a column of the inverse
+void S21UpdatableInverse::SetRow(int row, const S21Matrix &values) {
+  const int n = matrix_.rows_;
+  if (row < 0 || row >= n)
+    throw std::out_of_range("The row index is incorrect");
+  if (values.rows_ != 1 || values.cols_ != n)
+    throw std::invalid_argument("The row should be a 1 x n matrix");
+  std::vector<double> delta(n);
+  for (auto j = 0; j < n; ++j)
+    delta[j] = values.RowPtr(0)[j] - matrix_.RowPtr(row)[j];
+  S21Matrix w(n, 1), z(1, n), capacitance(1, 1);
+  double product = 0;
+  for (auto i = 0; i < n; ++i) {
+    w.RowPtr(i)[0] = inverse_.RowPtr(i)[row];
+    product += delta[i] * w.RowPtr(i)[0];
+  }
+  VecMat(delta.data(), inverse_, z.RowPtr(0));
+  capacitance.RowPtr(0)[0] = 1 + product;
+  ApplyUpdate(w, z, capacitance, [&](S21Matrix &a) {
+    std::copy(values.RowPtr(0), values.RowPtr(0) + n, a.RowPtr(row));
+  });
+}
+
+// U = values - A e_col and V = e_col: Z is a row of the inverse
+void S21UpdatableInverse::SetCol(int col, const S21Matrix &values) {
+  const int n = matrix_.rows_;
+  if (col < 0 || col >= n)
+    throw std::out_of_range("The column index is incorrect");
+  if (values.rows_ != n || values.cols_ != 1)
+    throw std::invalid_argument("The column should be an n x 1 matrix");
+  std::vector<double> delta(n), product(n);
+  for (auto i = 0; i < n; ++i)
+    delta[i] = values.RowPtr(i)[0] - matrix_.RowPtr(i)[col];
+  MatVec(inverse_, delta.data(), product.data());
+  S21Matrix w(n, 1), z(1, n), capacitance(1, 1);
+  for (auto i = 0; i < n; ++i) w.RowPtr(i)[0] = product[i];
+  std::copy(inverse_.RowPtr(col), inverse_.RowPtr(col) + n, z.RowPtr(0));
+  capacitance.RowPtr(0)[0] = 1 + product[col];
+  ApplyUpdate(w, z, capacitance, [&](S21Matrix &a) {
+    for (auto i = 0; i < n; ++i) a.RowPtr(i)[col] = values.RowPtr(i)[0];
+  });
+}
+
+void S21UpdatableInverse::Refactor() {
+  Factorize(S21Matrix(matrix_, matrix_.ResultResource()));
+}
+
+// the state is replaced only by the factors of a regular matrix, so an
+// update that turns out singular leaves the previous state intact
+void S21UpdatableInverse::Factorize(S21Matrix matrix) {
+  const S21LUDecomposition lu(matrix);
+  if (lu.IsSingular())
+    throw std::invalid_argument("The determinant of the matrix is 0");
+  S21Matrix inverse = lu.InverseMatrix();
+  const Estimates estimates = Measure(matrix, inverse);
+  matrix_ = std::move(matrix);
+  inverse_ = std::move(inverse);
+  determinant_ = lu.Determinant();
+  updates_ = 0;
+  condition_ = factored_condition_ = estimates.condition;
+  residual_ = factored_residual_ = estimates.residual;
+}
+
+// w = A^-1 U, z = V^T A^-1 and the capacitance matrix I + V^T A^-1 U come
+// from the caller, which knows the structure of U and V; apply adds U V^T to
+// a matrix. The identity loses about log10(scale / pivot) digits of the
+// inverse, so a nearly singular capacitance matrix makes the updated matrix
+// factorized from scratch instead, which also decides whether it is singular;
+// the update is computed on copies and committed only when no new
+// factorization is needed or the new one succeeds
+template <class Apply>
+void S21UpdatableInverse::ApplyUpdate(const S21Matrix &w, const S21Matrix &z,
+                                      const S21Matrix &capacitance,
+                                      Apply apply) {
+  const int n = matrix_.rows_;
+  const int k = capacitance.rows_;
+  const S21LUDecomposition lu(capacitance);
+  double scale = 1, pivot = std::numeric_limits<double>::infinity();
+  for (auto i = 0; i < k; ++i) {
+    for (auto j = 0; j < k; ++j)
+      scale = std::max(scale, std::fabs(capacitance.RowPtr(i)[j]));
+    pivot = std::min(pivot, std::fabs(lu.GetFactors().RowPtr(i)[i]));
+  }
+  if (lu.IsSingular() || !(pivot >= kCapacitanceTolerance * scale)) {
+    S21Matrix updated(matrix_, matrix_.ResultResource());
+    apply(updated);
+    Factorize(std::move(updated));
+    return;
+  }
+  const S21Matrix y = lu.Solve(z);
+  S21Matrix matrix(matrix_, matrix_.ResultResource());
+  S21Matrix inverse(inverse_, inverse_.ResultResource());
+  s21::Gemm(n, n, k, -1, w.matrix_, w.stride_, y.matrix_, y.stride_,
+            inverse.matrix_, inverse.stride_);
+  apply(matrix);
+  const Estimates estimates = Measure(matrix, inverse);
+  // the residual right after a factorization may be exactly 0
+  const double residual_floor =
+      std::max(factored_residual_, n * std::numeric_limits<double>::epsilon());
+  if (!(estimates.condition <= kDriftFactor * factored_condition_) ||
+      !(estimates.residual <= kDriftFactor * residual_floor)) {
+    Factorize(std::move(matrix));
+    return;
+  }
+  matrix_ = std::move(matrix);
+  inverse_ = std::move(inverse);
+  determinant_ *= lu.Determinant();
+  ++updates_;
+  condition_ = estimates.condition;
+  residual_ = estimates.residual;
+}
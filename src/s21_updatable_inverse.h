@@ -0,0 +1,65 @@
+#ifndef SRC_S21_UPDATABLE_INVERSE_H_
+#define SRC_S21_UPDATABLE_INVERSE_H_
+
+#include "s21_matrix_oop.h"
+
+// The inverse and the determinant of a square matrix kept up to date while
+// the matrix changes by updates of low rank: A + U * V^T, where U and V are
+// n x k, changes the inverse by the Woodbury identity
+//   (A + U V^T)^-1 = A^-1 - A^-1 U (I + V^T A^-1 U)^-1 V^T A^-1
+// and multiplies the determinant by det(I + V^T A^-1 U), in O(n^2 * k)
+// instead of the O(n^3) of a new LU factorization. A changed element, row or
+// column is an update of rank 1 (Sherman-Morrison). The rounding errors of
+// the updates accumulate, so the matrix is factorized again when the
+// estimate ||A||_1 * ||A^-1||_1 of its condition number or the residual of
+// the inverse on a probe vector grows kDriftFactor times over its value
+// after the last factorization, or when the k x k capacitance matrix
+// I + V^T A^-1 U is too close to singular for the identity to be accurate.
+class S21UpdatableInverse {
+ private:
+  // the growth of the condition estimate or the residual that triggers a
+  // new factorization
+  static constexpr double kDriftFactor = 100;
+  // the smallest pivot of the capacitance matrix relative to its largest
+  // element and 1 below which the update is factorized from scratch
+  static constexpr double kCapacitanceTolerance = 1e-6;
+
+  S21Matrix matrix_;           // the current matrix A
+  S21Matrix inverse_;          // A^-1
+  double determinant_;         // det(A)
+  double condition_;           // ||A||_1 * ||A^-1||_1
+  double residual_;            // ||A * A^-1 * p - p||_inf for a probe p
+  double factored_condition_;  // the estimates after the last factorization
+  double factored_residual_;
+  int updates_;  // updates since the last factorization
+
+  void Factorize(S21Matrix matrix);
+  template <class Apply>
+  void ApplyUpdate(const S21Matrix &w, const S21Matrix &z,
+                   const S21Matrix &capacitance, Apply apply);
+
+ public:
+  explicit S21UpdatableInverse(const S21Matrix &matrix);
+
+  int GetSize() const noexcept;
+  int GetUpdateCount() const noexcept;
+  const S21Matrix &GetMatrix() const noexcept;
+  double ConditionEstimate() const noexcept;
+
+  double Determinant() const noexcept;
+  const S21Matrix &InverseMatrix() const noexcept;
+  S21Matrix Solve(const S21Matrix &rhs) const;
+
+  // A = A + U * V^T for n x k matrices U and V; the updates throw
+  // std::invalid_argument when the updated matrix is singular and leave the
+  // matrix, the inverse and the determinant as they were
+  void Update(const S21Matrix &u, const S21Matrix &v);
+  // replace an element, a row by a 1 x n matrix or a column by an n x 1 one
+  void SetValue(int row, int col, double value);
+  void SetRow(int row, const S21Matrix &values);
+  void SetCol(int col, const S21Matrix &values);
+  // drop the accumulated rounding errors of the updates
+  void Refactor();
+};
+
+#endif  // SRC_S21_UPDATABLE_INVERSE_H_
@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <execution>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include "s21_tests.h"
+
+TEST(AccessTests, element_test) {
+  // ARRANGE
+  S21Matrix A = FilledMatrix(3, 37);
+  const S21Matrix &B = A;
+
+  // ACT
+  A(2, 36) += 0.5;
+  double *data = A.Data();
+  data[A.GetStride() + 1] = -1;
+
+  // ASSERT
+  static_assert(std::is_same_v<decltype(A(0, 0)), double &>);
+  static_assert(std::is_same_v<decltype(B(0, 0)), const double &>);
+  static_assert(noexcept(B(0, 0)));
+  EXPECT_EQ(A.GetStride(), 40);
+  EXPECT_EQ(B(2, 36), 110.5);
+  EXPECT_EQ(B.GetValue(1, 1), -1);
+  EXPECT_EQ(&B(2, 3), B.Data() + 2 * B.GetStride() + 3);
+  EXPECT_EQ(A.Row(2).Data(), &A(2, 0));
+  EXPECT_THROW(B.GetValue(3, 0), std::out_of_range);
+}
+
+TEST(AccessTests, iterator_test) {
+  // ARRANGE
+  S21Matrix A = FilledMatrix(3, 37), B(3, 37);
+  const S21Matrix &C = A;
+
+  // ACT
+  std::transform(C.begin(), C.end(), B.begin(),
+                 [](double value) { return 2 * value; });
+  for (double &value : A.Row(1)) value = -value;
+  const auto column = A.Col(5);
+  const double column_sum = std::accumulate(column.begin(), column.end(), 0.0);
+
+  // ASSERT
+  static_assert(std::is_same_v<
+                std::iterator_traits<S21Matrix::iterator>::iterator_category,
+                std::random_access_iterator_tag>);
+  EXPECT_EQ(C.end() - C.begin(), 3 * 37);
+  EXPECT_EQ(C.begin()[40], C(1, 3));
+  EXPECT_EQ(*(C.end() - 1), C(2, 36));
+  EXPECT_TRUE(C.begin() + 37 < C.end());
+  S21Matrix::const_iterator it = A.begin();
+  it += 74;
+  EXPECT_EQ(it, C.begin() + 74);
+  EXPECT_EQ(*--it, C(1, 36));
+  for (auto i = 0; i < 3; ++i)
+    for (auto j = 0; j < 37; ++j) {
+      EXPECT_EQ(B(i, j), 2.0 * (i * 37 + j));
+      EXPECT_EQ(A(i, j), (i == 1 ? -1 : 1) * (i * 37.0 + j));
+    }
+  EXPECT_EQ(column_sum, 5 - (37 + 5) + (74 + 5));
+  // a transposed view is walked column by column of the matrix
+  const auto transposed = C.View().Transposed();
+  const std::vector<double> first(transposed.begin(), transposed.begin() + 4);
+  EXPECT_EQ(first, (std::vector<double>{C(0, 0), C(1, 0), C(2, 0), C(0, 1)}));
+  EXPECT_EQ(*std::make_reverse_iterator(C.end()), C(2, 36));
+}
+
+TEST(AccessTests, parallel_algorithms_test) {
+  // ARRANGE
+  S21Matrix A = FilledMatrix(300, 45), B(300, 45);
+  S21BasicMatrix<float> F(20, 50);
+
+  // ACT
+  std::transform(std::execution::par, A.begin(), A.end(), B.begin(),
+                 [](double value) { return value + 1; });
+  const double sum =
+      std::reduce(std::execution::par_unseq, B.cbegin(), B.cend(), 0.0);
+  std::fill(std::execution::par, F.begin(), F.end(), 0.5f);
+
+  // ASSERT
+  const double n = 300.0 * 45;
+  EXPECT_EQ(sum, n * (n + 1) / 2);
+  EXPECT_EQ(std::count(F.cbegin(), F.cend(), 0.5f), 1000);
+  F(3, 4) = 2;
+  EXPECT_EQ(F.GetValue(3, 4), 2);
+  EXPECT_EQ(*std::max_element(F.begin(), F.end()), 2);
+}
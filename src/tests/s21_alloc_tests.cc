@@ -0,0 +1,89 @@
+#include "../common/s21_alloc_counter.h"
+#include "s21_tests.h"
+
+TEST(AllocationTests, move_assign_test) {
+  // ARRANGE
+  S21Matrix A = FilledMatrix(3, 4, 0), B = FilledMatrix(3, 4, 1);
+  S21Matrix expected = B;
+
+  // ACT
+  std::size_t before = s21_alloc::AllocationCount();
+  A = std::move(B);
+  std::size_t count = s21_alloc::AllocationCount() - before;
+
+  // ASSERT
+  EXPECT_EQ(count, 0u);
+  EXPECT_EQ(A == expected, 1);
+  EXPECT_EQ(B.GetRows(), 0);
+  EXPECT_EQ(B.GetCols(), 0);
+  // a moved-from matrix can be assigned again
+  B = expected;
+  EXPECT_EQ(B == expected, 1);
+}
+
+TEST(AllocationTests, copy_assign_reuse_test) {
+  // ARRANGE
+  S21Matrix A(3, 40), B = FilledMatrix(3, 40, 2), C = FilledMatrix(2, 2, 0);
+
+  // ACT
+  std::size_t before = s21_alloc::AllocationCount();
+  A = B;
+  std::size_t same_size = s21_alloc::AllocationCount() - before;
+  before = s21_alloc::AllocationCount();
+  A = C;
+  std::size_t other_size = s21_alloc::AllocationCount() - before;
+
+  // ASSERT
+  EXPECT_EQ(same_size, 0u);
+  EXPECT_EQ(other_size, 1u);
+  EXPECT_EQ(A == C, 1);
+  A = A;
+  EXPECT_EQ(A == C, 1);
+}
+
+TEST(AllocationTests, rvalue_operators_test) {
+  // ARRANGE
+  S21Matrix A = FilledMatrix(4, 4, 0), B = FilledMatrix(4, 4, 1);
+  S21Matrix result(4, 4);
+  S21Matrix expected = FilledMatrix(4, 4, 0).Transpose();
+  expected.SumMatrix(B);
+  expected.MulNumber(2);
+  expected.SubMatrix(A);
+
+  // ACT
+  S21Matrix transposed = A;
+  std::size_t before = s21_alloc::AllocationCount();
+  // every temporary gives its storage to the next step
+  result = (std::move(transposed).Transpose() + B) * 2 - A;
+  std::size_t count = s21_alloc::AllocationCount() - before;
+
+  // ASSERT
+  EXPECT_EQ(count, 0u);
+  EXPECT_EQ(result == expected, 1);
+  EXPECT_EQ(A - S21Matrix(A) == S21Matrix(4, 4), 1);
+  EXPECT_EQ(S21Matrix(A) - S21Matrix(A) == S21Matrix(4, 4), 1);
+  EXPECT_EQ(A + (A - B) * 0 + S21Matrix(B) == A + B, 1);
+  EXPECT_EQ(2 * S21Matrix(A) == A + A, 1);
+  // rectangular temporaries are transposed into a new matrix
+  EXPECT_EQ(FilledMatrix(2, 3, 0).Transpose() ==
+                static_cast<const S21Matrix &>(FilledMatrix(2, 3, 0))
+                    .Transpose(),
+            1);
+}
+
+TEST(AllocationTests, expression_update_loop_test) {
+  // ARRANGE
+  S21Matrix x = FilledMatrix(50, 50, 0), y = FilledMatrix(50, 50, 1);
+  S21Matrix z(50, 50);
+
+  // ACT
+  std::size_t before = s21_alloc::AllocationCount();
+  for (auto step = 0; step < 10; ++step) {
+    z = x * 0.5 + y - z;
+    y += z * 0.1;
+  }
+  std::size_t count = s21_alloc::AllocationCount() - before;
+
+  // ASSERT
+  EXPECT_EQ(count, 0u);
+}
@@ -0,0 +1,222 @@
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <type_traits>
+
+#include "s21_tests.h"
+
+namespace {
+
+template <class T>
+T Element(double re, double im) {
+  if constexpr (s21::IsComplex<T>::value)
+    return T(re, im);
+  else
+    return static_cast<T>(re);
+}
+
+// a diagonally dominant matrix, invertible for every order
+template <class T>
+S21BasicMatrix<T> Dominant(int n) {
+  S21BasicMatrix<T> result(n, n);
+  for (auto i = 0; i < n; ++i)
+    for (auto j = 0; j < n; ++j)
+      result.SetValue(i, j, i == j ? Element<T>(2.0 * n, 1)
+                                   : Element<T>(std::sin(i * 7.0 + j),
+                                                std::cos(i - 3.0 * j)));
+  return result;
+}
+
+template <class T>
+S21BasicMatrix<T> Filled(int rows, int cols, double phase) {
+  S21BasicMatrix<T> result(rows, cols);
+  for (auto i = 0; i < rows; ++i)
+    for (auto j = 0; j < cols; ++j)
+      result.SetValue(i, j, Element<T>(std::sin(phase + i * 0.7 + j),
+                                       std::cos(phase - i + 0.3 * j)));
+  return result;
+}
+
+template <class T>
+class BasicMatrixTests : public testing::Test {
+ protected:
+  // the bound of the rounding errors of sums of about 100 products
+  static constexpr double kTolerance =
+      std::is_same_v<T, float> ? 1e-4 : 1e-12;
+};
+
+using ElementTypes = testing::Types<float, std::complex<double>>;
+TYPED_TEST_SUITE(BasicMatrixTests, ElementTypes);
+
+}  // namespace
+
+TYPED_TEST(BasicMatrixTests, element_wise_test) {
+  // ARRANGE
+  using T = TypeParam;
+  const S21BasicMatrix<T> A = Filled<T>(5, 70, 0), B = Filled<T>(5, 70, 1);
+  const T k = Element<T>(1.5, -0.5);
+
+  // ACT
+  S21BasicMatrix<T> sum = A + B, difference = A - B, scaled = k * A;
+  S21BasicMatrix<T> axpy = A;
+  axpy.AxpyMatrix(k, B);
+  S21BasicMatrix<T> transposed = A.Transpose();
+
+  // ASSERT
+  EXPECT_EQ(sum.GetRows(), 5);
+  EXPECT_EQ(sum.GetCols(), 70);
+  for (auto i = 0; i < 5; ++i)
+    for (auto j = 0; j < 70; ++j) {
+      EXPECT_EQ(sum(i, j), A(i, j) + B(i, j));
+      EXPECT_EQ(difference(i, j), A(i, j) - B(i, j));
+      EXPECT_EQ(scaled(i, j), A(i, j) * k);
+      EXPECT_EQ(axpy(i, j), A(i, j) + k * B(i, j));
+      EXPECT_EQ(transposed(j, i), A(i, j));
+    }
+  EXPECT_TRUE(A * Element<T>(1, 0) == A);
+  EXPECT_FALSE(sum == A);
+  EXPECT_FALSE(A.EqMatrix(transposed));
+}
+
+TYPED_TEST(BasicMatrixTests, product_test) {
+  // ARRANGE
+  using T = TypeParam;
+  using W = typename S21BasicMatrix<T>::wide_type;
+  const S21BasicMatrix<T> A = Filled<T>(37, 100, 0), B = Filled<T>(100, 41, 1);
+
+  // ACT
+  const S21BasicMatrix<T> product = A * B;
+  S21BasicMatrix<T> wide = A;
+  wide.MulMatrix(B, s21::Accumulation::kWide);
+
+  // ASSERT
+  for (auto i = 0; i < 37; ++i)
+    for (auto j = 0; j < 41; ++j) {
+      W expected = 0;
+      for (auto p = 0; p < 100; ++p)
+        expected += static_cast<W>(A(i, p)) * static_cast<W>(B(p, j));
+      EXPECT_LT(std::abs(static_cast<W>(product(i, j)) - expected),
+                TestFixture::kTolerance);
+      // the wide sum is rounded once, at most by one unit of the last place
+      EXPECT_LE(std::abs(static_cast<W>(wide(i, j)) - expected),
+                std::abs(expected) * std::numeric_limits<float>::epsilon());
+    }
+}
+
+TYPED_TEST(BasicMatrixTests, inverse_test) {
+  // ARRANGE
+  using T = TypeParam;
+  const S21BasicMatrix<T> A = Dominant<T>(30);
+  S21BasicMatrix<T> B(3, 3);
+  const double values[3][3] = {{2, 5, 7}, {6, 3, 4}, {5, -2, -3}};
+  for (auto i = 0; i < 3; ++i)
+    for (auto j = 0; j < 3; ++j) B.SetValue(i, j, Element<T>(values[i][j], 0));
+
+  // ACT
+  const S21BasicMatrix<T> identity = A * A.InverseMatrix();
+  const S21BasicMatrix<T> complements = B.CalcComplements();
+
+  // ASSERT
+  for (auto i = 0; i < 30; ++i)
+    for (auto j = 0; j < 30; ++j)
+      EXPECT_LT(std::abs(identity(i, j) - Element<T>(i == j, 0)),
+                TestFixture::kTolerance);
+  EXPECT_LT(std::abs(B.Determinant() - -1.0), 1e-12);
+  const double expected[3][3] = {{-1, 38, -27}, {1, -41, 29}, {-1, 34, -24}};
+  for (auto i = 0; i < 3; ++i)
+    for (auto j = 0; j < 3; ++j)
+      EXPECT_LT(std::abs(complements(i, j) - Element<T>(expected[i][j], 0)),
+                1e-5);
+  EXPECT_TRUE(B.InverseMatrix().MinorMatrix(0, 0).GetRows() == 2);
+}
+
+TYPED_TEST(BasicMatrixTests, badly_scaled_test) {
+  // ARRANGE
+  // regular, although its smallest pivot is far below the largest element
+  using T = TypeParam;
+  S21BasicMatrix<T> A(4, 4);
+  const double diagonal[4] = {1e10, 1, 1, 1e-7};
+  for (auto i = 0; i < 4; ++i) A.SetValue(i, i, Element<T>(diagonal[i], 0));
+
+  // ACT
+  const S21BasicMatrix<T> inverse_mx = A.InverseMatrix();
+
+  // ASSERT
+  EXPECT_LT(std::abs(A.Determinant() - 1e3), 1e-3);
+  EXPECT_LT(std::abs(inverse_mx(3, 3) - Element<T>(1e7, 0)), 1);
+  EXPECT_LT(std::abs(A.CalcComplements()(0, 0) - Element<T>(1e-7, 0)),
+            1e-13);
+}
+
+TEST(BasicMatrixTests, conversion_test) {
+  // ARRANGE
+  S21Matrix A(2, 3);
+  A.SetValue(0, 0, 0.1);
+  A.SetValue(1, 2, -3);
+
+  // ACT
+  const S21BasicMatrix<float> single(A);
+  const S21Matrix widened(single);
+  const S21BasicMatrix<std::complex<double>> complex(single);
+
+  // ASSERT
+  static_assert(std::is_same_v<S21Matrix::value_type, double>);
+  static_assert(std::is_same_v<S21BasicMatrix<double>, S21Matrix>);
+  EXPECT_EQ(single(0, 0), 0.1f);
+  EXPECT_EQ(single(1, 2), -3);
+  EXPECT_EQ(widened(0, 0), static_cast<double>(0.1f));
+  EXPECT_EQ(widened.GetRows(), 2);
+  EXPECT_EQ(widened.GetCols(), 3);
+  EXPECT_EQ(complex(0, 0), std::complex<double>(0.1f, 0));
+}
+
+TEST(BasicMatrixTests, wide_accumulation_test) {
+  // ARRANGE
+  // 1e8 + 1 - 1e8 loses the 1 in single precision
+  S21BasicMatrix<float> row(1, 3), col(3, 1, std::pmr::new_delete_resource());
+  row.SetValue(0, 0, 1e8f);
+  row.SetValue(0, 1, 1);
+  row.SetValue(0, 2, -1e8f);
+  for (auto i = 0; i < 3; ++i) col.SetValue(i, 0, 1);
+  S21BasicMatrix<float> diagonal(3, 3);
+  for (auto i = 0; i < 3; ++i) diagonal.SetValue(i, i, 1e20f);
+
+  // ACT
+  S21BasicMatrix<float> element = row, wide = row;
+  element.MulMatrix(col);
+  wide.MulMatrix(col, s21::Accumulation::kWide);
+  const double det = diagonal.Determinant();
+
+  // ASSERT
+  EXPECT_EQ(element(0, 0), 0);
+  EXPECT_EQ(wide(0, 0), 1);
+  EXPECT_NEAR(det / 1e60, 1, 1e-6);
+}
+
+TEST(BasicMatrixTests, errors_test) {
+  // ARRANGE
+  S21BasicMatrix<float> A(2, 3), B(3, 3), singular(2, 2);
+  A.SetValue(1, 2, 5);
+
+  // ACT
+  A.SetRows(3);
+  A.SetCols(2);
+
+  // ASSERT
+  EXPECT_EQ(A.GetRows(), 3);
+  EXPECT_EQ(A(1, 1), 0);
+  EXPECT_THROW(A.SetValue(1, 2, 5), std::out_of_range);
+  EXPECT_THROW(A.GetValue(-1, 0), std::out_of_range);
+  EXPECT_THROW(A.SetRows(0), std::out_of_range);
+  EXPECT_THROW(A.SumMatrix(B), std::invalid_argument);
+  EXPECT_THROW(A.MulMatrix(A), std::invalid_argument);
+  EXPECT_THROW(A.Determinant(), std::invalid_argument);
+  EXPECT_THROW(singular.InverseMatrix(), std::invalid_argument);
+  EXPECT_EQ(singular.Determinant(), 0);
+  EXPECT_THROW(S21BasicMatrix<float>(0, 1), std::invalid_argument);
+  S21BasicMatrix<float> moved = std::move(B);
+  EXPECT_EQ(moved.GetRows(), 3);
+  EXPECT_EQ(B.GetRows(), 0);
+  B = moved;
+  EXPECT_TRUE(B == moved);
+}
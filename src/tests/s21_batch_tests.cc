@@ -0,0 +1,199 @@
+#include <cmath>
+#include <vector>
+
+#include "s21_tests.h"
+
+namespace {
+
+// diagonally dominant matrices that differ between the items
+S21Matrix ItemMatrix(int item, int rows, int cols) {
+  S21Matrix result(rows, cols);
+  for (auto i = 0; i < rows; ++i)
+    for (auto j = 0; j < cols; ++j)
+      result.SetValue(i, j,
+                      i == j ? 2.0 * cols + item
+                             : std::sin(item * 3.0 + i * 7.0 + j));
+  return result;
+}
+
+std::vector<S21Matrix> ItemMatrices(int count, int rows, int cols) {
+  std::vector<S21Matrix> result;
+  for (auto item = 0; item < count; ++item)
+    result.push_back(ItemMatrix(item, rows, cols));
+  return result;
+}
+
+}  // namespace
+
+TEST(BatchTests, layout_test) {
+  // ARRANGE
+  std::vector<S21Matrix> matrices = ItemMatrices(11, 2, 3);
+
+  // ACT
+  S21MatrixBatch batch(matrices);
+  batch.SetValue(10, 1, 2, -5);
+  S21MatrixBatch copy(batch), moved(std::move(copy));
+
+  // ASSERT
+  EXPECT_EQ(batch.GetCount(), 11);
+  EXPECT_EQ(batch.GetRows(), 2);
+  EXPECT_EQ(batch.GetCols(), 3);
+  EXPECT_EQ(batch.GetValue(3, 1, 0), matrices[3](1, 0));
+  EXPECT_EQ(batch.GetValue(10, 1, 2), -5);
+  EXPECT_TRUE(batch.GetMatrix(7).EqMatrix(matrices[7]));
+  EXPECT_TRUE(moved.EqMatrix(batch));
+  EXPECT_EQ(copy.GetCount(), 0);
+  EXPECT_TRUE(S21MatrixBatch(0, 2, 2).EqMatrix(S21MatrixBatch(0, 2, 2)));
+  EXPECT_THROW(S21MatrixBatch(-1, 2, 2), std::invalid_argument);
+  EXPECT_THROW(S21MatrixBatch(1, 0, 2), std::invalid_argument);
+  EXPECT_THROW(batch.GetValue(11, 0, 0), std::out_of_range);
+  EXPECT_THROW(batch.SetValue(0, 2, 0, 1), std::out_of_range);
+  EXPECT_THROW(batch.GetMatrix(-1), std::out_of_range);
+  EXPECT_THROW(batch.SetMatrix(0, S21Matrix(3, 2)), std::invalid_argument);
+  EXPECT_THROW(S21MatrixBatch(std::vector<S21Matrix>{S21Matrix(2, 2),
+                                                     S21Matrix(2, 3)}),
+               std::invalid_argument);
+}
+
+TEST(BatchTests, assignment_test) {
+  // ARRANGE
+  S21MatrixBatch batch(ItemMatrices(9, 3, 3)), other(2, 4, 4);
+  S21MatrixBatch same(ItemMatrices(16, 3, 3));
+
+  // ACT
+  other = batch;
+  same = batch;
+  S21MatrixBatch moved;
+  moved = std::move(other);
+
+  // ASSERT
+  EXPECT_TRUE(same.EqMatrix(batch));
+  EXPECT_TRUE(moved.EqMatrix(batch));
+  EXPECT_EQ(other.GetCount(), 0);
+  EXPECT_FALSE(batch.EqMatrix(S21MatrixBatch(9, 3, 3)));
+  EXPECT_FALSE(batch.EqMatrix(S21MatrixBatch(ItemMatrices(10, 3, 3))));
+}
+
+TEST(BatchTests, elementwise_test) {
+  // ARRANGE
+  const int count = 13;
+  S21MatrixBatch a(ItemMatrices(count, 5, 4));
+  S21MatrixBatch b(ItemMatrices(count, 5, 4));
+  b.MulNumber(0.5);
+
+  // ACT
+  S21MatrixBatch sum(a), difference(a);
+  sum.SumMatrix(b);
+  difference.SubMatrix(b);
+
+  // ASSERT
+  for (auto item = 0; item < count; ++item) {
+    S21Matrix expected_sum = a.GetMatrix(item), expected_difference =
+                                                    a.GetMatrix(item);
+    expected_sum.SumMatrix(b.GetMatrix(item));
+    expected_difference.SubMatrix(b.GetMatrix(item));
+    EXPECT_TRUE(sum.GetMatrix(item).EqMatrix(expected_sum));
+    EXPECT_TRUE(difference.GetMatrix(item).EqMatrix(expected_difference));
+  }
+  EXPECT_THROW(sum.SumMatrix(S21MatrixBatch(count, 4, 5)),
+               std::invalid_argument);
+  EXPECT_THROW(sum.SubMatrix(S21MatrixBatch(count + 1, 5, 4)),
+               std::invalid_argument);
+}
+
+TEST(BatchTests, mul_matrix_test) {
+  // ARRANGE
+  // a partial pack, a full one and enough packs for the thread pool
+  const int shapes[][4] = {
+      {5, 4, 4, 4}, {8, 3, 5, 2}, {19, 16, 16, 16}, {2000, 4, 4, 4}};
+  for (auto &shape : shapes) {
+    const int count = shape[0];
+    S21MatrixBatch a(ItemMatrices(count, shape[1], shape[2]));
+    S21MatrixBatch b(ItemMatrices(count, shape[2], shape[3]));
+
+    // ACT
+    S21MatrixBatch product(a);
+    product.MulMatrix(b);
+
+    // ASSERT
+    ASSERT_EQ(product.GetRows(), shape[1]);
+    ASSERT_EQ(product.GetCols(), shape[3]);
+    for (auto item = 0; item < count; ++item) {
+      S21Matrix expected = a.GetMatrix(item);
+      expected.MulMatrix(b.GetMatrix(item));
+      ExpectNear(product.GetMatrix(item), expected, 1e-12);
+    }
+  }
+  S21MatrixBatch a(3, 2, 3);
+  EXPECT_THROW(a.MulMatrix(S21MatrixBatch(3, 2, 3)), std::invalid_argument);
+  EXPECT_THROW(a.MulMatrix(S21MatrixBatch(4, 3, 3)), std::invalid_argument);
+}
+
+TEST(BatchTests, determinant_test) {
+  // ARRANGE
+  const int count = 21;
+  for (auto order : {1, 3, 4, 9, 32}) {
+    std::vector<S21Matrix> matrices = ItemMatrices(count, order, order);
+    // a pivot is needed in some of the lanes only
+    matrices[2].SetValue(0, 0, 0);
+    S21MatrixBatch batch(matrices);
+
+    // ACT
+    std::vector<double> det = batch.Determinant();
+
+    // ASSERT
+    ASSERT_EQ(det.size(), static_cast<std::size_t>(count));
+    for (auto item = 0; item < count; ++item) {
+      double expected = matrices[item].Determinant();
+      EXPECT_NEAR(det[item], expected, std::fabs(expected) * 1e-12);
+    }
+  }
+  EXPECT_THROW(S21MatrixBatch(2, 2, 3).Determinant(), std::invalid_argument);
+}
+
+TEST(BatchTests, singular_test) {
+  // ARRANGE
+  std::vector<S21Matrix> matrices = ItemMatrices(10, 3, 3);
+  // the last row repeats the first one
+  for (auto j = 0; j < 3; ++j) matrices[9].SetValue(2, j, matrices[9](0, j));
+  // regular, but its pivots are far apart in scale
+  matrices[8] = S21Matrix(3, 3);
+  matrices[8].SetValue(0, 0, 1e10);
+  matrices[8].SetValue(1, 1, 1);
+  matrices[8].SetValue(2, 2, 1e-7);
+  S21MatrixBatch batch(matrices);
+  matrices.pop_back();
+  S21MatrixBatch regular(matrices);
+
+  // ACT
+  std::vector<double> det = batch.Determinant();
+  S21MatrixBatch inverse = regular.InverseMatrix();
+
+  // ASSERT
+  EXPECT_EQ(det[9], 0);
+  EXPECT_DOUBLE_EQ(det[8], 1e3);
+  EXPECT_DOUBLE_EQ(inverse.GetMatrix(8)(2, 2), 1e7);
+  EXPECT_THROW(batch.InverseMatrix(), std::invalid_argument);
+}
+
+TEST(BatchTests, inverse_matrix_test) {
+  // ARRANGE
+  for (auto order : {1, 2, 4, 7, 16, 32}) {
+    const int count = 2 * S21MatrixBatch::kLanes + 3;
+    std::vector<S21Matrix> matrices = ItemMatrices(count, order, order);
+    if (order > 1) matrices[4].SetValue(0, 0, 0);
+    S21MatrixBatch batch(matrices);
+
+    // ACT
+    S21MatrixBatch inverse = batch.InverseMatrix();
+
+    // ASSERT
+    for (auto item = 0; item < count; ++item) {
+      S21Matrix identity = inverse.GetMatrix(item) * matrices[item];
+      S21Matrix expected(order, order);
+      for (auto i = 0; i < order; ++i) expected.SetValue(i, i, 1);
+      ExpectNear(identity, expected, 1e-12);
+    }
+  }
+  EXPECT_THROW(S21MatrixBatch(2, 3, 2).InverseMatrix(), std::invalid_argument);
+}
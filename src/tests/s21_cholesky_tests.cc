@@ -0,0 +1,111 @@
+#include "s21_tests.h"
+
+namespace {
+
+// a symmetric positive definite matrix: M^T * M plus n on the diagonal
+S21Matrix SpdMatrix(int n) {
+  S21Matrix m(n, n);
+  for (auto i = 0; i < n; ++i)
+    for (auto j = 0; j < n; ++j) m.SetValue(i, j, std::sin(i * 3.0 + j));
+  S21Matrix result = m.Transpose() * m;
+  for (auto i = 0; i < n; ++i) result.SetValue(i, i, result(i, i) + n);
+  return result;
+}
+
+}  // namespace
+
+TEST(CholeskyTests, factor_test) {
+  // ARRANGE
+  // more than two panels of the blocked factorization
+  const int n = 150;
+  S21Matrix A = SpdMatrix(n);
+  S21Matrix B(2, 2);
+  B.SetValue(0, 0, 4);
+  B.SetValue(0, 1, 2);
+  B.SetValue(1, 0, 2);
+  B.SetValue(1, 1, 3);
+
+  // ACT
+  S21CholeskyDecomposition cholesky(A);
+  const S21Matrix &L = cholesky.GetFactor();
+  S21Matrix product = L * L.Transpose();
+
+  // ASSERT
+  EXPECT_TRUE(cholesky.IsPositiveDefinite());
+  EXPECT_EQ(cholesky.GetSize(), n);
+  for (auto i = 0; i < n; ++i)
+    for (auto j = 0; j < n; ++j) {
+      EXPECT_NEAR(product(i, j), A(i, j), 1e-10 * n);
+      if (j > i) {
+        EXPECT_EQ(L(i, j), 0);
+      }
+    }
+  EXPECT_NEAR(S21CholeskyDecomposition(B).Determinant(), 8, 1e-12);
+  EXPECT_NEAR(S21CholeskyDecomposition(SpdMatrix(10)).Determinant() /
+                  SpdMatrix(10).Determinant(),
+              1, 1e-12);
+  EXPECT_THROW(S21CholeskyDecomposition(S21Matrix(2, 3)),
+               std::invalid_argument);
+}
+
+TEST(CholeskyTests, solve_test) {
+  // ARRANGE
+  const int n = 90;
+  S21Matrix A = SpdMatrix(n);
+  S21Matrix X(n, 20);
+  for (auto i = 0; i < n; ++i)
+    for (auto j = 0; j < 20; ++j) X.SetValue(i, j, i - 2.5 * j);
+  S21Matrix B = A * X;
+
+  // ACT
+  S21CholeskyDecomposition cholesky(A);
+  S21Matrix solution = cholesky.Solve(B);
+  S21Matrix identity = A * cholesky.InverseMatrix();
+
+  // ASSERT
+  for (auto i = 0; i < n; ++i) {
+    for (auto j = 0; j < 20; ++j)
+      EXPECT_NEAR(solution(i, j), X(i, j), 1e-9);
+    for (auto j = 0; j < n; ++j)
+      EXPECT_NEAR(identity(i, j), i == j ? 1 : 0, 1e-12);
+  }
+  EXPECT_THROW(cholesky.Solve(S21Matrix(n + 1, 1)), std::invalid_argument);
+}
+
+TEST(CholeskyTests, not_positive_definite_test) {
+  // ARRANGE
+  S21Matrix A(2, 2);
+  A.SetValue(0, 0, 1);
+  A.SetValue(0, 1, 2);
+  A.SetValue(1, 0, 2);
+  A.SetValue(1, 1, 1);
+  // the failing pivot is in the second panel
+  S21Matrix B = SpdMatrix(100);
+  B.SetValue(80, 80, -1);
+
+  // ACT
+  S21CholeskyDecomposition cholesky(A);
+
+  // ASSERT
+  EXPECT_FALSE(cholesky.IsPositiveDefinite());
+  EXPECT_FALSE(S21CholeskyDecomposition(B).IsPositiveDefinite());
+  EXPECT_EQ(cholesky.Determinant(), 0);
+  EXPECT_THROW(cholesky.Solve(S21Matrix(2, 1)), std::invalid_argument);
+  EXPECT_THROW(cholesky.InverseMatrix(), std::invalid_argument);
+}
+
+TEST(CholeskyTests, badly_scaled_test) {
+  // ARRANGE
+  // positive definite, although its pivots are far apart in scale
+  S21Matrix A(2, 2);
+  A.SetValue(0, 0, 1e10);
+  A.SetValue(1, 1, 1e-7);
+
+  // ACT
+  S21CholeskyDecomposition cholesky(A);
+
+  // ASSERT
+  EXPECT_TRUE(cholesky.IsPositiveDefinite());
+  EXPECT_DOUBLE_EQ(cholesky.Determinant(), 1e3);
+  EXPECT_DOUBLE_EQ(cholesky.InverseMatrix()(1, 1), 1e7);
+}
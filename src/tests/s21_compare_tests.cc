@@ -0,0 +1,76 @@
+#include <cmath>
+#include <limits>
+
+#include "s21_tests.h"
+
+TEST(CompareTests, tolerance_test) {
+  // ARRANGE
+  const S21Matrix A = WaveMatrix(300, 301);
+  S21Matrix B = A, C = A, D = A;
+  B(299, 300) += 1e-9;
+  C(150, 7) = std::nextafter(std::nextafter(A(150, 7), 2.0), 2.0);
+  D(0, 0) = 1000 * (1 + 1e-12), D(0, 1) = 1000;
+  S21Matrix E = D;
+  E(0, 1) = 1000 * (1 - 1e-12);
+
+  // ACT & ASSERT
+  EXPECT_FALSE(A.EqMatrix(B));
+  EXPECT_TRUE(A.EqMatrix(B, s21::Tolerance::Absolute(1e-8)));
+  EXPECT_FALSE(A.EqMatrix(B, s21::Tolerance::Absolute(1e-10)));
+  EXPECT_FALSE(A.EqMatrix(C));
+  EXPECT_TRUE(A.EqMatrix(C, s21::Tolerance::Ulps(2)));
+  EXPECT_FALSE(A.EqMatrix(C, s21::Tolerance::Ulps(1)));
+  EXPECT_TRUE(D.EqMatrix(E, s21::Tolerance::Relative(1e-11)));
+  EXPECT_FALSE(D.EqMatrix(E, s21::Tolerance::Relative(1e-13)));
+  EXPECT_FALSE(D.EqMatrix(E, s21::Tolerance::Absolute(1e-13)));
+  EXPECT_TRUE(D.EqMatrix(E, {1e-13, 1e-11, 0}));
+  EXPECT_FALSE(A.EqMatrix(S21Matrix(300, 300), s21::Tolerance::Absolute(1)));
+}
+
+TEST(CompareTests, special_values_test) {
+  // ARRANGE
+  const double inf = std::numeric_limits<double>::infinity();
+  S21Matrix A(2, 5), B(2, 5);
+  A(0, 0) = B(0, 0) = inf;
+  A(0, 1) = 0.0, B(0, 1) = -0.0;
+  A(0, 2) = std::numeric_limits<double>::denorm_min(), B(0, 2) = -A(0, 2);
+
+  // ACT & ASSERT
+  // the smallest subnormals of both signs are two doubles apart
+  EXPECT_TRUE(A.EqMatrix(B, s21::Tolerance::Ulps(2)));
+  EXPECT_FALSE(A.EqMatrix(B, s21::Tolerance::Ulps(1)));
+  // a finite value is never near an infinite one, the largest one is a
+  // double away from it
+  B(0, 0) = std::numeric_limits<double>::max();
+  EXPECT_FALSE(A.EqMatrix(B, s21::Tolerance::Relative(1)));
+  EXPECT_TRUE(A.EqMatrix(B, s21::Tolerance::Ulps(3)));
+  // NaN matches nothing, not even itself
+  A(1, 4) = B(1, 4) = std::nan("");
+  EXPECT_FALSE(A.EqMatrix(B, {inf, inf, 1 << 20}));
+  EXPECT_FALSE(A.EqMatrix(A));
+}
+
+TEST(CompareTests, max_difference_test) {
+  // ARRANGE
+  const S21Matrix A = WaveMatrix(300, 301);
+  S21Matrix B = A, C = A;
+  B(10, 20) += 0.5, B(250, 3) -= 0.5, B(100, 300) += 0.25;
+  C(200, 200) = std::nan(""), C(280, 0) = std::nan("");
+
+  // ACT
+  const s21::Extremum same = A.MaxDifference(A);
+  const s21::Extremum max = A.MaxDifference(B);
+  const s21::Extremum nan = A.MaxDifference(C);
+
+  // ASSERT
+  EXPECT_EQ(same.value, 0);
+  EXPECT_EQ(same.row, 0);
+  EXPECT_EQ(same.col, 0);
+  EXPECT_DOUBLE_EQ(max.value, 0.5);
+  EXPECT_EQ(max.row, 10);
+  EXPECT_EQ(max.col, 20);
+  EXPECT_TRUE(std::isnan(nan.value));
+  EXPECT_EQ(nan.row, 200);
+  EXPECT_EQ(nan.col, 200);
+  EXPECT_THROW(A.MaxDifference(S21Matrix(3, 3)), std::invalid_argument);
+}
@@ -0,0 +1,116 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <execution>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#include "s21_tests.h"
+
+TEST(ExecutionTests, policy_operations_test) {
+  // ARRANGE
+  const int threads = s21::GetNumThreads();
+  s21::SetNumThreads(4);
+  const S21Matrix A = WaveMatrix(300, 290, 0), B = WaveMatrix(300, 290, 1);
+  S21Matrix expected = A;
+  expected.SumMatrix(B);
+  expected.MulNumber(0.5);
+  expected.SubMatrix(A);
+
+  // ACT
+  S21Matrix sequenced = A, parallel = A, unsequenced = A, runtime = A;
+  sequenced.SumMatrix(std::execution::seq, B);
+  sequenced.MulNumber(std::execution::seq, 0.5);
+  sequenced.SubMatrix(std::execution::seq, A);
+  parallel.SumMatrix(std::execution::par, B);
+  parallel.MulNumber(std::execution::par, 0.5);
+  parallel.SubMatrix(std::execution::par, A);
+  unsequenced.SumMatrix(std::execution::par_unseq, B);
+  unsequenced.MulNumber(std::execution::par_unseq, 0.5);
+  unsequenced.SubMatrix(std::execution::par_unseq, A);
+  runtime.SumMatrix(s21::Execution::kParallel, B);
+  runtime.MulNumber(s21::Execution::kSequenced, 0.5);
+  runtime.SubMatrix(s21::Execution::kParallelUnsequenced, A);
+
+  // ASSERT
+  EXPECT_TRUE(sequenced.EqMatrix(std::execution::seq, expected));
+  EXPECT_TRUE(parallel.EqMatrix(std::execution::par, expected));
+  EXPECT_TRUE(unsequenced.EqMatrix(std::execution::par_unseq, expected));
+  EXPECT_TRUE(runtime.EqMatrix(s21::Execution::kParallel, expected));
+  EXPECT_FALSE(A.EqMatrix(std::execution::par, B));
+  EXPECT_TRUE(A.Transpose(std::execution::par) == A.Transpose());
+  EXPECT_TRUE(A.Transpose(s21::Execution::kSequenced) == A.Transpose());
+  EXPECT_THROW(runtime.SumMatrix(std::execution::par, S21Matrix(2, 2)),
+               std::invalid_argument);
+
+  s21::SetNumThreads(threads);
+}
+
+TEST(ExecutionTests, sequenced_thread_test) {
+  // ARRANGE
+  const int threads = s21::GetNumThreads();
+  s21::SetNumThreads(4);
+  S21Matrix A = WaveMatrix(400, 300, 0);
+  std::mutex mutex;
+  std::set<std::thread::id> callers;
+  auto record = [&](double x) {
+    std::lock_guard<std::mutex> lock(mutex);
+    callers.insert(std::this_thread::get_id());
+    return x;
+  };
+
+  // ACT
+  A.Apply(record);
+  A.Apply(std::execution::seq, record);
+  const S21Matrix transposed = A.Transpose(std::execution::seq);
+  std::atomic<int> scoped_calls{0}, calls{0};
+  {
+    s21::ExecutionScope scope(s21::Execution::kSequenced);
+    s21::ParallelFor(1000, 1, [&](std::ptrdiff_t, std::ptrdiff_t) {
+      ++scoped_calls;
+    });
+  }
+  s21::ParallelFor(1000, 1, [&](std::ptrdiff_t, std::ptrdiff_t) { ++calls; });
+
+  // ASSERT
+  EXPECT_EQ(callers, std::set<std::thread::id>{std::this_thread::get_id()});
+  EXPECT_EQ(transposed(7, 9), A(9, 7));
+  // the loops are split again once the scope ends
+  EXPECT_EQ(scoped_calls, 1);
+  EXPECT_GT(calls, 1);
+
+  s21::SetNumThreads(threads);
+}
+
+TEST(ExecutionTests, apply_zip_test) {
+  // ARRANGE
+  const S21Matrix A = WaveMatrix(300, 301, 0), mask = WaveMatrix(300, 301, 2);
+  S21Matrix clamped = A, sigmoid = A, masked = A;
+  S21BasicMatrix<float> F(3, 37);
+  F.Apply([](float) { return 2.0f; });
+
+  // ACT
+  clamped.Apply(std::execution::par,
+                [](double x) { return std::clamp(x, -0.5, 0.5); });
+  sigmoid.Apply(std::execution::par_unseq,
+                [](double x) { return 1 / (1 + std::exp(-x)); });
+  masked.Zip(s21::Execution::kParallel, mask,
+             [](double x, double m) { return m > 0 ? x : 0.0; });
+  F.Zip(std::execution::seq, F, [](float x, float y) { return x * y; });
+
+  // ASSERT
+  for (auto i = 0; i < A.GetRows(); ++i)
+    for (auto j = 0; j < A.GetCols(); ++j) {
+      EXPECT_EQ(clamped(i, j), std::clamp(A(i, j), -0.5, 0.5));
+      EXPECT_EQ(sigmoid(i, j), 1 / (1 + std::exp(-A(i, j))));
+      EXPECT_EQ(masked(i, j), mask(i, j) > 0 ? A(i, j) : 0.0);
+    }
+  EXPECT_EQ(std::count(F.cbegin(), F.cend(), 4.0f), 3 * 37);
+  EXPECT_THROW(masked.Zip(std::execution::par, S21Matrix(300, 300),
+                          [](double x, double) { return x; }),
+               std::invalid_argument);
+  EXPECT_THROW(F.Zip(S21BasicMatrix<float>(2, 2),
+                     [](float x, float) { return x; }),
+               std::invalid_argument);
+}
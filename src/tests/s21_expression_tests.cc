@@ -0,0 +1,101 @@
+#include "s21_tests.h"
+
+TEST(ExpressionTests, chained_expression_test) {
+  // ARRANGE
+  S21Matrix A = FilledMatrix(3, 4, 0), B = FilledMatrix(3, 4, 1),
+            C = FilledMatrix(3, 4, 2);
+
+  // ACT
+  S21Matrix D = A + B - C * 2;
+  S21Matrix E = 0.5 * (A + A) - (B - C);
+
+  // ASSERT
+  for (auto i = 0; i < 3; ++i)
+    for (auto j = 0; j < 4; ++j) {
+      double a = A(i, j), b = B(i, j), c = C(i, j);
+      EXPECT_EQ(D(i, j), a + b - c * 2);
+      EXPECT_EQ(E(i, j), a - (b - c));
+    }
+  EXPECT_THROW(S21Matrix(A + S21Matrix(4, 3)), std::invalid_argument);
+  EXPECT_THROW(S21Matrix(A - B * S21Matrix(3, 3)), std::invalid_argument);
+}
+
+TEST(ExpressionTests, aliasing_assign_test) {
+  // ARRANGE
+  S21Matrix A = FilledMatrix(2, 3, 0), B = FilledMatrix(2, 3, 5);
+  S21Matrix expected = FilledMatrix(2, 3, 0);
+  expected.MulNumber(3);
+  expected.SumMatrix(B);
+
+  // ACT
+  // the destination is an operand of the expression
+  A = A * 3 + B;
+  S21Matrix C(7, 7);
+  C = A - B;
+
+  // ASSERT
+  EXPECT_EQ(A == expected, 1);
+  EXPECT_EQ(C.GetRows(), 2);
+  EXPECT_EQ(C.GetCols(), 3);
+  A += C * 2 - C;
+  A -= C;
+  EXPECT_EQ(A == expected, 1);
+  EXPECT_THROW(A += S21Matrix(3, 3) * 2, std::invalid_argument);
+}
+
+TEST(ExpressionTests, product_expression_test) {
+  // ARRANGE
+  std::vector<double> vec1{1, 2, 3, 4, 5, 6};
+  std::vector<double> vec2{1, 2, 3, 4, 5, 6, 7, 8};
+  std::vector<double> res{11, 14, 17, 20, 23, 30, 37, 44, 35, 46, 57, 68};
+
+  std::unique_ptr<VectorsMatrixBuilder> builder{
+      std::make_unique<VectorsMatrixBuilder>(VectorsMatrixBuilder())};
+
+  std::unique_ptr<S21Matrix> A = builder->CreateMatrix(3, 2);
+  builder->FillMatrix(vec1, A);
+  std::unique_ptr<S21Matrix> B = builder->CreateMatrix(2, 4);
+  builder->FillMatrix(vec2, B);
+  std::unique_ptr<S21Matrix> C = builder->CreateMatrix(3, 4);
+  builder->FillMatrix(res, C);
+
+  // ACT
+  S21Matrix D = *A * *B;
+  // the operands of the product are expressions themselves
+  S21Matrix E = (*A + *A) * (*B * 0.5);
+  // the product is an operand of an element-wise expression
+  S21Matrix F = *A * *B - *C;
+  // a named product is copied, not moved from
+  auto product = *A * *B;
+  S21Matrix G = product;
+  S21Matrix H = product;
+  // a product of products
+  S21Matrix I = (*A * *B) * (S21Matrix(4, 4) * 0);
+
+  // ASSERT
+  EXPECT_EQ(D == *C, 1);
+  EXPECT_EQ(E == *C, 1);
+  EXPECT_EQ(F == S21Matrix(3, 4), 1);
+  EXPECT_EQ(G == *C, 1);
+  EXPECT_EQ(H == *C, 1);
+  EXPECT_EQ(I == S21Matrix(3, 4), 1);
+
+  A.reset();
+  B.reset();
+  C.reset();
+  builder.reset();
+}
+
+TEST(ExpressionTests, large_expression_test) {
+  // ARRANGE
+  // large enough to be evaluated on the thread pool
+  S21Matrix A = FilledMatrix(300, 300, 0), B = FilledMatrix(300, 300, 1);
+
+  // ACT
+  S21Matrix C = A - B + A * 0.25;
+
+  // ASSERT
+  for (auto i = 0; i < 300; i += 7)
+    for (auto j = 0; j < 300; j += 11)
+      EXPECT_EQ(C(i, j), -1 + A(i, j) * 0.25);
+}
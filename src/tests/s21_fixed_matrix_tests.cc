@@ -0,0 +1,135 @@
+#include <type_traits>
+
+#include "s21_tests.h"
+
+namespace {
+
+// a diagonally dominant matrix, invertible for every order
+template <int N>
+S21FixedMatrix<N, N> DominantFixed() {
+  S21FixedMatrix<N, N> result;
+  for (auto i = 0; i < N; ++i)
+    for (auto j = 0; j < N; ++j)
+      result.SetValue(i, j, i == j ? 2.0 * N : std::sin(i * 7.0 + j));
+  return result;
+}
+
+template <int N>
+void ExpectIdentity(const S21FixedMatrix<N, N> &matrix) {
+  for (auto i = 0; i < N; ++i)
+    for (auto j = 0; j < N; ++j)
+      EXPECT_NEAR(matrix(i, j), i == j ? 1 : 0, 1e-12);
+}
+
+}  // namespace
+
+TEST(FixedMatrixTests, constructor_test) {
+  // ARRANGE
+  constexpr S21FixedMatrix<2, 3> A{1, 2, 3, 4};
+  constexpr S21FixedMatrix<3, 3> I = S21FixedMatrix<3, 3>::Identity();
+
+  // ASSERT
+  static_assert(A.GetRows() == 2 && A.GetCols() == 3);
+  static_assert(A(1, 0) == 4 && A(1, 2) == 0);
+  static_assert(I(2, 2) == 1 && I(0, 2) == 0);
+  EXPECT_THROW((S21FixedMatrix<1, 2>{1, 2, 3}), std::invalid_argument);
+  EXPECT_THROW(A(2, 0), std::out_of_range);
+  EXPECT_THROW(A.GetValue(0, -1), std::out_of_range);
+}
+
+TEST(FixedMatrixTests, arithmetic_test) {
+  // ARRANGE
+  S21FixedMatrix<2, 3> A{1, 2, 3, 4, 5, 6}, B{6, 5, 4, 3, 2, 1};
+  S21FixedMatrix<3, 2> C{1, 0, 0, 1, 1, 1};
+
+  // ACT
+  auto sum = A + B;
+  auto difference = A - B;
+  auto scaled = 2 * A * 0.5;
+  S21FixedMatrix<2, 2> product = A * C;
+  static_assert(std::is_same_v<decltype(C * A), S21FixedMatrix<3, 3>>);
+
+  // ASSERT
+  EXPECT_TRUE(sum == (S21FixedMatrix<2, 3>{7, 7, 7, 7, 7, 7}));
+  EXPECT_TRUE(difference == (S21FixedMatrix<2, 3>{-5, -3, -1, 1, 3, 5}));
+  EXPECT_TRUE(scaled == A);
+  EXPECT_TRUE(product == (S21FixedMatrix<2, 2>{4, 5, 10, 11}));
+  EXPECT_TRUE(A.Transpose() == (S21FixedMatrix<3, 2>{1, 4, 2, 5, 3, 6}));
+  A += B;
+  A -= B;
+  A *= S21FixedMatrix<3, 3>::Identity();
+  A *= 3;
+  EXPECT_EQ(A(1, 2), 18);
+}
+
+TEST(FixedMatrixTests, determinant_test) {
+  // ARRANGE
+  S21FixedMatrix<1, 1> A{-4};
+  S21FixedMatrix<2, 2> B{1, 2, 3, 4};
+  S21FixedMatrix<3, 3> C{2, 5, 7, 6, 3, 4, 5, -2, -3};
+  S21FixedMatrix<4, 4> D{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 1, 1, 1, 2};
+  S21FixedMatrix<3, 3> singular{1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  // ASSERT
+  EXPECT_EQ(A.Determinant(), -4);
+  EXPECT_EQ(B.Determinant(), -2);
+  EXPECT_EQ(C.Determinant(), -1);
+  EXPECT_NEAR(D.Determinant(), 0, 1e-12);
+  EXPECT_EQ(singular.Determinant(), 0);
+  EXPECT_THROW(singular.InverseMatrix(), std::invalid_argument);
+  EXPECT_THROW(D.InverseMatrix(), std::invalid_argument);
+}
+
+TEST(FixedMatrixTests, same_as_dynamic_test) {
+  // ARRANGE
+  S21FixedMatrix<6, 6> A = DominantFixed<6>();
+  S21Matrix dynamic(A);
+
+  // ACT
+  S21Matrix complements(A.CalcComplements());
+  S21Matrix minor(A.MinorMatrix(2, 3));
+
+  // ASSERT
+  EXPECT_NEAR(A.Determinant(), dynamic.Determinant(), 1e-6);
+  EXPECT_TRUE(minor == dynamic.MinorMatrix(2, 3));
+  S21Matrix expected = dynamic.CalcComplements();
+  for (auto i = 0; i < 6; ++i)
+    for (auto j = 0; j < 6; ++j)
+      EXPECT_NEAR(complements(i, j), expected(i, j), 1e-6);
+}
+
+TEST(FixedMatrixTests, inverse_test) {
+  // ARRANGE
+  auto A1 = DominantFixed<1>();
+  auto A2 = DominantFixed<2>();
+  auto A3 = DominantFixed<3>();
+  auto A4 = DominantFixed<4>();
+  auto A7 = DominantFixed<7>();
+
+  // ASSERT
+  ExpectIdentity(A1 * A1.InverseMatrix());
+  ExpectIdentity(A2 * A2.InverseMatrix());
+  ExpectIdentity(A3 * A3.InverseMatrix());
+  ExpectIdentity(A4 * A4.InverseMatrix());
+  ExpectIdentity(A7 * A7.InverseMatrix());
+  EXPECT_EQ(A1.CalcComplements()(0, 0), 1);
+}
+
+TEST(FixedMatrixTests, conversion_test) {
+  // ARRANGE
+  S21Matrix dynamic(2, 3);
+  dynamic.SetValue(1, 2, 7);
+
+  // ACT
+  S21FixedMatrix<2, 3> fixed(dynamic);
+  fixed.SetValue(0, 0, 1);
+  S21Matrix back(fixed);
+
+  // ASSERT
+  EXPECT_EQ(fixed(1, 2), 7);
+  EXPECT_EQ(back.GetRows(), 2);
+  EXPECT_EQ(back.GetCols(), 3);
+  EXPECT_EQ(back(0, 0), 1);
+  EXPECT_EQ(back(1, 2), 7);
+  EXPECT_THROW((S21FixedMatrix<3, 2>(dynamic)), std::invalid_argument);
+}
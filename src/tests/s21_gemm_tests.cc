@@ -0,0 +1,58 @@
+#include "s21_tests.h"
+
+namespace {
+
+// the textbook triple loop
+S21Matrix NaiveProduct(const S21Matrix &a, const S21Matrix &b) {
+  S21Matrix result(a.GetRows(), b.GetCols());
+  for (auto i = 0; i < a.GetRows(); ++i)
+    for (auto j = 0; j < b.GetCols(); ++j) {
+      double sum = 0;
+      for (auto k = 0; k < a.GetCols(); ++k)
+        sum += a.GetValue(i, k) * b.GetValue(k, j);
+      result.SetValue(i, j, sum);
+    }
+  return result;
+}
+
+}  // namespace
+
+TEST(GemmTests, blocked_product_test) {
+  // ARRANGE
+  // the shapes cover partial register tiles and more than one block of the
+  // shared dimension and of the rows
+  const int shapes[][3] = {{1, 1, 1},   {5, 3, 7},     {33, 65, 17},
+                           {130, 9, 300}, {7, 257, 129}, {200, 200, 200}};
+  for (auto &shape : shapes) {
+    S21Matrix A = PatternMatrix(shape[0], shape[1], 1);
+    S21Matrix B = PatternMatrix(shape[1], shape[2], 2);
+    S21Matrix expected = NaiveProduct(A, B);
+
+    // ACT
+    A.MulMatrix(B);
+
+    // ASSERT
+    EXPECT_EQ(A.GetRows(), shape[0]);
+    EXPECT_EQ(A.GetCols(), shape[2]);
+    EXPECT_EQ(A.EqMatrix(expected), 1);
+  }
+}
+
+TEST(GemmTests, leading_dimension_test) {
+  // ARRANGE
+  // the 2 x 2 blocks in the corners of wider row-major arrays
+  double a[] = {1, 2, 0, 3, 4, 0};
+  double b[] = {5, 6, 0, 0, 7, 8, 0, 0};
+  double c[] = {1, 1, 9, 1, 1, 9};
+
+  // ACT
+  s21::Gemm(2, 2, 2, 1, a, 3, b, 4, c, 3);
+
+  // ASSERT
+  EXPECT_EQ(c[0], 20);
+  EXPECT_EQ(c[1], 23);
+  EXPECT_EQ(c[2], 9);
+  EXPECT_EQ(c[3], 44);
+  EXPECT_EQ(c[4], 51);
+  EXPECT_EQ(c[5], 9);
+}
@@ -0,0 +1,266 @@
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "s21_tests.h"
+
+namespace {
+
+// a file in the temporary directory removed at the end of the test
+class TemporaryFile {
+ public:
+  explicit TemporaryFile(const std::string &name)
+      : path_((std::filesystem::temp_directory_path() / name).string()) {}
+  ~TemporaryFile() { std::remove(path_.c_str()); }
+  const std::string &Path() const noexcept { return path_; }
+
+ private:
+  std::string path_;
+};
+
+// overwrites bytes of the file at the offset
+void Patch(const std::string &path, std::streamoff offset,
+           const std::string &bytes) {
+  std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+  file.seekp(offset);
+  file.write(bytes.data(), bytes.size());
+}
+
+// a stream buffer that cannot seek, like a pipe
+class PipeBuffer : public std::streambuf {
+ public:
+  explicit PipeBuffer(std::string bytes) : bytes_(std::move(bytes)) {
+    setg(bytes_.data(), bytes_.data(), bytes_.data() + bytes_.size());
+  }
+
+ private:
+  std::string bytes_;
+};
+
+}  // namespace
+
+TEST(IoTests, hash_test) {
+  // ASSERT
+  // the reference values of XXH64 with the seed 0
+  const std::string text = "Nobody inspects the spammish repetition";
+  EXPECT_EQ(s21::Hash64("", 0), 0xEF46DB3751D8E999ull);
+  EXPECT_EQ(s21::Hash64("abc", 3), 0x44BC2CF5AD770999ull);
+  EXPECT_EQ(s21::Hash64(text.data(), text.size()), 0xFBCEA83C8A378BF1ull);
+  EXPECT_NE(s21::Hash64("abc", 3, 1), s21::Hash64("abc", 3));
+}
+
+TEST(IoTests, hasher_test) {
+  // ARRANGE
+  std::string text;
+  for (auto i = 0; i < 300; ++i) text += static_cast<char>(i * 7);
+
+  // ACT
+  // the same bytes in pieces of every length up to 40
+  for (std::size_t piece = 1; piece <= 40; ++piece) {
+    s21::Hasher64 hasher(42);
+    for (std::size_t i = 0; i < text.size(); i += piece)
+      hasher.Update(text.data() + i, std::min(piece, text.size() - i));
+
+    // ASSERT
+    EXPECT_EQ(hasher.Digest(), s21::Hash64(text.data(), text.size(), 42));
+  }
+}
+
+TEST(IoTests, stream_round_trip_test) {
+  // ARRANGE
+  // packed and padded rows
+  for (auto cols : {5, 45}) {
+    S21Matrix matrix = WaveMatrix(7, cols);
+    std::stringstream stream;
+
+    // ACT
+    s21::SaveMatrix(matrix, stream);
+    S21Matrix loaded = s21::LoadMatrix(stream);
+
+    // ASSERT
+    EXPECT_TRUE(loaded.EqMatrix(matrix));
+    s21::MatrixFileHeader header;
+    std::memcpy(&header, stream.str().data(), sizeof(header));
+    EXPECT_EQ(std::string(header.magic, 8), "S21MATRX");
+    EXPECT_EQ(header.rows, 7);
+    EXPECT_EQ(header.cols, cols);
+    EXPECT_EQ(header.stride, cols < 32 ? cols : 48);
+    EXPECT_EQ(header.data_offset, 64u);
+    EXPECT_EQ(stream.str().size(), 64 + 7 * header.stride * sizeof(double));
+  }
+}
+
+TEST(IoTests, unbounded_header_test) {
+  // ARRANGE
+  TemporaryFile file("s21_io_unbounded.s21m");
+  S21Matrix matrix = WaveMatrix(7, 45);
+  std::stringstream stream;
+  s21::SaveMatrix(matrix, stream);
+  const std::string saved = stream.str();
+  // a header claiming INT_MAX rows of the same stride
+  std::string unbounded = saved;
+  const std::int64_t rows = INT_MAX;
+  unbounded.replace(offsetof(s21::MatrixFileHeader, rows), sizeof(rows),
+                    reinterpret_cast<const char *>(&rows), sizeof(rows));
+  std::ofstream(file.Path(), std::ios::binary) << unbounded;
+
+  // ACT
+  PipeBuffer pipe(saved), unbounded_pipe(unbounded);
+  std::istream pipe_stream(&pipe), unbounded_pipe_stream(&unbounded_pipe);
+  std::istringstream unbounded_stream(unbounded);
+  S21Matrix loaded = s21::LoadMatrix(pipe_stream);
+
+  // ASSERT
+  // the rows of a stream that cannot seek are read in chunks
+  EXPECT_TRUE(loaded.EqMatrix(matrix));
+  EXPECT_THROW(s21::LoadMatrix(file.Path()), std::runtime_error);
+  EXPECT_THROW(s21::LoadMatrix(unbounded_stream), std::runtime_error);
+  EXPECT_THROW(s21::LoadMatrix(unbounded_pipe_stream), std::runtime_error);
+}
+
+TEST(IoTests, file_round_trip_test) {
+  // ARRANGE
+  TemporaryFile file("s21_io_round_trip.s21m");
+  S21Matrix matrix = WaveMatrix(33, 40);
+  S21ArenaResource arena;
+
+  // ACT
+  s21::SaveMatrix(matrix, file.Path());
+  S21Matrix loaded = s21::LoadMatrix(file.Path(), &arena);
+
+  // ASSERT
+  EXPECT_TRUE(loaded.EqMatrix(matrix));
+  EXPECT_EQ(loaded.GetResource(), &arena);
+  EXPECT_THROW(s21::LoadMatrix(file.Path() + ".missing"), std::runtime_error);
+  const s21::MatrixFileHeader header = s21::ReadMatrixHeader(file.Path());
+  const s21::MatrixFileHeader made =
+      s21::MakeMatrixHeader(33, 40, header.checksum);
+  EXPECT_EQ(std::memcmp(&header, &made, sizeof(header)), 0);
+}
+
+TEST(IoTests, corrupted_file_test) {
+  // ARRANGE
+  TemporaryFile file("s21_io_corrupted.s21m");
+  S21Matrix matrix = WaveMatrix(4, 4);
+  s21::SaveMatrix(matrix, file.Path());
+
+  // ACT
+  // a changed element
+  Patch(file.Path(), 64 + 5 * sizeof(double), "\x01");
+
+  // ASSERT
+  EXPECT_THROW(s21::LoadMatrix(file.Path()), std::runtime_error);
+  EXPECT_THROW(S21MappedMatrix(file.Path(), true), std::runtime_error);
+  // the mapping without verification trusts the rows
+  EXPECT_NO_THROW(S21MappedMatrix(file.Path(), false));
+
+  // a changed magic, a wrong version and a truncated file
+  s21::SaveMatrix(matrix, file.Path());
+  Patch(file.Path(), 0, "X");
+  EXPECT_THROW(s21::LoadMatrix(file.Path()), std::runtime_error);
+  s21::SaveMatrix(matrix, file.Path());
+  Patch(file.Path(), 8, "\x02");
+  EXPECT_THROW(S21MappedMatrix(file.Path()), std::runtime_error);
+  s21::SaveMatrix(matrix, file.Path());
+  std::filesystem::resize_file(file.Path(), 64 + 15 * sizeof(double));
+  EXPECT_THROW(s21::LoadMatrix(file.Path()), std::runtime_error);
+  EXPECT_THROW(S21MappedMatrix(file.Path()), std::runtime_error);
+}
+
+TEST(IoTests, mapped_matrix_test) {
+  // ARRANGE
+  TemporaryFile file("s21_io_mapped.s21m");
+  S21Matrix matrix = WaveMatrix(50, 37);
+  s21::SaveMatrix(matrix, file.Path());
+
+  // ACT
+  S21MappedMatrix mapped(file.Path(), true);
+  S21MappedMatrix moved(std::move(mapped));
+  const S21Matrix &view = moved;
+
+  // ASSERT
+  EXPECT_EQ(view.GetRows(), 50);
+  EXPECT_EQ(view.GetCols(), 37);
+  EXPECT_TRUE(view.EqMatrix(matrix));
+  EXPECT_EQ(view(49, 36), matrix(49, 36));
+  // the read-only operations work on the mapping, the copies own memory
+  S21Matrix product = view * view.Transpose();
+  S21Matrix expected = matrix * matrix.Transpose();
+  EXPECT_TRUE(product.EqMatrix(expected));
+  S21Matrix copy(view);
+  copy.MulNumber(2);
+  EXPECT_EQ(copy(1, 1), 2 * view(1, 1));
+  EXPECT_THROW(S21MappedMatrix(file.Path() + ".missing"), std::runtime_error);
+}
+
+TEST(IoTests, mapped_factorization_test) {
+  // ARRANGE
+  TemporaryFile file("s21_io_factorization.s21m");
+  S21Matrix matrix = DominantMatrix(6);
+  S21Matrix rhs = WaveMatrix(6, 2);
+  s21::SaveMatrix(matrix, file.Path());
+
+  // ACT
+  S21MappedMatrix mapped(file.Path(), true);
+  const S21Matrix &view = mapped;
+
+  // ASSERT
+  // the factorizations copy the mapped rows into memory they own
+  EXPECT_DOUBLE_EQ(view.Determinant(), matrix.Determinant());
+  EXPECT_TRUE(view.InverseMatrix().EqMatrix(matrix.InverseMatrix()));
+  EXPECT_TRUE(view.Solve(rhs).EqMatrix(matrix.Solve(rhs)));
+  EXPECT_TRUE(view.CalcComplements().EqMatrix(matrix.CalcComplements()));
+}
+
+TEST(IoTests, mapped_decomposition_test) {
+  // ARRANGE
+  TemporaryFile square_file("s21_io_cholesky.s21m");
+  TemporaryFile tall_file("s21_io_qr.s21m");
+  S21Matrix wave = WaveMatrix(6, 6);
+  S21Matrix spd = wave.Transpose() * wave;
+  for (auto i = 0; i < 6; ++i) spd(i, i) += 6;
+  S21Matrix tall = WaveMatrix(9, 5);
+  for (auto i = 0; i < 5; ++i) tall(i, i) += 9;
+  S21Matrix rhs = WaveMatrix(9, 2, 1);
+  s21::SaveMatrix(spd, square_file.Path());
+  s21::SaveMatrix(tall, tall_file.Path());
+
+  // ACT
+  S21MappedMatrix mapped_spd(square_file.Path(), true);
+  S21MappedMatrix mapped_tall(tall_file.Path(), true);
+  S21CholeskyDecomposition cholesky(mapped_spd);
+  S21QRDecomposition qr(mapped_tall);
+
+  // ASSERT
+  EXPECT_TRUE(cholesky.IsPositiveDefinite());
+  EXPECT_TRUE(
+      cholesky.GetFactor().EqMatrix(S21CholeskyDecomposition(spd).GetFactor()));
+  EXPECT_TRUE(qr.Solve(rhs).EqMatrix(S21QRDecomposition(tall).Solve(rhs)));
+}
+
+TEST(IoTests, mapped_updatable_inverse_test) {
+  // ARRANGE
+  TemporaryFile file("s21_io_updatable.s21m");
+  S21Matrix matrix = DominantMatrix(8);
+  s21::SaveMatrix(matrix, file.Path());
+
+  // ACT
+  S21MappedMatrix mapped(file.Path(), true);
+  S21UpdatableInverse updatable(mapped);
+  updatable.SetValue(2, 3, 4.5);
+  updatable.Refactor();
+  matrix(2, 3) = 4.5;
+
+  // ASSERT
+  EXPECT_NE(updatable.GetMatrix().GetResource(),
+            std::pmr::null_memory_resource());
+  EXPECT_TRUE(updatable.GetMatrix().EqMatrix(matrix));
+  EXPECT_TRUE(updatable.InverseMatrix().EqMatrix(matrix.InverseMatrix()));
+}
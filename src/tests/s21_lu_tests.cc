@@ -0,0 +1,141 @@
+#include "s21_tests.h"
+
+TEST(LUTests, determinant_test) {
+  // ARRANGE
+  std::vector<double> vec1{1, 51, 9, 13, 4, 5,  6, 24,
+                           7, 10, 9, 31, 8, 17, 3, 6};
+  std::vector<double> vec2{2, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 4,
+                           0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 6};
+
+  std::unique_ptr<VectorsMatrixBuilder> builder{
+      std::make_unique<VectorsMatrixBuilder>(VectorsMatrixBuilder())};
+
+  std::unique_ptr<S21Matrix> A = builder->CreateMatrix(4, 4);
+  builder->FillMatrix(vec1, A);
+  std::unique_ptr<S21Matrix> B = builder->CreateMatrix(5, 5);
+  builder->FillMatrix(vec2, B);
+  // swapping two rows changes the sign of the determinant
+  std::unique_ptr<S21Matrix> C = builder->CreateMatrix(5, 5);
+  builder->FillMatrix(vec2, C);
+  C->SetValue(0, 0, 0);
+  C->SetValue(0, 1, 3);
+  C->SetValue(1, 0, 2);
+  C->SetValue(1, 1, 0);
+
+  // ACT and ASSERT
+  EXPECT_NEAR(A->Determinant(), 7920, 1e-9);
+  EXPECT_NEAR(B->Determinant(), 720, 1e-12);
+  EXPECT_NEAR(C->Determinant(), -720, 1e-12);
+  EXPECT_THROW(S21LUDecomposition(S21Matrix(2, 3)), std::invalid_argument);
+
+  A.reset();
+  B.reset();
+  C.reset();
+  builder.reset();
+}
+
+TEST(LUTests, singular_test) {
+  // ARRANGE
+  S21Matrix A = DominantMatrix(6);
+  // the last row repeats the second one
+  for (auto j = 0; j < 6; ++j) A.SetValue(5, j, A.GetValue(1, j));
+  // a zero column after the first panel stays zero through the updates
+  S21Matrix B = DominantMatrix(100);
+  for (auto i = 0; i < 100; ++i) B.SetValue(i, 90, 0);
+
+  // ACT
+  S21LUDecomposition lu(A);
+
+  // ASSERT
+  EXPECT_TRUE(lu.IsSingular());
+  EXPECT_TRUE(S21LUDecomposition(B).IsSingular());
+  EXPECT_FALSE(S21LUDecomposition(DominantMatrix(100)).IsSingular());
+  EXPECT_EQ(lu.Determinant(), 0);
+  EXPECT_THROW(A.InverseMatrix(), std::invalid_argument);
+  EXPECT_THROW(lu.Solve(S21Matrix(6, 1)), std::invalid_argument);
+}
+
+TEST(LUTests, badly_scaled_test) {
+  // ARRANGE
+  // regular, although its smallest pivot is far below the largest element
+  S21Matrix A(4, 4), B(3, 3);
+  const double diagonal[4] = {1e10, 1, 1, 1e-7};
+  for (auto i = 0; i < 4; ++i) A.SetValue(i, i, diagonal[i]);
+  for (auto i = 0; i < 3; ++i) B.SetValue(i, i, diagonal[i == 2 ? 3 : i]);
+
+  // ACT
+  S21LUDecomposition lu(A);
+  S21Matrix inverse_mx = A.InverseMatrix();
+
+  // ASSERT
+  EXPECT_FALSE(lu.IsSingular());
+  EXPECT_DOUBLE_EQ(lu.Determinant(), 1e3);
+  EXPECT_DOUBLE_EQ(A.Determinant(), 1e3);
+  EXPECT_DOUBLE_EQ(B.Determinant(), 1e3);
+  EXPECT_DOUBLE_EQ(inverse_mx.GetValue(0, 0), 1e-10);
+  EXPECT_DOUBLE_EQ(inverse_mx.GetValue(3, 3), 1e7);
+}
+
+TEST(LUTests, inverse_test) {
+  // ARRANGE
+  // more than two panels of the blocked factorization
+  const int n = 150;
+  S21Matrix A = DominantMatrix(n);
+
+  // ACT
+  S21Matrix inverse_mx = A.InverseMatrix();
+  S21Matrix product = A;
+  product.MulMatrix(inverse_mx);
+
+  // ASSERT
+  for (auto i = 0; i < n; ++i)
+    for (auto j = 0; j < n; ++j)
+      EXPECT_NEAR(product.GetValue(i, j), i == j ? 1 : 0, 1e-12);
+  EXPECT_NEAR(S21Matrix(1, 1).CalcComplements().GetValue(0, 0), 1, 0);
+}
+
+TEST(LUTests, solve_test) {
+  // ARRANGE
+  const int n = 25;
+  S21Matrix A = DominantMatrix(n);
+  S21Matrix X(n, 3);
+  for (auto i = 0; i < n; ++i)
+    for (auto j = 0; j < 3; ++j) X.SetValue(i, j, i - 2.5 * j);
+  S21Matrix B = A;
+  B.MulMatrix(X);
+
+  // ACT
+  S21LUDecomposition lu(A);
+  S21Matrix solution = lu.Solve(B);
+
+  // ASSERT
+  EXPECT_EQ(lu.GetSize(), n);
+  for (auto i = 0; i < n; ++i)
+    for (auto j = 0; j < 3; ++j)
+      EXPECT_NEAR(solution.GetValue(i, j), X.GetValue(i, j), 1e-10);
+  EXPECT_THROW(lu.Solve(S21Matrix(n + 1, 1)), std::invalid_argument);
+}
+
+TEST(LUTests, calc_complements_test) {
+  // ARRANGE
+  const int n = 7;
+  S21Matrix A = DominantMatrix(n);
+
+  // ACT
+  double det = A.Determinant();
+  S21Matrix complements = A.CalcComplements();
+  // A * C^T = det(A) * E
+  S21Matrix product = A;
+  product.MulMatrix(complements.Transpose());
+
+  // ASSERT
+  for (auto i = 0; i < n; ++i)
+    for (auto j = 0; j < n; ++j)
+      EXPECT_NEAR(product.GetValue(i, j), i == j ? det : 0,
+                  1e-9 * std::fabs(det));
+  // the cofactor of a singular matrix is still defined
+  S21Matrix B(5, 5);
+  for (auto i = 0; i < 4; ++i) B.SetValue(i, i, 1);
+  EXPECT_NEAR(B.CalcComplements().GetValue(4, 4), 1, 1e-12);
+  EXPECT_NEAR(B.CalcComplements().GetValue(0, 0), 0, 1e-12);
+}
@@ -1,12 +1,14 @@
 #include "s21_matrix_builder.h"
 
+#include <cmath>
+
 std::unique_ptr<S21Matrix> VectorsMatrixBuilder::CreateMatrix(int rows,
                                                               int cols) {
   return {std::make_unique<S21Matrix>(S21Matrix(rows, cols))};
 }
 
 // values: vector of matrix values
-void VectorsMatrixBuilder::FillMatrix(std::vector<double> values,
+void VectorsMatrixBuilder::FillMatrix(const std::vector<double> &values,
                                       std::unique_ptr<S21Matrix> &matrix) {
   auto rows = matrix->GetRows();
   auto cols = matrix->GetCols();
@@ -28,3 +30,34 @@ void VectorsMatrixBuilder::OutputMatrix(
     std::cout << "\n";
   }
 }
+
+S21Matrix FilledMatrix(int rows, int cols, double shift) {
+  S21Matrix result(rows, cols);
+  for (auto i = 0; i < rows; ++i)
+    for (auto j = 0; j < cols; ++j) result(i, j) = i * cols + j + shift;
+  return result;
+}
+
+S21Matrix WaveMatrix(int rows, int cols, double phase) {
+  S21Matrix result(rows, cols);
+  for (auto i = 0; i < rows; ++i)
+    for (auto j = 0; j < cols; ++j)
+      result(i, j) = std::sin(i * 0.37 + j * 0.11 + phase);
+  return result;
+}
+
+S21Matrix PatternMatrix(int rows, int cols, int seed) {
+  S21Matrix result(rows, cols);
+  for (auto i = 0; i < rows; ++i)
+    for (auto j = 0; j < cols; ++j)
+      result(i, j) = (i * 31 + j * 17 + seed) % 11 - 5;
+  return result;
+}
+
+S21Matrix DominantMatrix(int n) {
+  S21Matrix result(n, n);
+  for (auto i = 0; i < n; ++i)
+    for (auto j = 0; j < n; ++j)
+      result(i, j) = i == j ? 2.0 * n : std::sin(i * 7.0 + j);
+  return result;
+}
@@ -11,9 +11,20 @@
 class VectorsMatrixBuilder {
  public:
   std::unique_ptr<S21Matrix> CreateMatrix(int rows, int cols);
-  void FillMatrix(std::vector<double> values,
+  void FillMatrix(const std::vector<double> &values,
                   std::unique_ptr<S21Matrix> &matrix);
   void OutputMatrix(std::unique_ptr<S21Matrix> const &matrix);
 };
 
+// the matrices shared by the tests
+
+// the element (i, j) is i * cols + j + shift
+S21Matrix FilledMatrix(int rows, int cols, double shift = 0);
+// smooth values in [-1, 1] without two equal rows
+S21Matrix WaveMatrix(int rows, int cols, double phase = 0);
+// small integers, so that sums and products are exact
+S21Matrix PatternMatrix(int rows, int cols, int seed = 0);
+// a diagonally dominant matrix, invertible for every order
+S21Matrix DominantMatrix(int n);
+
 #endif  // _SRC_S21_MATRIX_BUILDER_H_
\ No newline at end of file
@@ -0,0 +1,190 @@
+#include <vector>
+
+#include "s21_tests.h"
+
+namespace {
+
+// a resource that counts the calls passed to its upstream
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  int allocations = 0, deallocations = 0;
+  std::size_t bytes = 0;
+
+ private:
+  void *do_allocate(std::size_t size, std::size_t alignment) override {
+    ++allocations;
+    bytes += size;
+    return std::pmr::new_delete_resource()->allocate(size, alignment);
+  }
+  void do_deallocate(void *ptr, std::size_t size,
+                     std::size_t alignment) override {
+    ++deallocations;
+    bytes -= size;
+    std::pmr::new_delete_resource()->deallocate(ptr, size, alignment);
+  }
+  bool do_is_equal(
+      const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+}  // namespace
+
+TEST(MemoryTests, default_resource_test) {
+  // ARRANGE
+  S21Matrix A(3, 3), B = A;
+  // ASSERT
+  EXPECT_EQ(A.GetResource(), std::pmr::get_default_resource());
+  EXPECT_EQ(B.GetResource(), std::pmr::get_default_resource());
+}
+
+TEST(MemoryTests, matrix_resource_test) {
+  // ARRANGE
+  CountingResource counter;
+  {
+    S21Matrix A(40, 40, &counter);
+    A.SetValue(39, 39, 2);
+    // ACT
+    S21Matrix T = A.Transpose();
+    A.SetRows(50);
+    S21Matrix copy(A, &counter);
+    // ASSERT
+    EXPECT_EQ(T.GetResource(), &counter);
+    EXPECT_EQ(copy.GetResource(), &counter);
+    EXPECT_EQ(copy.GetValue(39, 39), 2);
+    EXPECT_EQ(counter.allocations, 4);
+    EXPECT_EQ(counter.deallocations, 1);
+  }
+  EXPECT_EQ(counter.allocations, counter.deallocations);
+  EXPECT_EQ(counter.bytes, 0u);
+}
+
+TEST(MemoryTests, move_resource_test) {
+  // ARRANGE
+  CountingResource counter;
+  S21Matrix A(4, 4, &counter), B(4, 4, &counter), D(4, 4);
+  A.SetValue(1, 2, 5);
+  // ACT
+  B = std::move(A);
+  S21Matrix C(std::move(B));
+  // another resource keeps its storage and copies the elements
+  D = std::move(C);
+  // ASSERT
+  EXPECT_EQ(C.GetResource(), &counter);
+  EXPECT_EQ(C.GetRows(), 0);
+  EXPECT_EQ(D.GetResource(), std::pmr::get_default_resource());
+  EXPECT_EQ(D(1, 2), 5);
+  EXPECT_EQ(counter.allocations, 2);
+  EXPECT_EQ(counter.deallocations, 2);
+}
+
+TEST(MemoryTests, copy_assign_keeps_resource_test) {
+  // ARRANGE
+  CountingResource counter;
+  S21Matrix A(2, 5, &counter), B(6, 7);
+  B.SetValue(5, 6, 3);
+  // ACT
+  A = B;
+  // ASSERT
+  EXPECT_EQ(A.GetResource(), &counter);
+  EXPECT_EQ(A.GetValue(5, 6), 3);
+  EXPECT_EQ(counter.allocations, 2);
+}
+
+TEST(MemoryTests, pool_reuse_test) {
+  // ARRANGE
+  CountingResource counter;
+  S21PoolResource pool(&counter);
+  // ACT
+  for (auto i = 0; i < 100; ++i) {
+    S21Matrix A(16, 16, &pool);
+    A.SetValue(15, 15, i);
+    // ASSERT
+    EXPECT_EQ(A(0, 0), 0);
+    EXPECT_EQ(A(15, 15), i);
+  }
+  // one slab serves every iteration
+  EXPECT_EQ(counter.allocations, 1);
+}
+
+TEST(MemoryTests, pool_size_classes_test) {
+  // ARRANGE
+  CountingResource counter;
+  {
+    S21PoolResource pool(&counter);
+    std::vector<S21Matrix> matrices;
+    // ACT
+    for (auto n = 1; n <= 64; ++n) matrices.emplace_back(n, n, &pool);
+    S21Matrix large(200, 200, &pool);
+    // ASSERT
+    for (auto &matrix : matrices) EXPECT_EQ(matrix.Determinant(), 0);
+    large.SetValue(199, 199, 1);
+    EXPECT_EQ(large(199, 199), 1);
+  }
+  EXPECT_EQ(counter.allocations, counter.deallocations);
+  EXPECT_EQ(counter.bytes, 0u);
+}
+
+TEST(MemoryTests, arena_test) {
+  // ARRANGE
+  CountingResource counter;
+  S21ArenaResource arena(1 << 12, &counter);
+  // ACT
+  for (auto i = 0; i < 50; ++i) {
+    S21Matrix A(10, 10, &arena), B(10, 10, &arena);
+    A.SetValue(0, 0, i);
+    B.SetValue(0, 0, 1);
+    A.SumMatrix(B);
+    // ASSERT
+    EXPECT_EQ(A(0, 0), i + 1);
+  }
+  EXPECT_EQ(arena.GetUsed(), 50 * 2 * 100 * sizeof(double));
+  EXPECT_LT(counter.allocations, 10);
+}
+
+TEST(MemoryTests, arena_product_assign_test) {
+  // ARRANGE
+  S21ArenaResource arena;
+  S21Matrix A = WaveMatrix(8, 8), B = WaveMatrix(8, 8, 1), C(8, 8, &arena);
+  S21Matrix expected = A;
+  expected.MulMatrix(B);
+  const std::size_t used = arena.GetUsed();
+  // ACT
+  C = A * B;
+  // ASSERT
+  // the product is copied into the storage the matrix already has
+  EXPECT_EQ(C.GetResource(), &arena);
+  EXPECT_EQ(arena.GetUsed(), used);
+  EXPECT_TRUE(C.EqMatrix(expected));
+}
+
+TEST(MemoryTests, arena_release_test) {
+  // ARRANGE
+  CountingResource counter;
+  {
+    S21ArenaResource arena(1 << 12, &counter);
+    for (auto i = 0; i < 20; ++i) S21Matrix A(10, 10, &arena);
+    // ACT
+    arena.Release();
+    for (auto i = 0; i < 20; ++i) S21Matrix A(10, 10, &arena);
+    int allocations = counter.allocations;
+    arena.Release();
+    for (auto i = 0; i < 20; ++i) S21Matrix A(10, 10, &arena);
+    // ASSERT
+    EXPECT_EQ(arena.GetUsed(), 20 * 100 * sizeof(double));
+    // after the first release the arena works in a single chunk
+    EXPECT_EQ(counter.allocations, allocations);
+    EXPECT_EQ(counter.allocations - counter.deallocations, 1);
+  }
+  EXPECT_EQ(counter.bytes, 0u);
+}
+
+TEST(MemoryTests, arena_large_request_test) {
+  // ARRANGE
+  S21ArenaResource arena(256);
+  // ACT
+  S21Matrix A(100, 100, &arena);
+  A.SetValue(99, 99, 5);
+  // ASSERT
+  EXPECT_EQ(A(99, 99), 5);
+}
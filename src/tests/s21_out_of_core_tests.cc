@@ -0,0 +1,111 @@
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+#include "s21_tests.h"
+
+namespace {
+
+// the tiles add the products in another order than the whole product
+constexpr double kTileTolerance = 1e-9;
+
+// the files of an out-of-core product removed at the end of the test
+class ProductFiles {
+ public:
+  explicit ProductFiles(const std::string &name)
+      : a_(Path(name + "_a.s21m")),
+        b_(Path(name + "_b.s21m")),
+        c_(Path(name + "_c.s21m")) {}
+  ~ProductFiles() {
+    std::remove(a_.c_str());
+    std::remove(b_.c_str());
+    std::remove(c_.c_str());
+  }
+  const std::string &A() const noexcept { return a_; }
+  const std::string &B() const noexcept { return b_; }
+  const std::string &C() const noexcept { return c_; }
+
+ private:
+  static std::string Path(const std::string &name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+  }
+
+  std::string a_, b_, c_;
+};
+
+}  // namespace
+
+TEST(OutOfCoreTests, larger_than_budget_test) {
+  // ARRANGE
+  // operands of about 360 and 420 kB with a budget of 64 kB
+  ProductFiles files("s21_out_of_core_large");
+  S21Matrix a = WaveMatrix(150, 300, 0.0);
+  S21Matrix b = WaveMatrix(300, 170, 1.0);
+  s21::SaveMatrix(a, files.A());
+  s21::SaveMatrix(b, files.B());
+  const std::size_t budget = 64 << 10;
+
+  // ACT
+  const s21::OutOfCoreReport report =
+      s21::MulMatrixFiles(files.A(), files.B(), files.C(), budget);
+  S21Matrix product = s21::LoadMatrix(files.C());
+
+  // ASSERT
+  EXPECT_GT(std::filesystem::file_size(files.A()), budget);
+  EXPECT_GT(std::filesystem::file_size(files.B()), budget);
+  EXPECT_LE(report.buffer_bytes, budget);
+  EXPECT_LT(report.tile_rows, 150);
+  EXPECT_LT(report.tile_cols, 170);
+  EXPECT_LT(report.tile_depth, 300);
+  ExpectNear(product, a * b, kTileTolerance);
+  // every tile of C reads its row of A and its column of B once
+  EXPECT_GE(report.bytes_read, (150 * 300 + 300 * 170) * sizeof(double));
+  EXPECT_EQ(report.bytes_written, 64 + 150 * 170 * sizeof(double));
+}
+
+TEST(OutOfCoreTests, uneven_tiles_test) {
+  // ARRANGE
+  // the shapes are not multiples of the 8 x 8 tiles of a 4 kB budget
+  ProductFiles files("s21_out_of_core_uneven");
+  S21Matrix a = WaveMatrix(37, 29, 2.0);
+  S21Matrix b = WaveMatrix(29, 45, 3.0);
+  s21::SaveMatrix(a, files.A());
+  s21::SaveMatrix(b, files.B());
+
+  // ACT
+  const s21::OutOfCoreReport report =
+      s21::MulMatrixFiles(files.A(), files.B(), files.C(), 4 << 10);
+
+  // ASSERT
+  EXPECT_EQ(report.tile_rows, 8);
+  EXPECT_EQ(report.tile_cols, 8);
+  ExpectNear(s21::LoadMatrix(files.C()), a * b, kTileTolerance);
+  // a budget that holds everything takes the operands as one tile
+  const s21::OutOfCoreReport whole =
+      s21::MulMatrixFiles(files.A(), files.B(), files.C(), 1 << 20);
+  EXPECT_EQ(whole.tile_rows, 37);
+  EXPECT_EQ(whole.tile_cols, 45);
+  EXPECT_EQ(whole.tile_depth, 29);
+  ExpectNear(s21::LoadMatrix(files.C()), a * b, kTileTolerance);
+}
+
+TEST(OutOfCoreTests, errors_test) {
+  // ARRANGE
+  ProductFiles files("s21_out_of_core_errors");
+  s21::SaveMatrix(WaveMatrix(4, 5, 0.0), files.A());
+  s21::SaveMatrix(WaveMatrix(4, 5, 0.0), files.B());
+
+  // ASSERT
+  EXPECT_THROW(s21::MulMatrixFiles(files.A(), files.B(), files.C(), 1 << 20),
+               std::invalid_argument);
+  s21::SaveMatrix(WaveMatrix(5, 3, 0.0), files.B());
+  EXPECT_THROW(s21::MulMatrixFiles(files.A(), files.B(), files.C(), 16),
+               std::invalid_argument);
+  EXPECT_THROW(s21::MulMatrixFiles(files.A(), files.B(), files.A(), 1 << 20),
+               std::invalid_argument);
+  EXPECT_THROW(
+      s21::MulMatrixFiles(files.A() + ".missing", files.B(), files.C(), 4096),
+      std::runtime_error);
+  EXPECT_NO_THROW(s21::MulMatrixFiles(files.A(), files.B(), files.C(), 4096));
+}
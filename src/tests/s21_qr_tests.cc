@@ -0,0 +1,122 @@
+#include "s21_tests.h"
+
+namespace {
+
+// a well-conditioned rows x cols matrix with a known pattern of values
+S21Matrix TallMatrix(int rows, int cols) {
+  S21Matrix result(rows, cols);
+  for (auto i = 0; i < rows; ++i)
+    for (auto j = 0; j < cols; ++j)
+      result.SetValue(i, j, (i == j ? 4.0 : 0) + std::sin(i * 5.0 + j));
+  return result;
+}
+
+}  // namespace
+
+TEST(QRTests, factor_test) {
+  // ARRANGE
+  // three panels, the last one partial
+  S21Matrix A = TallMatrix(200, 70);
+
+  // ACT
+  S21QRDecomposition qr(A);
+  S21Matrix R(70, 70);
+  for (auto i = 0; i < 70; ++i)
+    for (auto j = i; j < 70; ++j) R.SetValue(i, j, qr.GetFactors()(i, j));
+  // Q is orthogonal, so R^T * R = A^T * A
+  S21Matrix r_gram = R.Transpose() * R, a_gram = A.Transpose() * A;
+
+  // ASSERT
+  EXPECT_TRUE(qr.IsFullRank());
+  EXPECT_EQ(qr.GetRows(), 200);
+  EXPECT_EQ(qr.GetCols(), 70);
+  for (auto i = 0; i < 70; ++i)
+    for (auto j = 0; j < 70; ++j)
+      EXPECT_NEAR(r_gram(i, j), a_gram(i, j), 1e-10);
+  EXPECT_THROW(S21QRDecomposition(S21Matrix(2, 3)), std::invalid_argument);
+}
+
+TEST(QRTests, least_squares_test) {
+  // ARRANGE
+  const int m = 120, n = 40;
+  S21Matrix A = TallMatrix(m, n);
+  S21Matrix X(n, 3);
+  for (auto i = 0; i < n; ++i)
+    for (auto j = 0; j < 3; ++j) X.SetValue(i, j, i - 2.5 * j);
+  S21Matrix B = A * X;
+  // an inconsistent right-hand side, solved by the normal equations too
+  S21Matrix b(m, 1);
+  for (auto i = 0; i < m; ++i) b.SetValue(i, 0, std::cos(i * 1.7));
+  S21Matrix normal = S21CholeskyDecomposition(A.Transpose() * A)
+                         .Solve(A.Transpose() * b);
+
+  // ACT
+  S21QRDecomposition qr(A);
+  S21Matrix solution = qr.Solve(B);
+  S21Matrix fit = qr.Solve(b);
+
+  // ASSERT
+  for (auto i = 0; i < n; ++i) {
+    for (auto j = 0; j < 3; ++j)
+      EXPECT_NEAR(solution(i, j), X(i, j), 1e-10);
+    EXPECT_NEAR(fit(i, 0), normal(i, 0), 1e-12);
+  }
+  EXPECT_THROW(qr.Solve(S21Matrix(n, 1)), std::invalid_argument);
+}
+
+TEST(QRTests, rank_deficient_test) {
+  // ARRANGE
+  S21Matrix A = TallMatrix(50, 40);
+  // the column 35 of the last panel repeats the column 3
+  for (auto i = 0; i < 50; ++i) A.SetValue(i, 35, A(i, 3));
+
+  // ACT
+  S21QRDecomposition qr(A);
+
+  // ASSERT
+  EXPECT_FALSE(qr.IsFullRank());
+  EXPECT_THROW(qr.Solve(S21Matrix(50, 1)), std::invalid_argument);
+}
+
+TEST(QRTests, scaled_columns_test) {
+  // ARRANGE
+  // full column rank, the features are measured in very different units
+  S21Matrix A(4, 2), X(2, 1);
+  for (auto i = 0; i < 4; ++i) {
+    A.SetValue(i, 0, 1e6 * (i + 1));
+    A.SetValue(i, 1, 1e-10 * (i % 2 ? 1 : -1));
+  }
+  X.SetValue(0, 0, 3);
+  X.SetValue(1, 0, -2e10);
+
+  // ACT
+  S21QRDecomposition qr(A);
+  S21Matrix solution = A.Solve(A * X);
+
+  // ASSERT
+  EXPECT_TRUE(qr.IsFullRank());
+  EXPECT_NEAR(solution(0, 0), 3, 1e-9);
+  EXPECT_NEAR(solution(1, 0) / -2e10, 1, 1e-9);
+}
+
+TEST(QRTests, matrix_solve_test) {
+  // ARRANGE
+  S21Matrix square = TallMatrix(30, 30), tall = TallMatrix(45, 30);
+  S21Matrix X(30, 2);
+  for (auto i = 0; i < 30; ++i)
+    for (auto j = 0; j < 2; ++j) X.SetValue(i, j, std::cos(i + 3.0 * j));
+
+  // ACT
+  S21Matrix square_solution = square.Solve(square * X);
+  S21Matrix tall_solution = tall.Solve(tall * X);
+
+  // ASSERT
+  for (auto i = 0; i < 30; ++i)
+    for (auto j = 0; j < 2; ++j) {
+      EXPECT_NEAR(square_solution(i, j), X(i, j), 1e-12);
+      EXPECT_NEAR(tall_solution(i, j), X(i, j), 1e-12);
+    }
+  EXPECT_THROW(S21Matrix(3, 4).Solve(S21Matrix(3, 1)), std::invalid_argument);
+  EXPECT_THROW(square.Solve(S21Matrix(29, 1)), std::invalid_argument);
+  EXPECT_THROW(S21Matrix(3, 3).Solve(S21Matrix(3, 1)), std::invalid_argument);
+}
@@ -0,0 +1,121 @@
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include "s21_tests.h"
+
+TEST(ReduceTests, sums_test) {
+  // ARRANGE
+  // 700 x 130 is split into several tasks
+  const S21Matrix A = PatternMatrix(3, 37), B = PatternMatrix(700, 130);
+  const S21Matrix C = PatternMatrix(37, 37);
+
+  // ACT
+  const S21Matrix row_sums = B.RowSums(), col_sums = B.ColSums();
+
+  // ASSERT
+  for (const S21Matrix *m : {&A, &B}) {
+    double sum = 0;
+    for (auto i = 0; i < m->GetRows(); ++i)
+      for (auto j = 0; j < m->GetCols(); ++j) sum += (*m)(i, j);
+    EXPECT_EQ(m->Sum(), sum);
+    EXPECT_EQ(m->Dot(*m), m->Summarize().square_sum);
+  }
+  ASSERT_EQ(row_sums.GetRows(), 700);
+  ASSERT_EQ(col_sums.GetCols(), 130);
+  for (auto i = 0; i < 700; ++i) {
+    double sum = 0;
+    for (auto j = 0; j < 130; ++j) sum += B(i, j);
+    EXPECT_EQ(row_sums(i, 0), sum);
+  }
+  for (auto j = 0; j < 130; ++j) {
+    double sum = 0;
+    for (auto i = 0; i < 700; ++i) sum += B(i, j);
+    EXPECT_EQ(col_sums(0, j), sum);
+  }
+  double trace = 0;
+  for (auto i = 0; i < 37; ++i) trace += C(i, i);
+  EXPECT_EQ(C.Trace(), trace);
+  EXPECT_THROW(A.Trace(), std::invalid_argument);
+  EXPECT_THROW(A.Dot(C), std::invalid_argument);
+}
+
+TEST(ReduceTests, accuracy_test) {
+  // ARRANGE
+  const int threads = s21::GetNumThreads();
+  S21Matrix A(1000, 1000);
+  for (auto i = 0; i < 1000; ++i)
+    for (auto j = 0; j < 1000; ++j) A(i, j) = 0.1;
+
+  // ACT
+  double naive = 0;
+  for (auto i = 0; i < 1000; ++i)
+    for (auto j = 0; j < 1000; ++j) naive += A(i, j);
+  s21::SetNumThreads(1);
+  const double serial = A.Sum();
+  s21::SetNumThreads(4);
+  const double parallel = A.Sum();
+  const S21Matrix col_sums = A.ColSums();
+
+  // ASSERT
+  // the naive sum drifts by about 1e-6, the pairwise one stays within ulps
+  EXPECT_GT(std::fabs(naive - 1e5), 1e-7);
+  EXPECT_NEAR(serial, 1e5, 1e-9);
+  EXPECT_EQ(serial, parallel);
+  EXPECT_NEAR(col_sums(0, 999), 100, 1e-12);
+  EXPECT_NEAR(A.Norm(), 100, 1e-12);
+
+  s21::SetNumThreads(threads);
+}
+
+TEST(ReduceTests, norm_test) {
+  // ARRANGE
+  S21Matrix A(2, 3), huge(2, 2), tiny(2, 2);
+  A(0, 0) = 1, A(0, 1) = -2, A(0, 2) = 0;
+  A(1, 0) = 3, A(1, 1) = 4, A(1, 2) = -0.5;
+  for (auto i = 0; i < 2; ++i)
+    for (auto j = 0; j < 2; ++j) huge(i, j) = 1e200, tiny(i, j) = -1e-200;
+
+  // ACT & ASSERT
+  EXPECT_EQ(A.Norm(s21::Norm::kOne), 6);
+  EXPECT_EQ(A.Norm(s21::Norm::kInf), 7.5);
+  EXPECT_EQ(A.Norm(s21::Norm::kMaxAbs), 4);
+  EXPECT_DOUBLE_EQ(A.Norm(s21::Norm::kFrobenius), std::sqrt(30.25));
+  // the squares of the elements overflow or underflow without scaling
+  EXPECT_DOUBLE_EQ(huge.Norm(), 2e200);
+  EXPECT_DOUBLE_EQ(tiny.Norm(), 2e-200);
+  EXPECT_EQ(S21Matrix(4, 4).Norm(), 0);
+}
+
+TEST(ReduceTests, extrema_test) {
+  // ARRANGE
+  S21Matrix A = PatternMatrix(600, 301), B(2, 3), empty = PatternMatrix(2, 2);
+  A(1, 2) = -9, A(599, 300) = -9, A(400, 7) = 8, A(500, 9) = 8;
+  B(0, 0) = std::nan(""), B(0, 1) = 2, B(1, 2) = -1;
+  const S21Matrix moved = std::move(empty);
+
+  // ACT
+  const s21::Summary summary = A.Summarize();
+  const s21::Extremum b_min = B.Min(), b_max = B.Max();
+
+  // ASSERT
+  EXPECT_EQ(summary.min.value, -9);
+  EXPECT_EQ(summary.min.row, 1);
+  EXPECT_EQ(summary.min.col, 2);
+  EXPECT_EQ(summary.max.value, 8);
+  EXPECT_EQ(summary.max.row, 400);
+  EXPECT_EQ(summary.max.col, 7);
+  EXPECT_EQ(summary.sum, A.Sum());
+  double abs_sum = 0;
+  for (const double value : A) abs_sum += std::fabs(value);
+  EXPECT_EQ(summary.abs_sum, abs_sum);
+  EXPECT_EQ(b_min.value, -1);
+  EXPECT_EQ(b_min.row, 1);
+  EXPECT_EQ(b_max.value, 2);
+  EXPECT_EQ(b_max.col, 1);
+  EXPECT_TRUE(std::isnan(B.Sum()));
+  EXPECT_EQ(empty.Min().row, -1);
+  EXPECT_EQ(empty.Max().value, -std::numeric_limits<double>::infinity());
+  EXPECT_EQ(empty.Sum(), 0);
+  EXPECT_EQ(empty.Norm(s21::Norm::kOne), 0);
+}
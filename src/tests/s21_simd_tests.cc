@@ -0,0 +1,128 @@
+#include <numeric>
+
+#include "s21_tests.h"
+
+// every level supported by the processor must give the scalar results
+TEST(SimdTests, kernels_levels_test) {
+  // ARRANGE
+  // odd length to reach the scalar tails of every kernel
+  const std::size_t n = 37;
+  std::vector<double> x(n), y(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    x[i] = 0.5 * i - 3;
+    y[i] = 7 - 0.25 * i;
+  }
+  const s21::SimdLevel levels[] = {s21::SimdLevel::kScalar,
+                                   s21::SimdLevel::kSse2, s21::SimdLevel::kAvx2,
+                                   s21::SimdLevel::kAvx512};
+  for (auto level : levels) {
+    const auto &simd = s21::SimdFor(level);
+    std::vector<double> sum = y, diff = y, scaled = y, axpy = y;
+
+    // ACT
+    simd.add(sum.data(), x.data(), n);
+    simd.sub(diff.data(), x.data(), n);
+    simd.scale(scaled.data(), -2, n);
+    simd.axpy(axpy.data(), 3, x.data(), n);
+
+    // ASSERT
+    EXPECT_LE(simd.level, s21::SupportedSimdLevel());
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_EQ(sum[i], y[i] + x[i]);
+      EXPECT_EQ(diff[i], y[i] - x[i]);
+      EXPECT_EQ(scaled[i], y[i] * -2);
+      EXPECT_DOUBLE_EQ(axpy[i], y[i] + 3 * x[i]);
+    }
+    EXPECT_TRUE(simd.equal(x.data(), x.data(), n));
+    // a mismatch in the last element lands in the scalar tail
+    std::vector<double> z = x;
+    z[n - 1] += 1;
+    EXPECT_FALSE(simd.equal(x.data(), z.data(), n));
+    z = x;
+    z[3] = NAN;
+    EXPECT_FALSE(simd.equal(z.data(), z.data(), n));
+    // the halves of x and y are exact in binary, so are their sums
+    double moments[5];
+    simd.moments(z.data(), n, moments);
+    EXPECT_EQ(simd.sum(x.data(), n), 0.5 * 36 * 37 / 2 - 3 * 37);
+    EXPECT_EQ(simd.dot(x.data(), x.data(), n),
+              std::inner_product(x.begin(), x.end(), x.begin(), 0.0));
+    EXPECT_TRUE(std::isnan(moments[0]));
+    EXPECT_EQ(moments[3], -3);
+    EXPECT_EQ(moments[4], 15);
+    simd.moments(y.data(), n, moments);
+    EXPECT_EQ(moments[0], std::accumulate(y.begin(), y.end(), 0.0));
+    EXPECT_EQ(moments[2],
+              std::inner_product(y.begin(), y.end(), y.begin(), 0.0));
+    EXPECT_EQ(moments[1], 110.5);
+    EXPECT_EQ(simd.abs_sum(y.data(), n), 110.5);
+    EXPECT_EQ(moments[3], 7 - 0.25 * 36);
+    EXPECT_EQ(moments[4], 7);
+    // the tolerances of the near kernel, the difference in the tail
+    std::vector<double> w = x;
+    w[n - 1] = std::nextafter(std::nextafter(w[n - 1], 100.0), 100.0);
+    EXPECT_FALSE(simd.near(x.data(), w.data(), n, 0, 0, 1));
+    EXPECT_TRUE(simd.near(x.data(), w.data(), n, 0, 0, 2));
+    EXPECT_TRUE(simd.near(x.data(), w.data(), n, 1e-14, 0, 0));
+    EXPECT_TRUE(simd.near(x.data(), w.data(), n, 0, 1e-15, 0));
+    EXPECT_FALSE(simd.near(x.data(), z.data(), n, 1e300, 1e300, 1 << 20));
+    EXPECT_EQ(simd.max_difference(x.data(), y.data(), n), 17);
+    EXPECT_TRUE(std::isnan(simd.max_difference(x.data(), z.data(), n)));
+  }
+}
+
+TEST(OperationsTests, axpy_test) {
+  // ARRANGE
+  std::vector<double> vec1{1, 2, 3, 4, 5, 6};
+  std::vector<double> vec2{6, 5, 4, 3, 2, 1};
+  std::vector<double> res{13, 12, 11, 10, 9, 8};
+
+  std::unique_ptr<VectorsMatrixBuilder> builder{
+      std::make_unique<VectorsMatrixBuilder>(VectorsMatrixBuilder())};
+
+  std::unique_ptr<S21Matrix> A = builder->CreateMatrix(2, 3);
+  builder->FillMatrix(vec1, A);
+  std::unique_ptr<S21Matrix> B = builder->CreateMatrix(2, 3);
+  builder->FillMatrix(vec2, B);
+  std::unique_ptr<S21Matrix> C = builder->CreateMatrix(2, 3);
+  builder->FillMatrix(res, C);
+
+  // ACT
+  A->AxpyMatrix(2, *B);
+
+  // ASSERT
+  EXPECT_EQ(A->EqMatrix(*C), 1);
+  EXPECT_THROW(A->AxpyMatrix(2, S21Matrix(3, 2)), std::invalid_argument);
+
+  A.reset();
+  B.reset();
+  C.reset();
+  builder.reset();
+}
+
+TEST(OperationsTests, padded_rows_test) {
+  // ARRANGE
+  // rows of 40 columns are padded, the operations go row by row
+  S21Matrix A(5, 40), B(5, 40);
+  for (auto i = 0; i < 5; ++i)
+    for (auto j = 0; j < 40; ++j) {
+      A.SetValue(i, j, i + j);
+      B.SetValue(i, j, i - j);
+    }
+
+  // ACT
+  S21Matrix sum = A, diff = A;
+  sum.SumMatrix(B);
+  diff.SubMatrix(B);
+  sum.MulNumber(0.5);
+
+  // ASSERT
+  for (auto i = 0; i < 5; ++i)
+    for (auto j = 0; j < 40; ++j) {
+      EXPECT_EQ(sum.GetValue(i, j), i);
+      EXPECT_EQ(diff.GetValue(i, j), 2 * j);
+    }
+  EXPECT_EQ(A.EqMatrix(B), 0);
+  B = A;
+  EXPECT_EQ(A.EqMatrix(B), 1);
+}
@@ -0,0 +1,177 @@
+#include <cmath>
+#include <vector>
+
+#include "s21_tests.h"
+
+namespace {
+
+using Format = S21SparseMatrix::Format;
+
+// a dense matrix with about one nonzero in density elements
+S21Matrix SparseDense(int rows, int cols, int density) {
+  S21Matrix result(rows, cols);
+  for (auto i = 0; i < rows; ++i)
+    for (auto j = 0; j < cols; ++j)
+      if ((i * 7 + j * 13) % density == 0)
+        result.SetValue(i, j, std::sin(i + 3.0 * j) + 2);
+  return result;
+}
+
+}  // namespace
+
+TEST(SparseTests, dense_conversion_test) {
+  // ARRANGE
+  S21Matrix dense = SparseDense(9, 14, 5);
+  dense.SetValue(0, 1, 1e-9);
+
+  for (auto format : {Format::kCsr, Format::kCsc}) {
+    // ACT
+    S21SparseMatrix all(dense, 0, format);
+    S21SparseMatrix large(dense, 1e-6, format);
+
+    // ASSERT
+    EXPECT_EQ(all.GetFormat(), format);
+    EXPECT_TRUE(all.ToDense().EqMatrix(dense));
+    EXPECT_EQ(large.GetNonZeros(), all.GetNonZeros() - 1);
+    EXPECT_EQ(large.GetValue(0, 1), 0);
+    EXPECT_EQ(all.GetValue(0, 1), 1e-9);
+    EXPECT_EQ(all.GetValue(8, 13), dense(8, 13));
+    EXPECT_THROW(all.GetValue(9, 0), std::out_of_range);
+    EXPECT_THROW(all.GetValue(0, -1), std::out_of_range);
+  }
+  EXPECT_THROW(S21SparseMatrix(0, 3), std::invalid_argument);
+}
+
+TEST(SparseTests, compressed_arrays_test) {
+  // ARRANGE
+  // 1 0 2
+  // 0 0 3
+  S21SparseMatrix csr(2, 3, {{1, 2, 3}, {0, 2, 2}, {0, 0, 1}});
+
+  // ACT
+  S21SparseMatrix csc = csr.ToFormat(Format::kCsc);
+
+  // ASSERT
+  EXPECT_EQ(csr.GetOffsets(), (std::vector<std::ptrdiff_t>{0, 2, 3}));
+  EXPECT_EQ(csr.GetIndices(), (std::vector<int>{0, 2, 2}));
+  EXPECT_EQ(csr.GetValues(), (std::vector<double>{1, 2, 3}));
+  EXPECT_EQ(csc.GetOffsets(), (std::vector<std::ptrdiff_t>{0, 1, 1, 3}));
+  EXPECT_EQ(csc.GetIndices(), (std::vector<int>{0, 0, 1}));
+  EXPECT_EQ(csc.GetValues(), (std::vector<double>{1, 2, 3}));
+  EXPECT_TRUE(csc.EqMatrix(csr));
+  EXPECT_TRUE(csc.ToFormat(Format::kCsr).EqMatrix(csr));
+}
+
+TEST(SparseTests, triplets_test) {
+  // ARRANGE
+  std::vector<S21SparseMatrix::Triplet> triplets = {
+      {2, 1, 1}, {0, 3, 4}, {2, 1, 2}, {1, 0, 5}, {1, 0, -5}, {0, 0, 6}};
+
+  for (auto format : {Format::kCsr, Format::kCsc}) {
+    // ACT
+    S21SparseMatrix matrix(3, 4, triplets, format);
+
+    // ASSERT
+    // the repeated coordinates are added and the zero sum is dropped
+    EXPECT_EQ(matrix.GetNonZeros(), 3);
+    EXPECT_EQ(matrix.GetValue(2, 1), 3);
+    EXPECT_EQ(matrix.GetValue(1, 0), 0);
+    EXPECT_EQ(matrix.GetValue(0, 3), 4);
+    EXPECT_EQ(matrix.GetValue(0, 0), 6);
+  }
+  EXPECT_THROW(S21SparseMatrix(3, 4, {{3, 0, 1}}), std::out_of_range);
+  EXPECT_THROW(S21SparseMatrix(3, 4, {{0, 4, 1}}), std::out_of_range);
+}
+
+TEST(SparseTests, sum_sub_mul_number_test) {
+  // ARRANGE
+  S21Matrix a = SparseDense(12, 10, 4), b = SparseDense(12, 10, 3);
+  b.MulNumber(-0.5);
+  S21Matrix expected_sum(a), expected_difference(a);
+  expected_sum.SumMatrix(b);
+  expected_difference.SubMatrix(b);
+
+  for (auto format : {Format::kCsr, Format::kCsc}) {
+    S21SparseMatrix sum(a, 0, format), difference(a, 0, format);
+    S21SparseMatrix other(b, 0, Format::kCsr), scaled(a, 0, format);
+
+    // ACT
+    sum.SumMatrix(other);
+    difference.SubMatrix(other);
+    scaled.MulNumber(3);
+    S21SparseMatrix cancelled(scaled);
+    cancelled.SubMatrix(scaled);
+
+    // ASSERT
+    ExpectNear(sum.ToDense(), expected_sum, 1e-12);
+    ExpectNear(difference.ToDense(), expected_difference, 1e-12);
+    EXPECT_EQ(scaled.GetValue(0, 0), 3 * a(0, 0));
+    EXPECT_EQ(cancelled.GetNonZeros(), 0);
+    scaled.MulNumber(0);
+    EXPECT_EQ(scaled.GetNonZeros(), 0);
+  }
+  S21SparseMatrix a_sparse(a);
+  EXPECT_THROW(a_sparse.SumMatrix(S21SparseMatrix(10, 12)),
+               std::invalid_argument);
+}
+
+TEST(SparseTests, transpose_test) {
+  // ARRANGE
+  S21Matrix dense = SparseDense(7, 11, 3);
+  S21SparseMatrix csr(dense);
+
+  // ACT
+  S21SparseMatrix transposed = csr.Transpose();
+
+  // ASSERT
+  EXPECT_EQ(transposed.GetFormat(), Format::kCsc);
+  EXPECT_EQ(transposed.GetRows(), 11);
+  EXPECT_TRUE(transposed.ToDense().EqMatrix(dense.Transpose()));
+  EXPECT_TRUE(transposed.Transpose().EqMatrix(csr));
+}
+
+TEST(SparseTests, mul_vector_test) {
+  // ARRANGE
+  S21Matrix dense = SparseDense(300, 200, 7);
+  std::vector<double> x(200);
+  for (auto j = 0; j < 200; ++j) x[j] = j % 3 ? std::sin(j) : 0;
+
+  for (auto format : {Format::kCsr, Format::kCsc}) {
+    S21SparseMatrix sparse(dense, 0, format);
+
+    // ACT
+    std::vector<double> y = sparse.MulVector(x);
+
+    // ASSERT
+    ASSERT_EQ(y.size(), 300u);
+    for (auto i = 0; i < 300; ++i) {
+      double expected = 0;
+      for (auto j = 0; j < 200; ++j) expected += dense(i, j) * x[j];
+      EXPECT_NEAR(y[i], expected, 1e-12);
+    }
+    EXPECT_THROW(sparse.MulVector(std::vector<double>(300)),
+                 std::invalid_argument);
+  }
+}
+
+TEST(SparseTests, mul_matrix_test) {
+  // ARRANGE
+  // enough rows and columns for several tasks of the thread pool
+  S21Matrix a = SparseDense(150, 90, 5), b = WaveMatrix(90, 140);
+  S21Matrix c = WaveMatrix(70, 150);
+  S21Matrix expected_ab = a * b, expected_ca = c * a;
+
+  for (auto format : {Format::kCsr, Format::kCsc}) {
+    S21SparseMatrix sparse(a, 0, format);
+
+    // ACT
+    S21Matrix ab = sparse * b;
+    S21Matrix ca = c * sparse;
+
+    // ASSERT
+    ExpectNear(ab, expected_ab, 1e-12);
+    ExpectNear(ca, expected_ca, 1e-12);
+    EXPECT_THROW(sparse.MulMatrix(c), std::invalid_argument);
+    EXPECT_THROW(sparse.LeftMulMatrix(b), std::invalid_argument);
+  }
+}
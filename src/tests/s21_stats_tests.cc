@@ -0,0 +1,94 @@
+#include <thread>
+
+#include "s21_tests.h"
+
+using s21::Operation;
+
+// the counters are compiled in with make test STATS=1, otherwise the
+// snapshots must stay empty
+TEST(StatsTests, operations_test) {
+  // ARRANGE
+  S21Matrix A(4, 4), B(4, 4), C(40, 40);
+  for (auto i = 0; i < 4; ++i) A.SetValue(i, i, 2);
+  s21::ResetStats();
+
+  // ACT
+  A.MulMatrix(B);
+  S21Matrix D = A * B;
+  C.MulMatrix(C);
+  A.Determinant();
+  A.SumMatrix(B);
+  s21::StatsSnapshot stats = s21::GetThreadStats();
+
+  // ASSERT
+  const s21::OperationStats &mul = stats[Operation::kMulMatrix];
+  if (!s21::kStatsEnabled) {
+    EXPECT_EQ(mul.calls, 0u);
+    EXPECT_EQ(stats.allocations, 0u);
+    return;
+  }
+  EXPECT_EQ(mul.calls, 3u);
+  // 16 elements twice and 1600 once
+  EXPECT_EQ(mul.sizes[4], 2u);
+  EXPECT_EQ(mul.sizes[10], 1u);
+  EXPECT_EQ(stats[Operation::kDeterminant].calls, 1u);
+  EXPECT_EQ(stats[Operation::kSumMatrix].calls, 1u);
+  EXPECT_EQ(stats[Operation::kInverseMatrix].calls, 0u);
+  EXPECT_GT(mul.nanoseconds, 0u);
+  // the results of the three products and the copy factorized by LU
+  EXPECT_EQ(stats.allocations, 4u);
+  EXPECT_EQ(stats.allocated_bytes, (16 + 16 + 1600 + 16) * sizeof(double));
+  // the replaced storage of A and C and the LU copy
+  EXPECT_EQ(stats.deallocations, 3u);
+}
+
+TEST(StatsTests, threads_test) {
+  // ARRANGE
+  s21::ResetStats();
+
+  // ACT
+  std::thread worker([] {
+    S21Matrix A(3, 3);
+    A.Transpose();
+  });
+  worker.join();
+  S21Matrix B(3, 3);
+  B.Transpose();
+  s21::StatsSnapshot all = s21::GetStats();
+  s21::StatsSnapshot own = s21::GetThreadStats();
+  s21::ResetStats();
+
+  // ASSERT
+  const std::uint64_t calls = s21::kStatsEnabled ? 1 : 0;
+  EXPECT_EQ(all[Operation::kTranspose].calls, 2 * calls);
+  EXPECT_EQ(own[Operation::kTranspose].calls, calls);
+  EXPECT_EQ(s21::GetStats()[Operation::kTranspose].calls, 0u);
+}
+
+TEST(StatsTests, format_test) {
+  // ARRANGE
+  s21::StatsSnapshot stats = s21::StatsSnapshot();
+  stats.operations[static_cast<int>(Operation::kInverseMatrix)].calls = 2;
+  stats.operations[static_cast<int>(Operation::kInverseMatrix)].nanoseconds =
+      1500000;
+  stats.operations[static_cast<int>(Operation::kInverseMatrix)].sizes[3] = 2;
+  stats.allocations = 5;
+  stats.allocated_bytes = 640;
+
+  // ACT
+  std::string text = s21::FormatStats(stats, s21::StatsFormat::kText);
+  std::string json = s21::FormatStats(stats, s21::StatsFormat::kJson);
+
+  // ASSERT
+  EXPECT_NE(text.find("InverseMatrix"), std::string::npos);
+  EXPECT_NE(text.find("1.500"), std::string::npos);
+  EXPECT_NE(text.find("8: 2"), std::string::npos);
+  EXPECT_EQ(text.find("Determinant"), std::string::npos);
+  EXPECT_NE(json.find("\"InverseMatrix\": {\"calls\": 2, \"nanoseconds\": "
+                      "1500000, \"sizes\": {\"8\": 2}}"),
+            std::string::npos);
+  EXPECT_NE(json.find("\"allocations\": {\"count\": 5, \"bytes\": 640}"),
+            std::string::npos);
+  EXPECT_STREQ(s21::OperationName(Operation::kCalcComplements),
+               "CalcComplements");
+}
@@ -0,0 +1,103 @@
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "s21_tests.h"
+
+namespace {
+
+std::vector<double> Filled(int rows, int cols, int ld, double phase) {
+  std::vector<double> result(static_cast<std::size_t>(rows) * ld);
+  for (auto i = 0; i < rows; ++i)
+    for (auto j = 0; j < cols; ++j)
+      result[i * ld + j] = std::sin(phase + i * 0.7 + j);
+  return result;
+}
+
+// restores the crossover of the other tests
+class CrossoverGuard {
+ public:
+  CrossoverGuard() : previous_(s21::GetStrassenCrossover()) {}
+  ~CrossoverGuard() { s21::SetStrassenCrossover(previous_); }
+
+ private:
+  int previous_;
+};
+
+}  // namespace
+
+TEST(StrassenTests, accuracy_test) {
+  // ARRANGE
+  // even and odd dimensions on every level, padded leading dimensions
+  const int shapes[][3] = {
+      {8, 8, 8}, {64, 64, 64}, {7, 9, 8}, {100, 37, 53}, {129, 130, 131}};
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  for (auto &shape : shapes)
+    for (auto crossover : {2, 9, 24}) {
+      if (crossover == 2 && shape[0] > 64) continue;
+      const int m = shape[0], n = shape[1], k = shape[2];
+      const int lda = k + 1, ldb = n + 3, ldc = n + 2;
+      std::vector<double> a = Filled(m, k, lda, 0), b = Filled(k, n, ldb, 1);
+      std::vector<double> expected(static_cast<std::size_t>(m) * ldc);
+      s21::Gemm(m, n, k, 1, a.data(), lda, b.data(), ldb, expected.data(),
+                ldc);
+      // the previous contents of C and the end of the workspace are NaN
+      std::vector<double> c(static_cast<std::size_t>(m) * ldc, nan);
+      const std::size_t size = s21::StrassenWorkspace(m, n, k, crossover);
+      std::vector<double> workspace(size + 8, nan);
+
+      // ACT
+      s21::StrassenGemm(m, n, k, a.data(), lda, b.data(), ldb, c.data(), ldc,
+                        crossover, workspace.data());
+
+      // ASSERT
+      for (auto i = 0; i < m; ++i)
+        for (auto j = 0; j < n; ++j)
+          ASSERT_NEAR(c[i * ldc + j], expected[i * ldc + j], 1e-12 * k)
+              << m << " " << n << " " << k << " " << crossover;
+      for (auto i = size; i < size + 8; ++i)
+        EXPECT_TRUE(std::isnan(workspace[i]));
+    }
+}
+
+TEST(StrassenTests, workspace_test) {
+  // ACT and ASSERT
+  EXPECT_EQ(s21::StrassenWorkspace(1000, 1000, 1000, 0), 0u);
+  EXPECT_EQ(s21::StrassenWorkspace(100, 1000, 1000, 101), 0u);
+  // the levels of orders 512, 256, 128 and 64 take X and Y of their halves
+  EXPECT_EQ(s21::StrassenWorkspace(512, 512, 512, 64),
+            2u * (256 * 256 + 128 * 128 + 64 * 64 + 32 * 32));
+  // X holds the larger of a half of A and a quadrant of C
+  EXPECT_EQ(s21::StrassenWorkspace(4, 6, 2, 2), 2u * 3 + 1u * 3);
+}
+
+TEST(StrassenTests, crossover_test) {
+  // ARRANGE
+  CrossoverGuard guard;
+  S21Matrix a(97, 90), b(90, 101);
+  for (auto i = 0; i < 97; ++i)
+    for (auto j = 0; j < 90; ++j) a.SetValue(i, j, std::cos(i - 2.0 * j));
+  for (auto i = 0; i < 90; ++i)
+    for (auto j = 0; j < 101; ++j) b.SetValue(i, j, std::sin(i + 0.5 * j));
+  s21::SetStrassenCrossover(0);
+  S21Matrix expected = a * b;
+
+  // ACT
+  s21::SetStrassenCrossover(20);
+  S21Matrix product = a * b;
+  S21Matrix mul = a;
+  mul.MulMatrix(b);
+  S21Matrix view_product = a.View().MulMatrix(b);
+
+  // ASSERT
+  EXPECT_EQ(s21::GetStrassenCrossover(), 20);
+  EXPECT_FALSE(product.EqMatrix(expected));
+  for (auto i = 0; i < 97; ++i)
+    for (auto j = 0; j < 101; ++j) {
+      EXPECT_NEAR(product(i, j), expected(i, j), 1e-11);
+      EXPECT_EQ(mul(i, j), product(i, j));
+      EXPECT_EQ(view_product(i, j), product(i, j));
+    }
+  s21::SetStrassenCrossover(-5);
+  EXPECT_EQ(s21::GetStrassenCrossover(), 0);
+}
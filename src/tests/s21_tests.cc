@@ -411,6 +411,26 @@ TEST(MutatorsTests, set_value_test) {
   builder.reset();
 }
 
+TEST(MutatorsTests, set_cols_wide_test) {
+  // ARRANGE
+  // rows this wide are padded in memory, the values must survive resizing
+  S21Matrix A = S21Matrix(3, 70);
+  for (auto i = 0; i < 3; ++i)
+    for (auto j = 0; j < 70; ++j) A.SetValue(i, j, i * 100 + j);
+
+  // ACT
+  A.SetCols(33);
+  S21Matrix B = A;
+  B.SetCols(5);
+
+  // ASSERT
+  EXPECT_EQ(A.GetCols(), 33);
+  EXPECT_EQ(A.GetValue(2, 32), 232);
+  EXPECT_EQ(B.GetValue(1, 4), 104);
+  for (auto i = 0; i < 3; ++i)
+    for (auto j = 0; j < 33; ++j) EXPECT_EQ(A.GetValue(i, j), i * 100 + j);
+}
+
 TEST(AccessorTests, get_value_test) {
   // ARRANGE
   std::vector<double> vec1{1, 51, 4, 5};
@@ -590,7 +610,7 @@ TEST(OperatorsTests, operator_mul_matrix_test) {
   builder->FillMatrix(res, C);
 
   // ACT
-  *A **B;
+  *A = *A * *B;
 
   // ASSERT
   EXPECT_EQ(*A == *C, 1);
@@ -615,7 +635,7 @@ TEST(OperatorsTests, operator_mul_num_test) {
   builder->FillMatrix(res, B);
 
   // ACT
-  *A * 3;
+  *A = *A * 3;
 
   // ASSERT
   EXPECT_EQ(*A == *B, 1);
@@ -698,5 +718,8 @@ TEST(OperatorsTests, operator_insex_test) {
 
 int main(int argc, char *argv[]) {
   ::testing::InitGoogleTest(&argc, argv);
+  // the expected values of the products hold for the classical kernel, so
+  // S21_STRASSEN_CROSSOVER is overridden; the Strassen tests set their own
+  s21::SetStrassenCrossover(0);
   return RUN_ALL_TESTS();
 }
\ No newline at end of file
@@ -3,7 +3,37 @@
 
 #include <gtest/gtest.h>
 
+#include "../s21_batch.h"
+#include "../s21_compare.h"
+#include "../s21_cholesky.h"
+#include "../s21_execution.h"
+#include "../s21_fixed_matrix.h"
+#include "../s21_gemm.h"
+#include "../s21_io.h"
+#include "../s21_lu.h"
 #include "../s21_matrix_oop.h"
+#include "../s21_memory.h"
+#include "../s21_out_of_core.h"
+#include "../s21_qr.h"
+#include "../s21_reduce.h"
+#include "../s21_simd.h"
+#include "../s21_sparse.h"
+#include "../s21_stats.h"
+#include "../s21_strassen.h"
+#include "../s21_thread_pool.h"
+#include "../s21_transpose.h"
+#include "../s21_triangular.h"
+#include "../s21_updatable_inverse.h"
 #include "s21_matrix_builder.h"
 
+// every element of actual within the tolerance of the expected one
+inline void ExpectNear(const S21Matrix &actual, const S21Matrix &expected,
+                       double tolerance) {
+  ASSERT_EQ(actual.GetRows(), expected.GetRows());
+  ASSERT_EQ(actual.GetCols(), expected.GetCols());
+  for (auto i = 0; i < actual.GetRows(); ++i)
+    for (auto j = 0; j < actual.GetCols(); ++j)
+      EXPECT_NEAR(actual(i, j), expected(i, j), tolerance);
+}
+
 #endif  // SRC_S21_TESTS_H_
\ No newline at end of file
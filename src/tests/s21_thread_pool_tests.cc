@@ -0,0 +1,97 @@
+#include <atomic>
+
+#include "s21_tests.h"
+
+TEST(ThreadPoolTests, parallel_for_test) {
+  // ARRANGE
+  const int threads = s21::GetNumThreads();
+  s21::SetNumThreads(4);
+  std::vector<std::atomic<int>> visits(10007);
+  std::atomic<int> nested_calls{0};
+
+  // ACT
+  s21::ParallelFor(visits.size(), 100,
+                   [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+                     for (auto i = begin; i < end; ++i) ++visits[i];
+                     // a nested loop runs on the same thread at once
+                     s21::ParallelFor(1000, 1,
+                                      [&](std::ptrdiff_t b, std::ptrdiff_t e) {
+                                        if (b == 0 && e == 1000)
+                                          ++nested_calls;
+                                      });
+                   });
+
+  // ASSERT
+  EXPECT_EQ(s21::GetNumThreads(), 4);
+  for (auto &count : visits) EXPECT_EQ(count, 1);
+  EXPECT_GT(nested_calls, 0);
+  EXPECT_THROW(s21::ParallelFor(100, 1,
+                                [](std::ptrdiff_t begin, std::ptrdiff_t) {
+                                  if (begin > 50) throw std::runtime_error("");
+                                }),
+               std::runtime_error);
+  EXPECT_THROW(s21::SetNumThreads(0), std::invalid_argument);
+
+  s21::SetNumThreads(threads);
+}
+
+TEST(ThreadPoolTests, parallel_operations_test) {
+  // ARRANGE
+  const int threads = s21::GetNumThreads();
+  // large enough for every operation to split its work
+  S21Matrix A = WaveMatrix(300, 290, 0), B = WaveMatrix(290, 310, 1),
+            C = WaveMatrix(300, 290, 2);
+  s21::SetNumThreads(1);
+  S21Matrix serial_product = A, serial_sum = A, serial_scaled = A;
+  serial_product.MulMatrix(B);
+  serial_sum.SumMatrix(C);
+  serial_scaled.AxpyMatrix(-3, C);
+  S21Matrix serial_transposed = A.Transpose();
+  S21Matrix serial_inverse = DominantMatrix(130).InverseMatrix();
+
+  // ACT
+  s21::SetNumThreads(5);
+  S21Matrix product = A, sum = A, scaled = A;
+  product.MulMatrix(B);
+  sum.SumMatrix(C);
+  scaled.AxpyMatrix(-3, C);
+  S21Matrix transposed = A.Transpose();
+  S21Matrix inverse = DominantMatrix(130).InverseMatrix();
+
+  // ASSERT
+  EXPECT_EQ(product.EqMatrix(serial_product), 1);
+  EXPECT_EQ(sum.EqMatrix(serial_sum), 1);
+  EXPECT_EQ(scaled.EqMatrix(serial_scaled), 1);
+  EXPECT_EQ(transposed.EqMatrix(serial_transposed), 1);
+  EXPECT_EQ(inverse.EqMatrix(serial_inverse), 1);
+  sum.SetValue(299, 289, 100);
+  EXPECT_EQ(sum.EqMatrix(serial_sum), 0);
+
+  s21::SetNumThreads(threads);
+}
+
+TEST(ThreadPoolTests, concurrent_resize_test) {
+  // ARRANGE
+  const int threads = s21::GetNumThreads();
+  std::atomic<bool> done{false};
+  std::atomic<int> bad_counts{0};
+  s21::SetNumThreads(1);
+
+  // ACT
+  // the count is read while another thread resizes the pool
+  std::thread reader([&] {
+    while (!done)
+      if (s21::GetNumThreads() < 1 || s21::GetNumThreads() > 3) ++bad_counts;
+  });
+  for (auto i = 0; i < 50; ++i) {
+    s21::SetNumThreads(i % 3 + 1);
+    s21::ParallelFor(1000, 1, [](std::ptrdiff_t, std::ptrdiff_t) {});
+  }
+  done = true;
+  reader.join();
+
+  // ASSERT
+  EXPECT_EQ(bad_counts, 0);
+
+  s21::SetNumThreads(threads);
+}
@@ -0,0 +1,110 @@
+#include <atomic>
+#include <vector>
+
+#include "s21_tests.h"
+
+namespace {
+
+void ExpectTransposed(const S21Matrix &matrix, const S21Matrix &result) {
+  ASSERT_EQ(result.GetRows(), matrix.GetCols());
+  ASSERT_EQ(result.GetCols(), matrix.GetRows());
+  for (auto i = 0; i < matrix.GetRows(); ++i)
+    for (auto j = 0; j < matrix.GetCols(); ++j)
+      ASSERT_EQ(result(j, i), matrix(i, j));
+}
+
+}  // namespace
+
+TEST(TransposeTests, block_kernel_levels_test) {
+  // ARRANGE
+  const int lda = 11, ldb = 13;
+  std::vector<double> a(8 * lda);
+  for (std::size_t i = 0; i < a.size(); ++i) a[i] = i;
+  const s21::SimdLevel levels[] = {s21::SimdLevel::kScalar,
+                                   s21::SimdLevel::kSse2, s21::SimdLevel::kAvx2,
+                                   s21::SimdLevel::kAvx512};
+  for (auto level : levels) {
+    std::vector<double> b(8 * ldb, -1);
+
+    // ACT
+    s21::SimdFor(level).transpose_block(a.data(), lda, b.data(), ldb);
+
+    // ASSERT
+    for (auto i = 0; i < 8; ++i)
+      for (auto j = 0; j < 8; ++j) EXPECT_EQ(b[j * ldb + i], a[i * lda + j]);
+    // the padding between the rows is not touched
+    EXPECT_EQ(b[8], -1);
+
+    // the streamed variant needs aligned rows of whole cache lines
+    alignas(64) double streamed[8 * 16];
+    s21::SimdFor(level).transpose_block_stream(a.data(), lda, streamed, 16);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (auto i = 0; i < 8; ++i)
+      for (auto j = 0; j < 8; ++j)
+        EXPECT_EQ(streamed[j * 16 + i], a[i * lda + j]);
+  }
+}
+
+TEST(TransposeTests, out_of_place_test) {
+  // ARRANGE
+  // sizes around the block and the tile edges, narrow and padded rows
+  // the largest one is streamed
+  const int sizes[][2] = {{1, 1},   {1, 9},   {9, 1},    {7, 8},
+                          {8, 8},   {17, 33}, {33, 17},  {64, 65},
+                          {100, 40}, {300, 257}, {1500, 1403}};
+  for (auto &size : sizes) {
+    S21Matrix matrix = FilledMatrix(size[0], size[1]);
+
+    // ACT
+    S21Matrix result = matrix.Transpose();
+
+    // ASSERT
+    ExpectTransposed(matrix, result);
+  }
+}
+
+TEST(TransposeTests, square_in_place_test) {
+  // ARRANGE
+  const int sizes[] = {1, 2, 7, 8, 31, 33, 64, 100, 300};
+  for (auto n : sizes) {
+    S21Matrix matrix = FilledMatrix(n, n);
+    S21Matrix copy = matrix;
+
+    // ACT
+    S21Matrix result = std::move(copy).Transpose();
+
+    // ASSERT
+    ExpectTransposed(matrix, result);
+  }
+}
+
+TEST(TransposeTests, rectangular_in_place_test) {
+  // ARRANGE
+  // dense shapes are permuted in place, the padded ones are copied
+  const int sizes[][2] = {{1, 5}, {2, 3}, {5, 13}, {31, 3}, {20, 40}, {50, 7}};
+  for (auto &size : sizes) {
+    S21Matrix matrix = FilledMatrix(size[0], size[1]);
+    S21Matrix copy = matrix;
+
+    // ACT
+    S21Matrix result = std::move(copy).Transpose();
+
+    // ASSERT
+    ExpectTransposed(matrix, result);
+    EXPECT_TRUE(result == matrix.Transpose());
+  }
+}
+
+TEST(TransposeTests, cycles_test) {
+  // ARRANGE
+  const int rows = 12, cols = 35;
+  std::vector<double> a(rows * cols);
+  for (std::size_t i = 0; i < a.size(); ++i) a[i] = i;
+
+  // ACT
+  s21::TransposeCycles(rows, cols, a.data());
+
+  // ASSERT
+  for (auto i = 0; i < rows; ++i)
+    for (auto j = 0; j < cols; ++j) EXPECT_EQ(a[j * rows + i], i * cols + j);
+}
@@ -0,0 +1,49 @@
+#include <limits>
+#include <vector>
+
+#include "s21_tests.h"
+
+TEST(TriangularTests, solve_test) {
+  // ARRANGE
+  // one block, several blocks with a partial one, single and padded columns
+  const int sizes[][2] = {{1, 1}, {5, 3}, {64, 1}, {150, 1}, {150, 40}};
+  const s21::Triangle triangles[] = {
+      s21::Triangle::kLower, s21::Triangle::kUnitLower, s21::Triangle::kUpper,
+      s21::Triangle::kLowerTransposed};
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  for (auto triangle : triangles)
+    for (auto &size : sizes) {
+      const int n = size[0], cols = size[1], ldt = n + 3, ldx = cols + 2;
+      const bool lower = triangle != s21::Triangle::kUpper;
+      const bool unit = triangle == s21::Triangle::kUnitLower;
+      // the elements outside the triangle are NaN, so reading one shows
+      std::vector<double> t(n * ldt, nan);
+      S21Matrix dense(n, n), x(n, cols);
+      for (auto i = 0; i < n; ++i)
+        for (auto j = 0; j < n; ++j) {
+          if (lower ? j > i : j < i) continue;
+          const double value = i == j ? 4 + std::cos(i) : std::sin(i + 2 * j);
+          if (!(unit && i == j)) t[i * ldt + j] = value;
+          const bool transposed =
+              triangle == s21::Triangle::kLowerTransposed;
+          dense.SetValue(transposed ? j : i, transposed ? i : j,
+                         unit && i == j ? 1 : value);
+        }
+      for (auto i = 0; i < n; ++i)
+        for (auto j = 0; j < cols; ++j) x.SetValue(i, j, i - 0.5 * j);
+      S21Matrix b = dense * x;
+      std::vector<double> solution(n * ldx, nan);
+      for (auto i = 0; i < n; ++i)
+        for (auto j = 0; j < cols; ++j) solution[i * ldx + j] = b(i, j);
+
+      // ACT
+      s21::SolveTriangular(triangle, n, cols, t.data(), ldt, solution.data(),
+                           ldx);
+
+      // ASSERT
+      for (auto i = 0; i < n; ++i)
+        for (auto j = 0; j < cols; ++j)
+          ASSERT_NEAR(solution[i * ldx + j], x(i, j), 1e-9)
+              << static_cast<int>(triangle) << " " << n << " " << cols;
+    }
+}
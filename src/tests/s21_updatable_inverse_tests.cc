@@ -0,0 +1,142 @@
+#include <cmath>
+
+#include "s21_tests.h"
+
+namespace {
+
+// the inverse and the determinant agree with a new factorization
+void ExpectFactorized(const S21UpdatableInverse &updatable,
+                      const S21Matrix &expected) {
+  const S21LUDecomposition lu(expected);
+  EXPECT_TRUE(updatable.GetMatrix().EqMatrix(expected));
+  EXPECT_TRUE(updatable.InverseMatrix().EqMatrix(lu.InverseMatrix(),
+                                                 s21::Tolerance{1e-14, 1e-9}));
+  EXPECT_NEAR(updatable.Determinant(), lu.Determinant(),
+              1e-10 * std::fabs(lu.Determinant()));
+}
+
+}  // namespace
+
+TEST(UpdatableInverseTests, rank_one_test) {
+  // ARRANGE
+  S21Matrix A = DominantMatrix(40);
+  S21UpdatableInverse updatable(A);
+  S21Matrix row(1, 40), col(40, 1), rhs(40, 2);
+  for (auto j = 0; j < 40; ++j) {
+    row(0, j) = std::cos(j * 3.0) + (j == 10 ? 60 : 0);
+    col(j, 0) = std::cos(j * 5.0) + (j == 20 ? 70 : 0);
+    rhs(j, 0) = j;
+    rhs(j, 1) = 1;
+  }
+
+  // ACT
+  updatable.SetValue(3, 5, 7.5);
+  updatable.SetRow(10, row);
+  updatable.SetCol(20, col);
+  A(3, 5) = 7.5;
+  for (auto j = 0; j < 40; ++j) A(10, j) = row(0, j);
+  for (auto i = 0; i < 40; ++i) A(i, 20) = col(i, 0);
+
+  // ASSERT
+  EXPECT_EQ(updatable.GetSize(), 40);
+  EXPECT_EQ(updatable.GetUpdateCount(), 3);
+  ExpectFactorized(updatable, A);
+  EXPECT_TRUE(updatable.Solve(rhs).EqMatrix(S21LUDecomposition(A).Solve(rhs),
+                                            s21::Tolerance{1e-13, 1e-9}));
+  EXPECT_GE(updatable.ConditionEstimate(), 1);
+}
+
+TEST(UpdatableInverseTests, woodbury_test) {
+  // ARRANGE
+  S21Matrix A = DominantMatrix(30);
+  S21UpdatableInverse updatable(A);
+  S21Matrix U(30, 3), V(30, 3);
+  for (auto i = 0; i < 30; ++i)
+    for (auto j = 0; j < 3; ++j) {
+      U(i, j) = std::sin(i + 11.0 * j);
+      V(i, j) = std::cos(2.0 * i - j);
+    }
+
+  // ACT
+  updatable.Update(U, V);
+  A += U * V.Transpose();
+
+  // ASSERT
+  EXPECT_EQ(updatable.GetUpdateCount(), 1);
+  EXPECT_TRUE(updatable.GetMatrix().EqMatrix(A, s21::Tolerance{1e-14, 0}));
+  EXPECT_TRUE(updatable.InverseMatrix().EqMatrix(A.InverseMatrix(),
+                                                 s21::Tolerance{1e-14, 1e-9}));
+  EXPECT_NEAR(updatable.Determinant(), A.Determinant(),
+              1e-10 * std::fabs(A.Determinant()));
+}
+
+TEST(UpdatableInverseTests, refactor_test) {
+  // ARRANGE
+  S21Matrix identity(3, 3), A = DominantMatrix(20);
+  for (auto i = 0; i < 3; ++i) identity(i, i) = 1;
+  S21UpdatableInverse small(identity), updatable(A);
+  S21Matrix scaled(1, 20);
+  for (auto j = 0; j < 20; ++j) scaled(0, j) = 1e4 * A(0, j);
+  const double condition = updatable.ConditionEstimate();
+
+  // ACT
+  // the capacitance 1 + (1e-8 - 1) * 1 is too close to 0 for the identity
+  small.SetValue(0, 0, 1e-8);
+  // the condition number grows about 1e4 times
+  updatable.SetRow(0, scaled);
+  for (auto j = 0; j < 20; ++j) A(0, j) = scaled(0, j);
+
+  // ASSERT
+  EXPECT_EQ(small.GetUpdateCount(), 0);
+  EXPECT_EQ(small.Determinant(), 1e-8);
+  EXPECT_EQ(small.InverseMatrix()(0, 0), 1e8);
+  EXPECT_EQ(updatable.GetUpdateCount(), 0);
+  EXPECT_GT(updatable.ConditionEstimate(), 100 * condition);
+  ExpectFactorized(updatable, A);
+  // a row equal to another one makes the matrix singular
+  EXPECT_THROW(updatable.SetRow(1, scaled), std::invalid_argument);
+  EXPECT_TRUE(updatable.GetMatrix().EqMatrix(A));
+}
+
+TEST(UpdatableInverseTests, badly_scaled_test) {
+  // ARRANGE
+  // regular, although its smallest pivot is far below the largest element
+  S21Matrix A(4, 4);
+  const double diagonal[4] = {1e10, 1, 1, 1e-7};
+  for (auto i = 0; i < 4; ++i) A(i, i) = diagonal[i];
+
+  // ACT
+  S21UpdatableInverse updatable(A);
+  // an upper triangular update keeps the determinant
+  updatable.SetValue(1, 2, 0.5);
+  A(1, 2) = 0.5;
+
+  // ASSERT
+  EXPECT_TRUE(updatable.GetMatrix().EqMatrix(A));
+  EXPECT_NEAR(updatable.Determinant(), 1e3, 1e-9);
+  EXPECT_NEAR(updatable.InverseMatrix()(1, 2), -0.5, 1e-12);
+  EXPECT_NEAR(updatable.InverseMatrix()(3, 3), 1e7, 1e-5);
+}
+
+TEST(UpdatableInverseTests, errors_test) {
+  // ARRANGE
+  S21Matrix singular(3, 3);
+  S21UpdatableInverse updatable(DominantMatrix(4));
+  const S21Matrix before = updatable.InverseMatrix();
+
+  // ACT and ASSERT
+  EXPECT_THROW(S21UpdatableInverse(S21Matrix(2, 3)), std::invalid_argument);
+  EXPECT_THROW(S21UpdatableInverse{singular}, std::invalid_argument);
+  EXPECT_THROW(updatable.SetValue(4, 0, 1), std::out_of_range);
+  EXPECT_THROW(updatable.SetRow(-1, S21Matrix(1, 4)), std::out_of_range);
+  EXPECT_THROW(updatable.SetRow(0, S21Matrix(4, 1)), std::invalid_argument);
+  EXPECT_THROW(updatable.SetCol(0, S21Matrix(1, 4)), std::invalid_argument);
+  EXPECT_THROW(updatable.Update(S21Matrix(4, 2), S21Matrix(4, 3)),
+               std::invalid_argument);
+  EXPECT_THROW(updatable.Solve(S21Matrix(3, 1)), std::invalid_argument);
+  // a singular update leaves the state as it was
+  EXPECT_THROW(updatable.SetCol(2, S21Matrix(4, 1)), std::invalid_argument);
+  EXPECT_EQ(updatable.GetUpdateCount(), 0);
+  EXPECT_TRUE(updatable.GetMatrix().EqMatrix(DominantMatrix(4)));
+  EXPECT_TRUE(updatable.InverseMatrix().EqMatrix(before));
+}
@@ -0,0 +1,141 @@
+#include "s21_tests.h"
+
+namespace {
+
+// the element (i, j) is 100 * i + j
+S21Matrix IndexMatrix(int rows, int cols) {
+  S21Matrix result(rows, cols);
+  for (auto i = 0; i < rows; ++i)
+    for (auto j = 0; j < cols; ++j) result.SetValue(i, j, 100.0 * i + j);
+  return result;
+}
+
+}  // namespace
+
+TEST(ViewTests, slicing_test) {
+  // ARRANGE
+  S21Matrix matrix = IndexMatrix(6, 40);
+
+  // ACT
+  S21MatrixView block = matrix.Block(1, 2, 3, 4);
+  S21MatrixView row = matrix.Row(5);
+  S21MatrixView col = matrix.Col(7);
+  S21MatrixView strided = matrix.View().Strided(2, 3);
+  S21MatrixView transposed = block.Transposed();
+
+  // ASSERT
+  EXPECT_EQ(block.GetRows(), 3);
+  EXPECT_EQ(block.GetCols(), 4);
+  EXPECT_EQ(block(2, 3), 305);
+  EXPECT_EQ(block.Data(),
+            matrix.View().Data() + matrix.View().GetRowStride() + 2);
+  EXPECT_EQ(row.GetCols(), 40);
+  EXPECT_EQ(row(0, 39), 539);
+  EXPECT_EQ(col.GetRows(), 6);
+  EXPECT_EQ(col.GetColStride(), 1);
+  EXPECT_EQ(col(4, 0), 407);
+  EXPECT_EQ(strided.GetRows(), 3);
+  EXPECT_EQ(strided.GetCols(), 14);
+  EXPECT_EQ(strided(2, 13), 439);
+  EXPECT_EQ(transposed.GetRows(), 4);
+  EXPECT_EQ(transposed(3, 2), 305);
+  EXPECT_EQ(block.Block(1, 1, 2, 2)(1, 1), 304);
+  EXPECT_THROW(matrix.Block(4, 0, 3, 1), std::out_of_range);
+  EXPECT_THROW(matrix.Row(6), std::out_of_range);
+  EXPECT_THROW(block(3, 0), std::out_of_range);
+  EXPECT_THROW(matrix.View().Strided(0, 1), std::invalid_argument);
+}
+
+TEST(ViewTests, copy_test) {
+  // ARRANGE
+  S21Matrix matrix = IndexMatrix(45, 37);
+
+  // ACT
+  S21Matrix block(matrix.Block(3, 4, 20, 33));
+  S21Matrix transposed(matrix.View().Transposed());
+  S21Matrix strided(matrix.View().Strided(3, 2).Transposed());
+
+  // ASSERT
+  EXPECT_EQ(block(19, 32), 2236);
+  EXPECT_TRUE(transposed.EqMatrix(matrix.Transpose()));
+  EXPECT_TRUE(transposed.EqMatrix(matrix.View().Transpose()));
+  EXPECT_EQ(strided.GetRows(), 19);
+  EXPECT_EQ(strided.GetCols(), 15);
+  EXPECT_EQ(strided(18, 14), 4236);
+  EXPECT_TRUE(matrix.Block(0, 0, 20, 33).EqMatrix(S21Matrix(
+      matrix.Block(0, 0, 20, 33))));
+  EXPECT_FALSE(matrix.EqMatrix(matrix.Block(0, 0, 45, 36)));
+  EXPECT_TRUE(matrix.Col(5).EqMatrix(transposed.Row(5).Transposed()));
+}
+
+TEST(ViewTests, destination_test) {
+  // ARRANGE
+  S21Matrix matrix = IndexMatrix(4, 5);
+  S21Matrix ones(2, 3);
+  for (auto i = 0; i < 2; ++i)
+    for (auto j = 0; j < 3; ++j) ones.SetValue(i, j, 1);
+
+  // ACT
+  matrix.Block(1, 1, 2, 3).SumMatrix(ones);
+  matrix.Col(0).MulNumber(-1);
+  matrix.View().Strided(1, 2).Row(3).SubMatrix(matrix.Row(3).Strided(1, 2));
+  matrix.Block(0, 0, 3, 2).Transposed().AxpyMatrix(2,
+                                                   ones.Block(0, 0, 2, 3));
+
+  // ASSERT
+  EXPECT_EQ(matrix(1, 1), 104);
+  EXPECT_EQ(matrix(2, 3), 204);
+  EXPECT_EQ(matrix(0, 4), 4);
+  EXPECT_EQ(matrix(2, 0), -198);
+  EXPECT_EQ(matrix(1, 0), -98);
+  EXPECT_EQ(matrix(3, 0), 0);
+  EXPECT_EQ(matrix(3, 1), 301);
+  EXPECT_EQ(matrix(3, 4), 0);
+  EXPECT_THROW(matrix.Row(0).SumMatrix(ones), std::invalid_argument);
+}
+
+TEST(ViewTests, overlapping_operand_test) {
+  // ARRANGE
+  S21Matrix matrix = IndexMatrix(3, 3);
+  S21Matrix expected = matrix + matrix.Transpose();
+  S21Matrix shifted = IndexMatrix(1, 6);
+
+  // ACT
+  // the transposition reads elements that the sum has already written
+  matrix.SumMatrix(matrix.View().Transposed());
+  shifted.Block(0, 1, 1, 5).SumMatrix(shifted.Block(0, 0, 1, 5));
+
+  // ASSERT
+  EXPECT_TRUE(matrix.EqMatrix(expected));
+  EXPECT_EQ(shifted(0, 5), 9);
+  EXPECT_EQ(shifted(0, 1), 1);
+}
+
+TEST(ViewTests, read_only_operations_test) {
+  // ARRANGE
+  S21Matrix matrix(5, 5);
+  for (auto i = 0; i < 5; ++i)
+    for (auto j = 0; j < 5; ++j)
+      matrix.SetValue(i, j, i == j ? 4 + i : 1.0 / (1 + i + 2 * j));
+  S21Matrix inner(matrix.Block(1, 1, 4, 4));
+
+  // ACT
+  S21MatrixView view = matrix.Block(1, 1, 4, 4);
+
+  // ASSERT
+  EXPECT_DOUBLE_EQ(view.Determinant(), inner.Determinant());
+  EXPECT_TRUE(view.InverseMatrix().EqMatrix(inner.InverseMatrix()));
+  EXPECT_TRUE(view.CalcComplements().EqMatrix(inner.CalcComplements()));
+  EXPECT_TRUE(view.MinorMatrix(1, 2).EqMatrix(inner.MinorMatrix(1, 2)));
+  EXPECT_TRUE(view.Transposed().MinorMatrix(2, 1).EqMatrix(
+      inner.MinorMatrix(1, 2).Transpose()));
+  EXPECT_TRUE(view.MulMatrix(matrix.Block(0, 0, 4, 2))
+                  .EqMatrix(inner * S21Matrix(matrix.Block(0, 0, 4, 2))));
+  EXPECT_TRUE(view.Transposed().MulMatrix(view).EqMatrix(
+      inner.Transpose() * inner));
+  S21Matrix product(inner);
+  product.MulMatrix(matrix.Block(1, 0, 4, 3));
+  EXPECT_TRUE(product.EqMatrix(inner * S21Matrix(matrix.Block(1, 0, 4, 3))));
+  EXPECT_THROW(view.MulMatrix(matrix.Block(0, 0, 3, 3)),
+               std::invalid_argument);
+}